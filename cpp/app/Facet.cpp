@@ -20,12 +20,17 @@ Facet::Facet(Onceref<FnReturn> fret, bool writer):
 	inputTriead_(false),
 	fret_(fret),
 	queueLimit_(DEFAULT_QUEUE_LIMIT),
+	queueRing_(false),
 	reverse_(false),
-#if 0  // {
 	unicast_(false),
-#endif // }
 	appReady_(false),
-	connected_(false)
+	connected_(false),
+	coalesceTrans_(0),
+	coalesceOps_(0),
+	coalesceDelayUs_(0),
+	xtrans_(0),
+	xstart_(0),
+	holding_(false)
 { 
 	if (fret->facet_ != NULL) {
 		err_.f("Can not use the same FnReturn for two Facets.");
@@ -62,16 +67,23 @@ Facet::Facet(Unit *unit, Autoref<Nexus> nx, const string &fullname, const string
 	name_(fullname),
 	nexus_(nx),
 	writer_(writer),
+	inputTriead_(false),
 	fret_(new FnReturn(unit, asname)), // will be filled in the body
 	queueLimit_(nx->queueLimit()),
+	queueRing_(nx->queueRing()),
 	beginIdx_(nx->beginIdx_),
 	endIdx_(nx->endIdx_),
 	reverse_(nx->isReverse()),
-#if 0  // {
-	unicast_(nx->isUnicast())
-#endif // }
+	unicast_(nx->isUnicast()),
+	partition_(nx->partition_),
 	appReady_(false),
-	connected_(false)
+	connected_(false),
+	coalesceTrans_(0),
+	coalesceOps_(0),
+	coalesceDelayUs_(0),
+	xtrans_(0),
+	xstart_(0),
+	holding_(false)
 {
 	Autoref<HoldRowTypes> holder = new HoldRowTypes;
 
@@ -113,14 +125,50 @@ Facet *Facet::setReverse(bool on)
 	return this;
 }
 
-#if 0  // {
 Facet *Facet::setUnicast(bool on)
 {
 	assertNotImported();
 	unicast_ = on;
 	return this;
 }
-#endif // }
+
+Facet *Facet::setPartitionKey(const string &label, Onceref<NameSet> key)
+{
+	assertNotImported();
+	int idx = fret_->findLabel(label);
+	if (idx < 0) {
+		err_.f("Can not partition by an unknown label '%s'.", label.c_str());
+		return this;
+	}
+	if (idx == beginIdx_ || idx == endIdx_) {
+		err_.f("Can not partition by the label '%s', it's used for the transaction framing.", label.c_str());
+		return this;
+	}
+	if (key.isNull() || key->empty()) {
+		err_.f("Can not partition by an empty key of the label '%s'.", label.c_str());
+		return this;
+	}
+
+	const RowType *rt = fret_->getRowType(idx);
+	NexusPartition::FieldVec fields;
+	bool bad = false;
+	for (NameSet::const_iterator it = key->begin(); it != key->end(); ++it) {
+		int fidx = rt->findIdx(*it);
+		if (fidx < 0) {
+			err_.f("Can not find the partition key field '%s' in the label '%s'.", it->c_str(), label.c_str());
+			bad = true;
+		}
+		fields.push_back(fidx);
+	}
+	if (bad)
+		return this;
+
+	if (partition_.isNull())
+		partition_ = new NexusPartition(fret_->size(), beginIdx_, endIdx_);
+	partition_->setKey(idx, fields);
+	unicast_ = true;
+	return this;
+}
 
 Facet *Facet::setQueueLimit(int limit)
 {
@@ -132,6 +180,26 @@ Facet *Facet::setQueueLimit(int limit)
 	return this;
 }
 
+Facet *Facet::setQueueRing(bool on)
+{
+	assertNotImported();
+	queueRing_ = on;
+	return this;
+}
+
+Facet *Facet::setCoalesce(int maxTrans, int maxOps, int64_t maxDelayUs)
+{
+	// this may be called after the import, when nobody checks the errors
+	// any more, so throw right away
+	if (maxTrans < 0 || maxOps < 0 || maxDelayUs < 0)
+		throw Exception::fTrace("Can not set the coalescing limits of the facet '%s' to maxTrans=%d maxOps=%d maxDelayUs=%lld, they must not be negative.",
+			name_.c_str(), maxTrans, maxOps, (long long)maxDelayUs);
+	coalesceTrans_ = maxTrans;
+	coalesceOps_ = maxOps;
+	coalesceDelayUs_ = maxDelayUs;
+	return this;
+}
+
 Facet *Facet::exportRowType(const string &name, Onceref<RowType> rtype)
 {
 	assertNotImported();
@@ -219,19 +287,21 @@ void Facet::reimport(Nexus *nexus, const string &tname)
 	nexus_ = nexus;
 	name_ = buildFullName(tname, fret_->getName());
 	queueLimit_ = nexus->queueLimit(); // might have been adjusted for reverse nexus
+	queueRing_ = nexus->queueRing(); // same
+	unicast_ = nexus->isUnicast(); // might have been implied by the partitioning
 }
 
 void Facet::connectToNexus(QueEvent *qev, bool fake)
 {
 	qev_ = qev;
 	if (writer_) {
-		wr_ = new NexusWriter;
+		wr_ = new NexusWriter(unicast_, partition_);
 		if (!fake) {
 			nexus_->addWriter(wr_);
 			connected_ = true;
 		}
 	} else {
-		rd_ = new ReaderQueue(qev, queueLimit_);
+		rd_ = new ReaderQueue(qev, queueLimit_, queueRing_);
 		if (!fake) {
 			nexus_->addReader(rd_);
 			connected_ = true;
@@ -285,6 +355,8 @@ void Facet::flushWriterD()
 	if (!wr_.isNull() && !fret_->isXtrayEmpty()) {
 		Autoref<Xtray> xt = new Xtray(fret_->getType());
 		fret_->swapXtray(xt);
+		xtrans_ = 0;
+		releaseHold();
 		wr_->write(xt);
 	}
 }
@@ -294,7 +366,90 @@ void Facet::discardXtray()
 	if (!wr_.isNull() && !fret_->isXtrayEmpty()) {
 		Autoref<Xtray> xt = new Xtray(fret_->getType());
 		fret_->swapXtray(xt);
+		xtrans_ = 0;
+		releaseHold();
+	}
+}
+
+void Facet::releaseHold()
+{
+	if (holding_) {
+		holding_ = false;
+		qev_->releaseHold();
+	}
+}
+
+int64_t Facet::coalesceNow()
+{
+	timespec tm;
+	clock_gettime(CLOCK_MONOTONIC, &tm);
+	return (int64_t)tm.tv_sec * 1000000 + tm.tv_nsec / 1000;
+}
+
+bool Facet::coalesceFull(int64_t now) const
+{
+	if (xtrans_ >= coalesceTrans_)
+		return true;
+	if (coalesceOps_ > 0 && fret_->xtray_->size() >= coalesceOps_)
+		return true;
+	if (now != 0 && now - xstart_ >= coalesceDelayUs_)
+		return true;
+	return false;
+}
+
+bool Facet::endTransaction()
+{
+	// when a drain is requested, everything gets flushed right away
+	if (coalesceTrans_ > 1 && !wr_.isNull() && appReady_ && !qev_->isRqDrain()) {
+		int64_t now = 0;
+		if (coalesceDelayUs_ > 0) {
+			now = coalesceNow();
+			if (xtrans_ == 0)
+				xstart_ = now;
+		}
+		++xtrans_;
+		if (!coalesceFull(now)) {
+			// an input-only thread must stay undrained while keeping the data
+			if (inputTriead_ && !holding_)
+				holding_ = qev_->holdWrite();
+			if (holding_ || !inputTriead_) {
+				fret_->pushXtrayBoundary();
+				return true;
+			}
+		}
 	}
+	return flushWriter();
+}
+
+bool Facet::isFlushDue(int64_t &now) const
+{
+	if (wr_.isNull() || fret_->isXtrayEmpty())
+		return false;
+	// If the last transaction is not complete, it gets flushed the same
+	// way as without coalescing.
+	if (!isCoalescing() || xtrans_ == 0 || fret_->xtray_->backIdx() >= 0)
+		return true;
+	if (qev_->isRqDrain())
+		return true;
+	if (coalesceDelayUs_ <= 0)
+		return false;
+	if (now == 0)
+		now = coalesceNow();
+	return (now - xstart_ >= coalesceDelayUs_);
+}
+
+int64_t Facet::flushDueUs(int64_t &now) const
+{
+	if (wr_.isNull() || !isCoalescing() || xtrans_ == 0)
+		return -1;
+	if (qev_->isRqDrain())
+		return 0;
+	if (coalesceDelayUs_ <= 0)
+		return -1;
+	if (now == 0)
+		now = coalesceNow();
+	int64_t left = xstart_ + coalesceDelayUs_ - now;
+	return (left < 0)? 0 : left;
 }
 
 }; // TRICEPS_NS
@@ -10,6 +10,7 @@
 #define __Triceps_Facet_h__
 
 #include <common/Common.h>
+#include <type/NameSet.h>
 #include <app/Nexus.h>
 #include <sched/FnReturn.h>
 
@@ -30,6 +31,7 @@ class Facet: public Mtarget
 	friend class Triead;
 	friend class TrieadOwner;
 	friend class Nexus;
+	friend class FnReturn::RetLabel;
 public:
 	typedef Nexus::RowTypeMap RowTypeMap;
 	typedef Nexus::TableTypeMap TableTypeMap;
@@ -115,23 +117,113 @@ public:
 	// @return - the same Facet
 	Facet *setReverse(bool on = true);
 
-#if 0  // {
 	// Mark the future Nexus as unicast. The normal ("multicast") nexuses
 	// send all the data passing through them to all the readers.
 	// The unicast nexuses send each piece of the input to one
-	// of the readers, chosen essentially at random. This allows
+	// of the readers: the one with the shortest queue, and among
+	// the equal ones in the round-robin order. This allows
 	// to implement the worker thread pools. A whole transaction
 	// goes to the same reader.
 	// May be called only until the Facet is exported or will throw an Exception.
 	// @param on - flag: the unicast mode is on
 	// @return - the same Facet
 	Facet *setUnicast(bool on = true);
-#endif // }
+
+	// Partition the future Nexus by the key of a row type. Each row
+	// of this type will go to only one reader, selected by the hash of
+	// the key fields, so all the rows with the same key go to the same
+	// reader (as long as the set of readers doesn't change). This allows
+	// to split a stateful computation between the worker threads.
+	// The rows of the types without a key go to every reader, no matter
+	// which readers get the keyed rows, and the _BEGIN_ and _END_ rows go
+	// to every reader that gets any other data from the same transaction.
+	// So a transaction that has any rows without a key, or no keyed rows
+	// at all, reaches all the readers.
+	// Implies the unicast mode. May be called for multiple labels, each
+	// with its own key.
+	// May be called only until the Facet is exported or will throw an Exception.
+	// The errors in the arguments get recorded in the facet.
+	//
+	// @param label - name of the label in the FnReturn
+	// @param key - names of the key fields in the row type of the label
+	// @return - the same Facet
+	Facet *setPartitionKey(const string &label, Onceref<NameSet> key);
 
 	// Set the nexus queue limit.
 	// @param limit - the new limit value (make sure to keep it >0).
 	Facet *setQueueLimit(int limit);
+
+	// Set the nexus queues to use the lock-free ring buffers instead of
+	// the double-buffered deques protected by a mutex. This reduces the
+	// overhead of passing the small Xtrays at a high rate. It's used only
+	// with the queue limits up to ReaderQueue::RING_LIMIT_MAX, and never
+	// with the reverse nexuses (that have no limit), the larger queues
+	// silently stay in the normal mode.
+	// May be called only until the Facet is exported or will throw an Exception.
+	// @param on - flag: the ring mode is on
+	// @return - the same Facet
+	Facet *setQueueRing(bool on = true);
 	
+	// Set the coalescing of the transactions written into this facet.
+	// Normally each transaction gets sent to the nexus in a separate
+	// Xtray. With coalescing, multiple transactions get packed into
+	// one Xtray, separated by the transaction boundary ops (with idx -1),
+	// until one of the limits is reached. This reduces the overhead
+	// on the small transactions at the cost of the latency.
+	// Whatever is collected gets also flushed when the thread runs out
+	// of the input data or calls flushWriters() explicitly, so the data
+	// doesn't get stuck in the facet indefinitely.
+	//
+	// Unlike the other settings, this one applies only to the writer in this
+	// thread and not to the nexus, so it may be changed at any time,
+	// including after the facet is imported. It doesn't affect the readers,
+	// they just see the transactions as usual.
+	//
+	// The delay limit gets checked at the end of each transaction and
+	// after processing each incoming Xtray. A thread with readers also flushes
+	// everything before it goes to sleep waiting for more input, so nothing
+	// stays collected while it's idle. But an input-only thread waits
+	// for its input outside of Triceps, where nothing can check the delay for
+	// it, so it must do that by itself: use TrieadOwner::flushDueUs() as the
+	// timeout of its own waiting and then call TrieadOwner::flushWritersDue().
+	//
+	// A drain request stops the coalescing: the following transactions
+	// get flushed right away, and so does the collected data on the
+	// next flushWritersDue() (flushDueUs() returns 0 during a drain).
+	// An input-only thread doesn't count as drained while it keeps
+	// any collected data. Whatever is still collected when the thread
+	// gets marked dead is discarded, so flush it before exiting.
+	//
+	// Throws an Exception if any limit is negative.
+	//
+	// @param maxTrans - flush when the Xtray collects this many transactions;
+	//        0 or 1 means no coalescing, every transaction gets flushed immediately
+	// @param maxOps - flush when the Xtray collects this many rowops; 0 means no limit
+	// @param maxDelayUs - flush when the first transaction in the Xtray has
+	//        been waiting for this many microseconds; 0 means no limit
+	// @return - the same Facet
+	Facet *setCoalesce(int maxTrans, int maxOps = 0, int64_t maxDelayUs = 0);
+
+	// Get back the coalescing limits.
+	int coalesceTrans() const
+	{
+		return coalesceTrans_;
+	}
+	int coalesceOps() const
+	{
+		return coalesceOps_;
+	}
+	int64_t coalesceDelayUs() const
+	{
+		return coalesceDelayUs_;
+	}
+
+	// Check whether this facet coalesces the transactions.
+	bool isCoalescing() const
+	{
+		return coalesceTrans_ > 1;
+	}
+
 	// Get the collected errors.
 	Erref getErrors() const
 	{
@@ -169,13 +261,17 @@ public:
 		return reverse_;
 	}
 
-#if 0  // {
 	// Check whether the underlying nexus is unicast.
 	bool isUnicast() const
 	{
 		return unicast_;
 	}
-#endif // }
+
+	// Check whether the underlying nexus is partitioned by the keys.
+	bool isPartitioned() const
+	{
+		return !partition_.isNull();
+	}
 
 	// Get the queue size limit.
 	int queueLimit() const
@@ -183,6 +279,12 @@ public:
 		return queueLimit_;
 	}
 
+	// Get the flag of the ring mode of the queues.
+	bool queueRing() const
+	{
+		return queueRing_;
+	}
+
 	// Get back the FnReturn.
 	// Since the caller is not expected to immediately destroy this object
 	// with its reference, returning a pointer is safe enough.
@@ -304,6 +406,37 @@ protected:
 	// other methods.
 	void disconnectFromNexus();
 
+	// Called by FnReturn at the end of each non-empty transaction
+	// written through this facet. If the facet is coalescing and the
+	// limits are not reached yet, marks the transaction boundary
+	// in the Xtray. Otherwise flushes the Xtray.
+	//
+	// @return - same as flushWriter()
+	bool endTransaction();
+
+	// Check whether a coalescing facet has reached its limits and its
+	// Xtray must be flushed. Called at the end of each transaction.
+	// @param now - the current time, in microseconds (if 0, the delay
+	//        limit will not be checked)
+	bool coalesceFull(int64_t now) const;
+
+	// Check whether the Xtray has to be flushed by flushWritersDue().
+	// A coalescing facet keeps the complete transactions until they
+	// exceed the delay limit or a drain gets requested, everything
+	// else gets flushed.
+	// @param now - the current time, in microseconds, or 0 if not known yet
+	//        (then it gets filled on demand, to be reused with the other facets)
+	bool isFlushDue(int64_t &now) const;
+
+	// Find when the delay limit of a coalescing facet will expire.
+	// @param now - the current time, same as for isFlushDue()
+	// @return - the time left in microseconds (0 if already expired
+	//        or a drain is requested), or -1 if there is no delay limit pending
+	int64_t flushDueUs(int64_t &now) const;
+
+	// Get the current monotonic time for the coalescing delays, in microseconds.
+	static int64_t coalesceNow();
+
 	// The internal version of flushWriter that bypasses the 
 	// check for appReady_ and input-only synchronization.
 	// These parts are expected to be done by the caller Triead in bulk.
@@ -315,6 +448,10 @@ protected:
 	// keeps trying to write.
 	void discardXtray();
 
+	// Release the hold of an input-only thread on its QueEvent when
+	// the coalesced data stops being kept (see QueEvent::holdWrite()).
+	void releaseHold();
+
 	// called by the Triead/TrieadOwner
 	void setAppReady()
 	{
@@ -346,14 +483,22 @@ protected:
 	RowTypeMap rowTypes_; // the collection of row types
 	TableTypeMap tableTypes_; // the collection of table types
 	int queueLimit_; // the queue size limit for the nexus
+	bool queueRing_; // flag: the nexus queues use the ring buffers
 	int beginIdx_; // index of the _BEGIN_ label
 	int endIdx_; // index of the _END_ label
 	bool reverse_; // flag: this nexus's main queue is pointed upwards
-#if 0  // {
 	bool unicast_; // flag: each row goes to only one reader, as opposed to copied to all readers
-#endif // }
+	Autoref<NexusPartition> partition_; // the partitioning by keys, or NULL if not partitioned
 	bool appReady_; // flag: the App is ready, so the data passing can be done
 	bool connected_; // flag: the facet is connected to the nexus
+	int coalesceTrans_; // flush when the Xtray has this many transactions, 0 or 1 - no coalescing
+	int coalesceOps_; // flush when the Xtray has this many ops, 0 - no limit
+	int64_t coalesceDelayUs_; // flush when the first transaction has waited this long, 0 - no limit
+	int xtrans_; // the number of complete transactions in the current Xtray
+	int64_t xstart_; // the time when the first transaction in the current Xtray was completed
+	bool holding_; // flag: the coalesced data holds the input-only thread undrained
+	Rowref beginRow_; // the cached empty row for the synthetic _BEGIN_, created on first use
+	Rowref endRow_; // the cached empty row for the synthetic _END_, created on first use
 
 private:
 	Facet();
@@ -18,12 +18,15 @@ Nexus::Nexus(const string &tname, Facet *facet):
 	name_(facet->getShortName()),
 	// the "no limit" for reverse nexus translates to a very large limit
 	queueLimit_(facet->isReverse()? Xtray::QUE_ID_MAX: facet->queueLimit()),
+	// the reverse nexus can not have a bounded ring
+	queueRing_(!facet->isReverse() && facet->queueRing()
+		&& facet->queueLimit() <= ReaderQueue::RING_LIMIT_MAX),
 	beginIdx_(facet->beginIdx_),
 	endIdx_(facet->endIdx_),
-	reverse_(facet->isReverse())
-#if 0  // {
-	unicast_(facet->isUnicast())
-#endif // }
+	reverse_(facet->isReverse()),
+	// the partitioned nexus is always unicast
+	unicast_(facet->isUnicast() || facet->isPartitioned()),
+	partition_(facet->partition_)
 { 
 	// deep-copy the types
 	Autoref<HoldRowTypes> holder = new HoldRowTypes;
@@ -62,7 +65,7 @@ void Nexus::addReader(ReaderQueue *rq)
 		pw::lockmutex lm(rfirst->mutex());
 
 		rfirst->setGenL(gen);
-		rq->prevId_ = rq->lastId_ = rfirst->lastId_;
+		rq->initIdL(rfirst->getLastIdL());
 
 		for (; it != end; ++it) {
 			pw::lockmutex lm((*it)->mutex());
@@ -73,7 +76,7 @@ void Nexus::addReader(ReaderQueue *rq)
 			(*wit)->setReaderVec(rnew);
 	} else {
 		// the new reader is the first one
-		rq->prevId_ = rq->lastId_ = 0; // any value is good, as long as it's the same
+		rq->initIdL(0); // any value is good, as long as it's the same
 
 		for (WriterVec::iterator wit = writers_.begin(); wit != writers_.end(); ++wit)
 			(*wit)->setReaderVec(rnew);
@@ -107,7 +110,7 @@ void Nexus::deleteReader(ReaderQueue *rq)
 		pw::lockmutex lm(rfirst->mutex());
 
 		rfirst->setGenL(gen);
-		Xtray::QueId idx = rfirst->lastId_; // read before setting dead!
+		Xtray::QueId idx = rfirst->getLastIdL(); // read before setting dead!
 
 		if (rq == rfirst) {
 			rq->markDeadL();
@@ -121,7 +124,9 @@ void Nexus::deleteReader(ReaderQueue *rq)
 			if (*it == rfirst)
 				continue;
 			pw::lockmutex lm((*it)->mutex());
-			(*it)->setLastIdL(idx);
+			// in a unicast nexus each reader keeps its own sequence of ids
+			if (!unicast_)
+				(*it)->setLastIdL(idx);
 			(*it)->setGenL(gen);
 		}
 
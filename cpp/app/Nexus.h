@@ -68,13 +68,17 @@ public:
 		return reverse_;
 	}
 
-#if 0  // {
 	// Check whether the nexus is unicast.
 	bool isUnicast() const
 	{
 		return unicast_;
 	}
-#endif // }
+
+	// Check whether the nexus is partitioned by the keys.
+	bool isPartitioned() const
+	{
+		return !partition_.isNull();
+	}
 
 	// Get the queue size limit.
 	int queueLimit() const
@@ -82,6 +86,12 @@ public:
 		return queueLimit_;
 	}
 
+	// Get the flag of the ring mode of the queues.
+	bool queueRing() const
+	{
+		return queueRing_;
+	}
+
 	// XXX add print() ?
 protected:
 	// Create a Nexus from its first Facet.
@@ -152,13 +162,13 @@ protected:
 	int nread_; // number of reader facets
 
 	int queueLimit_; // the queue size limit for the nexus
+	bool queueRing_; // flag: the queues use the ring buffers
 	int beginIdx_; // index of the _BEGIN_ label
 	int endIdx_; // index of the _END_ label
 
 	bool reverse_; // Flag: this nexus's main queue is pointed upwards
-#if 0  // {
 	bool unicast_; // Flag: each row goes to only one reader, as opposed to copied to all readers
-#endif // }
+	Autoref<NexusPartition> partition_; // the partitioning by keys, or NULL if not partitioned
 
 private:
 	Nexus();
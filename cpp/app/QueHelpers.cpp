@@ -6,6 +6,7 @@
 //
 // Various bits and pieces for the facet queues.
 
+#include <sched.h>
 #include <app/QueHelpers.h>
 
 namespace TRICEPS_NS {
@@ -17,17 +18,48 @@ QueEvent::QueEvent(DrainApp *drain):
 	rqDrain_(false), // drain_ doesn matter yet
 	dead_(false),
 	signaled_(false), 
-	evsleeper_(false)
+	evsleeper_(false),
+	held_(0),
+	spin_(0)
 { }
 
+// The hint to the CPU that this is a spin loop.
+static inline void cpuPause()
+{
+#if defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#endif
+}
+
+void QueEvent::spinWait()
+{
+	int n = spin_;
+	if (n <= 0)
+		return;
+
+	for (int i = 0; i < n; i++) {
+		if (__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST)
+		|| __atomic_load_n(&rqDrain_, __ATOMIC_SEQ_CST))
+			return;
+		cpuPause();
+	}
+	for (int i = 0; i < SPIN_YIELDS; i++) {
+		if (__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST)
+		|| __atomic_load_n(&rqDrain_, __ATOMIC_SEQ_CST))
+			return;
+		sched_yield();
+	}
+}
+
 void QueEvent::requestDrain()
 {
 	pw::lockmutex lm(cond_);
 	if (!rqDrain_) {
-		rqDrain_ = true;
+		// goes in the opposite order to the signal() fast path
+		__atomic_store_n(&rqDrain_, true, __ATOMIC_SEQ_CST);
 		// compute the initial drain state
 		if (dead_
-		|| (evsleeper_ && !signaled_)) {
+		|| (evsleeper_ && !__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST))) {
 			drained_ = true;
 			// drain_ will be initialized to assume that the thread is drained,
 			// so leave its state as-is
@@ -40,8 +72,9 @@ void QueEvent::requestDrain()
 
 int QueEvent::timedwaitL(const struct timespec &abstime)
 {
-	evsleeper_ = true;
-	while (!signaled_) {
+	// same as in waitL()
+	__atomic_store_n(&evsleeper_, true, __ATOMIC_SEQ_CST);
+	while (!__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST)) {
 		if (rqDrain_) { // do the untimed sleep
 			if (!drained_) { // copied from waitL()
 				drained_ = true;
@@ -49,21 +82,40 @@ int QueEvent::timedwaitL(const struct timespec &abstime)
 			}
 			cond_.wait();
 		} else {
-			if (cond_.timedwait(abstime) == ETIMEDOUT) {
-				evsleeper_ = false;
-				if (signaled_) {
-					signaled_ = false;
-					return 0;
-				} else if (!rqDrain_) { // never time out if a drain is requested
-					return ETIMEDOUT;
-				}
+			if (cond_.timedwait(abstime) == ETIMEDOUT
+			&& !rqDrain_ // never time out if a drain is requested
+			&& !__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST)) {
+				// A signal() that comes after the check sees the sleeper
+				// and waits for the mutex, so it will stay set for the
+				// next wait. The sleeper flag stays set if the wait
+				// continues because of a drain, for signalL() to wake it up.
+				__atomic_store_n(&evsleeper_, false, __ATOMIC_SEQ_CST);
+				return ETIMEDOUT;
 			}
 		}
 	}
-	evsleeper_ = false;
-	signaled_ = false;
+	endWaitL();
 	return 0;
 }
+
+//-------------------------- XtrayRing ----------------------------------
+
+XtrayRing::XtrayRing(Xtray::QueId limit)
+{
+	Xtray::QueId n = 2; // at least 2, for the initial ids to never match
+	while (n < limit)
+		n <<= 1;
+	mask_ = n - 1;
+	slots_ = new Slot[n];
+	for (Xtray::QueId i = 0; i < n; i++)
+		slots_[i].id_ = i + 1; // never matches any id that goes into this slot
+}
+
+XtrayRing::~XtrayRing()
+{
+	delete[] slots_;
+}
+
 //-------------------------- ReaderQueue --------------------------------
 
 // Adding a reader:
@@ -105,8 +157,28 @@ int QueEvent::timedwaitL(const struct timespec &abstime)
 // * for each other reader in the vector
 //   * get the lock, deposit the buffer at that id, release it - sleep if the queue is full
 //
+// The ring mode follows the same logic but instead of the locks uses
+// the atomic operations:
+// * The generation and the last id in the first reader get packed into
+//   a single "ticket", so issuing the next id becomes a compare-and-swap
+//   on the ticket that fails if the generation has changed. The changes
+//   of the vectors still lock the reader's mutex, and update the ticket
+//   with compare-and-swap too.
+// * The writers place the Xtrays into the ring slots by their ids,
+//   and the reader takes them in order without locking, see XtrayRing.
+// * The writers check the space in the queue by reading prevId_, and if
+//   there is no space, sleep on condfull_ with the mutex locked, keeping
+//   the count of sleepers in wrWaiting_. The reader checks wrWaiting_
+//   after advancing prevId_ and wakes them up. The order of operations
+//   on both sides (write one, then read the other) guarantees that at
+//   least one of them sees the change done by the other one.
+// * The same kind of ordering is used for the notifications of the
+//   reader: the writer signals the QueEvent if it sees its id right
+//   after prevId_, and the reader re-checks the ring after advancing
+//   prevId_.
+//
 
-ReaderQueue::ReaderQueue(QueEvent *qev, Xtray::QueId limit):
+ReaderQueue::ReaderQueue(QueEvent *qev, Xtray::QueId limit, bool ring):
 	qev_(qev),
 	sizeLimit_(limit),
 	rq_(0),
@@ -115,11 +187,25 @@ ReaderQueue::ReaderQueue(QueEvent *qev, Xtray::QueId limit):
 	gen_(-1),
 	wrhole_(false),
 	dead_(false),
-	wrReady_(false)
-{ }
+	wrReady_(false),
+	ring_(NULL),
+	ticket_(mkTicket(-1, 0)),
+	wrWaiting_(0)
+{
+	if (ring && limit <= RING_LIMIT_MAX)
+		ring_ = new XtrayRing(limit);
+}
+
+ReaderQueue::~ReaderQueue()
+{
+	delete ring_;
+}
 
 bool ReaderQueue::writeFirst(int gen, Xtray *xt, Xtray::QueId &trayId)
 {
+	if (ring_ != NULL)
+		return writeFirstRing(gen, xt, trayId);
+
 	pw::lockmutex lm(mutex());
 	if (dead_)
 		return false;
@@ -145,6 +231,11 @@ bool ReaderQueue::writeFirst(int gen, Xtray *xt, Xtray::QueId &trayId)
 
 void ReaderQueue::write(Xtray *xt, Xtray::QueId trayId)
 {
+	if (ring_ != NULL) {
+		writeRing(xt, trayId);
+		return;
+	}
+
 	pw::lockmutex lm(mutex());
 	if (dead_)
 		return;
@@ -184,6 +275,13 @@ void ReaderQueue::insertQueL(Xtray *xt, Xtray::QueId off)
 
 void ReaderQueue::setLastIdL(Xtray::QueId id)
 {
+	if (ring_ != NULL) {
+		// the holes in the ring don't need any special handling
+		lastId_ = id;
+		changeTicketL(-1, id, true);
+		return;
+	}
+
 	Xtray::QueId len = id - prevId_;
 	Xdeque &q = writeq();
 	if (q.size() < len) {
@@ -199,6 +297,9 @@ bool ReaderQueue::refill()
 		return true;
 	}
 
+	if (ring_ != NULL)
+		return refillRing();
+
 	if (!wrReady_) { // reading the flag should be safe enough without a lock
 		return false;
 	}
@@ -233,8 +334,12 @@ bool ReaderQueue::refill()
 void ReaderQueue::markDeadL()
 {
 	dead_ = true;
-	writeq().clear();
-	lastId_ = prevId_;
+	if (ring_ == NULL) {
+		writeq().clear();
+		lastId_ = prevId_;
+	}
+	// in the ring mode the ring can be accessed only by the reader,
+	// so it's left to refill() to discard the contents
 	condfull_.broadcast();
 
 	// notify the thread that this reader is dead
@@ -242,6 +347,112 @@ void ReaderQueue::markDeadL()
 	qev_->signal();
 }
 
+void ReaderQueue::changeTicketL(int gen, Xtray::QueId id, bool setId)
+{
+	uint64_t t = __atomic_load_n(&ticket_, __ATOMIC_SEQ_CST);
+	uint64_t nt;
+	do {
+		nt = mkTicket(gen >= 0? gen : ticketGen(t), setId? id : ticketId(t));
+	} while (!__atomic_compare_exchange_n(&ticket_, &t, nt, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+}
+
+bool ReaderQueue::writeFirstRing(int gen, Xtray *xt, Xtray::QueId &trayId)
+{
+	uint64_t t = __atomic_load_n(&ticket_, __ATOMIC_SEQ_CST);
+	while (true) {
+		if (dead_)
+			return false;
+		if (ticketGen(t) != gen)
+			return false;
+
+		Xtray::QueId id = ticketId(t) + 1;
+		if (id - __atomic_load_n(&prevId_, __ATOMIC_SEQ_CST) - 1 >= sizeLimit_) {
+			if (!waitRingSpace(id, gen))
+				return false;
+			t = __atomic_load_n(&ticket_, __ATOMIC_SEQ_CST);
+			continue;
+		}
+
+		// on failure t gets the current value and the loop retries
+		if (__atomic_compare_exchange_n(&ticket_, &t, mkTicket(gen, id), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+			trayId = id;
+			break;
+		}
+	}
+
+	putRing(xt, trayId);
+	return true;
+}
+
+void ReaderQueue::writeRing(Xtray *xt, Xtray::QueId trayId)
+{
+	if (dead_)
+		return;
+
+	if (trayId - __atomic_load_n(&prevId_, __ATOMIC_SEQ_CST) - 1 >= sizeLimit_) {
+		if (!waitRingSpace(trayId, -1))
+			return;
+	}
+
+	putRing(xt, trayId);
+}
+
+void ReaderQueue::putRing(Xtray *xt, Xtray::QueId trayId)
+{
+	ring_->put(xt, trayId);
+	if (trayId - __atomic_load_n(&prevId_, __ATOMIC_SEQ_CST) == 1) {
+		// the front of the queue became readable
+		wrReady_ = true; // before notification!
+		qev_->signal();
+	}
+}
+
+bool ReaderQueue::waitRingSpace(Xtray::QueId trayId, int gen)
+{
+	pw::lockmutex lm(mutex());
+	__atomic_add_fetch(&wrWaiting_, 1, __ATOMIC_SEQ_CST);
+	bool res = true;
+	while (trayId - __atomic_load_n(&prevId_, __ATOMIC_SEQ_CST) - 1 >= sizeLimit_) {
+		if (dead_ || (gen >= 0 && gen_ != gen)) {
+			res = false;
+			break;
+		}
+		condfull_.wait();
+	}
+	if (dead_ || (gen >= 0 && gen_ != gen))
+		res = false;
+	__atomic_sub_fetch(&wrWaiting_, 1, __ATOMIC_SEQ_CST);
+	return res;
+}
+
+bool ReaderQueue::refillRing()
+{
+	Xdeque &rq = readq();
+	Xtray::QueId id = prevId_; // only this thread changes it
+	Autoref<Xtray> xt;
+
+	while (true) {
+		while (ring_->take(id + 1, xt)) {
+			if (!dead_) // the dead queue only discards the data
+				rq.push_back(xt);
+			xt = NULL;
+			++id;
+		}
+		if (id == prevId_)
+			break; // nothing new, and the last check was done after the last update
+
+		wrReady_ = false;
+		__atomic_store_n(&prevId_, id, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&wrWaiting_, __ATOMIC_SEQ_CST) != 0) {
+			pw::lockmutex lm(mutex());
+			condfull_.broadcast();
+		}
+		// and then re-check for the writers that have seen the old prevId_
+	}
+
+	return !rq.empty();
+}
+
 //-------------------------- NexusWriter --------------------------------
 
 void NexusWriter::setReaderVec(ReaderVec *rv)
@@ -263,9 +474,29 @@ void NexusWriter::write(Xtray *xt)
 			continue;
 		}
 
+		Xtray::QueId xid;
+		if (unicast_) {
+			if (!part_.isNull() && readers_->v().size() > 1) {
+				if (!writePartitioned(xt)) {
+					// pick up the new readers and restart
+					pw::lockmutex lm(mutexNew_);
+					readers_ = readersNew_;
+					continue;
+				}
+				break;
+			}
+			// each reader issues its own ids
+			if (!readers_->v()[pickUnicast()]->writeFirst(readers_->gen(), xt, xid)) {
+				// pick up the new readers and restart
+				pw::lockmutex lm(mutexNew_);
+				readers_ = readersNew_;
+				continue;
+			}
+			break;
+		}
+
 		ReaderVec::Vec::const_iterator end = readers_->v().end();
 		ReaderVec::Vec::const_iterator it = readers_->v().begin();
-		Xtray::QueId xid;
 		if (!(*it)->writeFirst(readers_->gen(), xt, xid)) {
 			// pick up the new readers and restart
 			pw::lockmutex lm(mutexNew_);
@@ -280,5 +511,114 @@ void NexusWriter::write(Xtray *xt)
 	}
 }
 
+int NexusWriter::pickUnicast()
+{
+	const ReaderVec::Vec &v = readers_->v();
+	int n = (int)v.size();
+	if (rrIdx_ >= n)
+		rrIdx_ = 0;
+
+	int pick = rrIdx_;
+	Xtray::QueId best = v[pick]->depth();
+	for (int i = 1; i < n && best > 0; i++) {
+		int idx = rrIdx_ + i;
+		if (idx >= n)
+			idx -= n;
+		Xtray::QueId d = v[idx]->depth();
+		if (d < best) {
+			best = d;
+			pick = idx;
+		}
+	}
+
+	rrIdx_ = pick + 1;
+	return pick;
+}
+
+bool NexusWriter::writePartitioned(Xtray *xt)
+{
+	const RowSetType *rst = xt->getType();
+	int n = (int)readers_->v().size();
+	int sz = xt->size();
+
+	// find the destinations of the ops
+	dest_.resize(sz);
+	hasData_.assign(n, false);
+	bool keyed = false; // some rows have the keys
+	bool common = false; // some data rows have no keys
+	for (int i = 0; i < sz; i++) {
+		const Xtray::Op &op = xt->at(i);
+		if (part_->hasKey(op.idx_)) {
+			int p = (int)(part_->hash(rst->getRowType(op.idx_), op.idx_, op.row_) % (Hash::Value)n);
+			dest_[i] = p;
+			hasData_[p] = true;
+			keyed = true;
+		} else {
+			dest_[i] = DEST_ANY;
+			if (!part_->isFraming(op.idx_))
+				common = true;
+		}
+	}
+	// if there is no keyed data at all, the tray goes to everyone
+	bool all = (common || !keyed);
+
+	bool written = false;
+	for (int p = 0; p < n; p++) {
+		Autoref<Xtray> pxt = splitPart(xt, p, all);
+		if (pxt.isNull())
+			continue;
+
+		Xtray::QueId xid;
+		// If the readers change in the middle, the rest of the parts
+		// go to the new readers by the same partition numbers, since
+		// the parts already written can not be taken back.
+		while (!readers_->v()[p % readers_->v().size()]->writeFirst(readers_->gen(), pxt, xid)) {
+			if (!written)
+				return false;
+			pw::lockmutex lm(mutexNew_);
+			readers_ = readersNew_;
+			if (readers_.isNull() || readers_->v().empty())
+				return true; // nowhere to write to
+		}
+		written = true;
+	}
+	return true;
+}
+
+Xtray *NexusWriter::splitPart(Xtray *xt, int p, bool all)
+{
+	if (!all && !hasData_[p])
+		return NULL;
+
+	Xtray *pxt = new Xtray(xt->getType());
+	int sz = xt->size();
+	for (int i = 0; i < sz; i++) {
+		if (dest_[i] == p || dest_[i] == DEST_ANY)
+			pxt->push_back(xt->at(i));
+	}
+	return pxt;
+}
+
+NexusPartition::NexusPartition(int nlabels, int beginIdx, int endIdx):
+	keys_(nlabels),
+	beginIdx_(beginIdx),
+	endIdx_(endIdx)
+{ }
+
+Hash::Value NexusPartition::hash(const RowType *rt, int idx, const Row *row) const
+{
+	Hash::Value hash = Hash::basis_;
+
+	const FieldVec &key = keys_[idx];
+	for (FieldVec::const_iterator it = key.begin(); it != key.end(); ++it) {
+		const char *v;
+		intptr_t len;
+
+		rt->getField(row, *it, v, len);
+		hash = Hash::append(hash, v, len);
+	}
+	return hash;
+}
+
 }; // TRICEPS_NS
 
@@ -13,6 +13,7 @@
 #include <common/Common.h>
 #include <pw/ptwrap2.h>
 #include <mem/Atomic.h>
+#include <common/Hash.h>
 #include <app/Xtray.h>
 
 namespace TRICEPS_NS {
@@ -90,6 +91,12 @@ class QueEvent: public Mtarget
 { 
 	friend class Triead;
 public:
+	// After the spinning, the number of times to yield the CPU
+	// before going to sleep.
+	enum {
+		SPIN_YIELDS = 8,
+	};
+
 	// No drain is requested by default, nor signaled either.
 	// @param drain - the App drain status, to propagate the state of this
 	//        event
@@ -103,6 +110,23 @@ public:
 	// if the event is found undrained.
 	void requestDrain();
 
+	// Set the adaptive waiting: before going to sleep, wait()
+	// and timedwait() will spin checking for the signal for this many
+	// iterations, and then yield the CPU up to SPIN_YIELDS times.
+	// This avoids the cost of going to sleep and waking up when the
+	// signal comes soon after the wait starts. The spinning stops early
+	// if a drain gets requested, since the drain relies on the thread
+	// being asleep.
+	// @param spin - the number of the spin iterations, 0 disables the spinning
+	void setSpin(int spin)
+	{
+		spin_ = spin;
+	}
+	int getSpin() const
+	{
+		return spin_;
+	}
+
 	// The request from App to stop the drain notification.
 	// The drain_ will be left in whatever state it happens to be.
 	void requestUndrain()
@@ -155,21 +179,32 @@ public:
 	// "all drained" notifications while there still is data to process.
 	void wait()
 	{
+		spinWait();
 		pw::lockmutex lm(cond_);
 		waitL();
 	}
 	void waitL()
 	{
-		evsleeper_ = true;
-		while (!signaled_) {
+		// the sleeper flag and the signal go in the opposite order
+		// to the signal() fast path
+		__atomic_store_n(&evsleeper_, true, __ATOMIC_SEQ_CST);
+		while (!__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST)) {
 			if (rqDrain_ && !drained_) {
 				drained_ = true;
 				drain_->drainedOne();
 			}
 			cond_.wait();
 		}
-		evsleeper_ = false;
-		signaled_ = false;
+		endWaitL();
+	}
+	// Consume the signal and end the wait. The signal gets reset
+	// before the sleeper flag: a signal() that comes in between sees
+	// the sleeper, goes through the mutex and sets the flag again
+	// after this, so it doesn't get lost.
+	void endWaitL()
+	{
+		__atomic_store_n(&signaled_, false, __ATOMIC_SEQ_CST);
+		__atomic_store_n(&evsleeper_, false, __ATOMIC_SEQ_CST);
 	}
 	int trywait()
 	{
@@ -178,9 +213,9 @@ public:
 	}
 	int trywaitL()
 	{
-		if (!signaled_)
+		if (!__atomic_load_n(&signaled_, __ATOMIC_SEQ_CST))
 			return ETIMEDOUT;
-		signaled_ = false;
+		__atomic_store_n(&signaled_, false, __ATOMIC_SEQ_CST);
 		return 0;
 	}
 
@@ -189,23 +224,33 @@ public:
 	// new data becomes available.
 	int timedwait(const struct timespec &abstime)
 	{
+		spinWait();
 		pw::lockmutex lm(cond_);
 		return timedwaitL(abstime);
 	}
 	int timedwaitL(const struct timespec &abstime);
 	void signal()
 	{
+		// The fast path: when nobody sleeps and no drain is requested,
+		// setting the flag is enough. The sleeper sets its flag before
+		// checking the signal, so at least one side sees the other.
+		__atomic_store_n(&signaled_, true, __ATOMIC_SEQ_CST);
+		if (!__atomic_load_n(&evsleeper_, __ATOMIC_SEQ_CST)
+		&& !__atomic_load_n(&rqDrain_, __ATOMIC_SEQ_CST))
+			return;
+
 		pw::lockmutex lm(cond_);
 		signalL();
 	}
 	void signalL()
 	{
-		signaled_ = true;
+		__atomic_store_n(&signaled_, true, __ATOMIC_SEQ_CST);
 		if (rqDrain_ && drained_) {
 			drained_ = false;
 			drain_->undrainedOne();
 		}
-		cond_.signal();
+		if (evsleeper_)
+			cond_.signal();
 	}
 	void reset()
 	{
@@ -214,11 +259,11 @@ public:
 	}
 	void resetL()
 	{
-		signaled_ = false;
+		__atomic_store_n(&signaled_, false, __ATOMIC_SEQ_CST);
 	}
 	bool read()
 	{
-		return signaled_;
+		return __atomic_load_n(&signaled_, __ATOMIC_SEQ_CST);
 	}
 	pw::pmutex &mutex()
 	{
@@ -241,7 +286,7 @@ public:
 	{
 		// fudges the flags sufficiently to let the requestDrain/Undrain
 		// logic work unchanged from the normal (read) mode
-		evsleeper_ = on;
+		__atomic_store_n(&evsleeper_, on, __ATOMIC_SEQ_CST);
 	}
 	// The thread must call this before it writes to any facet.
 	// It will sleep if the drain is requested, until the end of
@@ -253,41 +298,80 @@ public:
 	//
 	// @return - true if cleared to write, false if the thread
 	//         was requested to die
+	//
+	// If the thread holds some data (see holdWrite()), it's not
+	// drained yet, so it doesn't sleep but goes ahead to write
+	// that data.
 	bool beforeWrite()
 	{
 		pw::lockmutex lm(cond_);
 		if (dead_)
 			return false;
-		while (rqDrain_) {
+		while (rqDrain_ && held_ == 0) {
 			cond_.wait();
 			if (dead_)
 				return false;
 		}
-		signaled_ = true; // marks as undrained for requestDrain()
-		// drained_ does not matter here
+		__atomic_store_n(&signaled_, true, __ATOMIC_SEQ_CST); // marks as undrained for requestDrain()
 		return true;
 	}
 	// The thread must call this after it writes to any facet.
 	// If a drain was requested in the meantime, this will mark
-	// the thread as drained.
+	// the thread as drained, unless it still holds some data.
 	void afterWrite()
 	{
 		pw::lockmutex lm(cond_);
-		signaled_ = false; // mark as drained for requestDrain()
-		// drained_ does not matter here
-		if (rqDrain_)
+		if (held_ != 0)
+			return; // still undrained
+		__atomic_store_n(&signaled_, false, __ATOMIC_SEQ_CST); // mark as drained for requestDrain()
+		if (rqDrain_ && !drained_) {
+			drained_ = true;
 			drain_->drainedOne();
+		}
+	}
+
+	// An input-only thread calls this when a coalescing facet
+	// starts keeping the complete transactions instead of writing
+	// them out. The thread stays undrained until all the holds
+	// get released, so that a drain can not complete while
+	// the data is not written yet.
+	//
+	// @return - true if the hold is granted, false if a drain
+	//         is requested or the thread is dead (then the data
+	//         must be flushed or discarded right away)
+	bool holdWrite()
+	{
+		pw::lockmutex lm(cond_);
+		if (dead_ || rqDrain_)
+			return false;
+		if (held_++ == 0)
+			__atomic_store_n(&signaled_, true, __ATOMIC_SEQ_CST); // marks as undrained for requestDrain()
+		return true;
+	}
+	// Release a hold when the held data gets written or discarded.
+	// Must be called between beforeWrite() and afterWrite(),
+	// and the afterWrite() will then do the drain notification.
+	// Or when the thread is dead, when the drain doesn't matter.
+	void releaseHold()
+	{
+		pw::lockmutex lm(cond_);
+		--held_;
 	}
 
 	// Check if a drain is currently requested.
 	// It allows the thread code to stop generating the data
 	// out of nowhere when the drain is requested.
-	bool isRqDrain()
+	bool isRqDrain() const
 	{
-		return rqDrain_;
+		return __atomic_load_n(&rqDrain_, __ATOMIC_SEQ_CST);
 	}
 
 protected:
+	// Spin for a while waiting for the signal before going to
+	// sleep in wait() or timedwait(), see setSpin(). Doesn't consume
+	// the signal, this is left to the following real wait.
+	void spinWait();
+
 	// The thread is considered drained when it sits and waits
 	// for more input on the QueEvent. If it gets more input, it
 	// becomes undrained untill all that input is processed.
@@ -302,6 +386,77 @@ protected:
 	pw::pmcond cond_; // contains both condition variable and a mutex
 	bool signaled_; // flag: semaphore has been signaled
 	bool evsleeper_; // flag: there is a sleep in progress
+	int held_; // in the write mode, the number of facets holding the coalesced data
+
+	int spin_; // the number of spin iterations before sleeping
+};
+
+// The ring buffer of Xtrays for the lock-free mode of the ReaderQueue.
+//
+// Each slot has the sequential id of the Xtray placed into it.
+// A writer that owns an id (the ids are issued by the first reader
+// of the nexus, and the space for them is checked against the queue
+// limit) places the Xtray into the slot and then publishes it by
+// storing the id. The reader takes the Xtrays in the order of ids, and
+// stops at the first id that is not published yet. This naturally
+// handles the "holes" in the queue, when the multiple writers complete
+// their writes out of order.
+//
+// The slot ownership is passed by the ids alone: the slot for an id
+// is free only after the reader has taken the previous Xtray that used
+// this slot, and the caller is responsible for checking that.
+class XtrayRing
+{
+public:
+	// @param limit - the queue size limit, the number of slots will be
+	//        rounded up from it to a power of 2
+	XtrayRing(Xtray::QueId limit);
+	~XtrayRing();
+
+	// Place an Xtray into its slot and publish it.
+	// @param xt - Xtray being written
+	// @param id - its sequential id
+	void put(Xtray *xt, Xtray::QueId id)
+	{
+		Slot &s = slots_[id & mask_];
+		s.xt_ = xt;
+		__atomic_store_n(&s.id_, id, __ATOMIC_SEQ_CST);
+	}
+
+	// Check whether an id has been published.
+	// @param id - the sequential id
+	bool ready(Xtray::QueId id) const
+	{
+		return (__atomic_load_n(&slots_[id & mask_].id_, __ATOMIC_SEQ_CST) == id);
+	}
+
+	// Take the Xtray from the slot if it's published, freeing the slot.
+	// @param id - the sequential id
+	// @param xt - place to return the Xtray
+	// @return - true if the id has been published and the Xtray returned
+	bool take(Xtray::QueId id, Autoref<Xtray> &xt)
+	{
+		Slot &s = slots_[id & mask_];
+		if (__atomic_load_n(&s.id_, __ATOMIC_SEQ_CST) != id)
+			return false;
+		xt.swap(s.xt_); // the slot is left empty
+		s.id_ = id + 1; // never matches any id that goes into this slot
+		return true;
+	}
+
+protected:
+	struct Slot {
+		Autoref<Xtray> xt_;
+		Xtray::QueId id_; // the id of the published Xtray
+	};
+
+	Slot *slots_;
+	Xtray::QueId mask_; // the number of slots minus 1
+
+private:
+	XtrayRing();
+	XtrayRing(const XtrayRing &);
+	void operator=(const XtrayRing &);
 };
 
 // The queue of one reader facet.
@@ -311,9 +466,19 @@ class ReaderQueue: public Mtarget
 public:
 	typedef deque<Autoref<Xtray> > Xdeque;
 
+	// The largest queue limit for which the ring mode is used. The larger
+	// queues (such as the ones of the reverse nexuses) fall back to
+	// the normal mode.
+	static const Xtray::QueId RING_LIMIT_MAX = 64*1024;
+
 	// @param qev - the thread's notification event
 	// @param limit - high watermark limit for the queue
-	ReaderQueue(QueEvent *qev, Xtray::QueId limit);
+	// @param ring - flag: use the lock-free ring buffer instead of the
+	//        double-buffered deques; the writers and the reader then
+	//        synchronize through the atomic operations, and the mutex is
+	//        used only to sleep when the queue is full
+	ReaderQueue(QueEvent *qev, Xtray::QueId limit, bool ring = false);
+	~ReaderQueue();
 
 	// Write an Xtray to the first reader in the vector.
 	// This generates the sequential id for the Xtray.
@@ -372,7 +537,63 @@ public:
 		return dead_;
 	}
 
+	// Get the approximate number of Xtrays in the write side of the queue.
+	// It's read without locking, so it may be slightly out of date, which
+	// is good enough for the load balancing.
+	Xtray::QueId depth() const
+	{
+		if (ring_ != NULL)
+			return ticketId(__atomic_load_n(&ticket_, __ATOMIC_RELAXED))
+				- __atomic_load_n(&prevId_, __ATOMIC_RELAXED);
+		return lastId_ - prevId_;
+	}
+
+	// Check if the queue works in the ring buffer mode.
+	bool isRing() const
+	{
+		return ring_ != NULL;
+	}
+
 protected:
+	// In the ring mode the generation and the last id of the first
+	// reader get changed together atomically, packed into one value.
+	static uint64_t mkTicket(int gen, Xtray::QueId id)
+	{
+		return ((uint64_t)(uint32_t)gen << 32) | (uint32_t)id;
+	}
+	static int ticketGen(uint64_t t)
+	{
+		return (int)(uint32_t)(t >> 32);
+	}
+	static Xtray::QueId ticketId(uint64_t t)
+	{
+		return (Xtray::QueId)(uint32_t)t;
+	}
+
+	// Change a part of the ticket in the ring mode. Since the writers
+	// may be changing the id concurrently, it's done in a CAS loop.
+	// The caller should lock the mutex_.
+	// @param gen - the new generation, or -1 to keep the current one
+	// @param id - the new last id (used only if setId is true)
+	// @param setId - flag: replace the last id
+	void changeTicketL(int gen, Xtray::QueId id, bool setId);
+
+	// The implementations of writeFirst(), write() and refill()
+	// for the ring mode.
+	bool writeFirstRing(int gen, Xtray *xt, Xtray::QueId &trayId);
+	void writeRing(Xtray *xt, Xtray::QueId trayId);
+	bool refillRing();
+
+	// Place an Xtray into the ring and notify the reader if this
+	// Xtray is at the front of the queue.
+	void putRing(Xtray *xt, Xtray::QueId trayId);
+
+	// In the ring mode, sleep until there is space in the queue for the id.
+	// @param trayId - the id to write
+	// @param gen - if >= 0, also stop waiting if the generation changes
+	// @return - true if there is space, false if the queue became dead
+	//        or the generation changed
+	bool waitRingSpace(Xtray::QueId trayId, int gen);
 
 	Xdeque &writeq()
 	{
@@ -393,6 +614,27 @@ protected:
 	void setGenL(int gen)
 	{
 		gen_ = gen;
+		if (ring_ != NULL)
+			changeTicketL(gen, 0, false);
+	}
+
+	// Get the id of the last Xtray issued by this reader when it
+	// was the first one.
+	// The caller should lock the mutex_.
+	Xtray::QueId getLastIdL() const
+	{
+		if (ring_ != NULL)
+			return ticketId(__atomic_load_n(&ticket_, __ATOMIC_SEQ_CST));
+		return lastId_;
+	}
+
+	// Set the initial position of a new reader.
+	// The caller should have this reader not accessible to writers yet.
+	void initIdL(Xtray::QueId id)
+	{
+		prevId_ = lastId_ = id;
+		if (ring_ != NULL)
+			changeTicketL(-1, id, true);
 	}
 
 	// Update the lastId_, so that it's consistent across all the readers.
@@ -445,6 +687,13 @@ protected:
 	bool wrReady_; // there is new data in the writer queue
 	pw::pmcond condfull_; // wait when the queue is full, also contains the mutex
 
+	// the ring mode, when ring_ is not NULL, uses instead of q_[rq_ ^ 1],
+	// gen_ and lastId_ (the last two are still updated but not used for
+	// the synchronization); prevId_ is then updated atomically
+	XtrayRing *ring_; // the ring buffer of the write side
+	uint64_t ticket_; // the generation and last id, see mkTicket()
+	int wrWaiting_; // the number of writers waiting for space, changed atomically
+
 private:
 	ReaderQueue();
 	ReaderQueue(const ReaderQueue &);
@@ -494,10 +743,75 @@ private:
 	void operator=(const ReaderVec &);
 };
 
+// The partitioning of a nexus by the key fields. Each row of a type that
+// has a key goes only to the reader that owns the partition of this key,
+// found by the hash of the key fields. The rows of the types without a key
+// go to every reader, and the _BEGIN_ and _END_ rows go to the readers
+// that receive any other data from the same Xtray.
+//
+// It contains only the field indexes, not the types, so that it can be
+// shared between the threads, and the row types get taken from the Xtrays.
+// Like other shared objects, it's all-writes-before-sharing.
+class NexusPartition: public Mtarget
+{
+public:
+	typedef vector<int> FieldVec;
+
+	// @param nlabels - the number of labels (row types) in the nexus
+	// @param beginIdx - index of the _BEGIN_ label
+	// @param endIdx - index of the _END_ label
+	NexusPartition(int nlabels, int beginIdx, int endIdx);
+
+	// Set the key of a row type.
+	// @param idx - index of the row type in the nexus type
+	// @param fields - indexes of the key fields in the row type, must not be empty
+	void setKey(int idx, const FieldVec &fields)
+	{
+		keys_[idx] = fields;
+	}
+
+	// Check whether a row type has a key.
+	// @param idx - index of the row type in the nexus type
+	bool hasKey(int idx) const
+	{
+		return (idx >= 0 && idx < (int)keys_.size() && !keys_[idx].empty());
+	}
+
+	// Check whether the index refers to the transaction framing
+	// (_BEGIN_, _END_ or a transaction boundary).
+	bool isFraming(int idx) const
+	{
+		return (idx < 0 || idx == beginIdx_ || idx == endIdx_);
+	}
+
+	// Compute the hash of a row's key.
+	// @param rt - type of the row
+	// @param idx - index of the row type in the nexus type, must have a key
+	// @param row - the row
+	// @return - the hash value
+	Hash::Value hash(const RowType *rt, int idx, const Row *row) const;
+
+protected:
+	vector<FieldVec> keys_; // the key fields for each row type, empty if no key
+	int beginIdx_; // index of the _BEGIN_ label
+	int endIdx_; // index of the _END_ label
+
+private:
+	NexusPartition();
+	NexusPartition(const NexusPartition &);
+	void operator=(const NexusPartition &);
+};
+
 class NexusWriter: public Mtarget
 {
 public:
-	NexusWriter()
+	// @param unicast - flag: each Xtray goes to only one reader
+	// @param part - the partitioning of the nexus, or NULL if not
+	//        partitioned; the partitioned nexus must also be unicast
+	NexusWriter(bool unicast = false, NexusPartition *part = NULL):
+		part_(part),
+		rrIdx_(0),
+		unicast_(unicast)
 	{ }
 
 	// Update the new reader vector (readersNew_).
@@ -515,7 +829,40 @@ public:
 	void write(Xtray *xt);
 
 protected:
+	// Pick the reader for the unicast write: the one with the shortest
+	// queue, starting the search from the round-robin position.
+	// The vector must not be empty.
+	// @return - index of the reader in readers_
+	int pickUnicast();
+
+	// Split the Xtray by the partitions and write the parts to
+	// their readers. The reader vector must not be empty.
+	// @param xt - the data
+	// @return - false if the readers have changed before anything got
+	//         written, and the caller has to pick up the new readers and retry
+	bool writePartitioned(Xtray *xt);
+
+	// Build the part of an Xtray for one partition.
+	// @param xt - the original data
+	// @param p - the partition
+	// @param all - flag: the Xtray has the rows without a key besides the
+	//        framing, or no keyed rows at all, so every partition gets a part
+	// @return - the part, or NULL if this partition gets nothing
+	Xtray *splitPart(Xtray *xt, int p, bool all);
+
+	enum {
+		// the value in dest_ for the rows without a key: they go to
+		// every partition that gets a part of the Xtray
+		DEST_ANY = -1,
+	};
+
 	Autoref<ReaderVec> readers_; // the current active reader vector
+	Autoref<NexusPartition> part_; // the partitioning, or NULL
+	vector<int> dest_; // the partition of each op in the Xtray being written,
+		// with the special values for the rows that go to multiple partitions
+	vector<bool> hasData_; // whether each partition has any data besides the framing
+	int rrIdx_; // the round-robin position for the unicast
+	bool unicast_; // flag: each Xtray goes to only one reader
 
 	pw::pmutex mutexNew_; // protects the readersNew_
 	Autoref<ReaderVec> readersNew_; // the new reader vector
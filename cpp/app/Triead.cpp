@@ -251,6 +251,58 @@ bool Triead::flushWriters()
 	return true;
 }
 
+bool Triead::flushWritersDue()
+{
+	if (!appReady_) {
+		throw Exception::fTrace("Can not flush the thread '%s' before waiting for App readiness.",
+			name_.c_str());
+	}
+
+	// check first that there is anything to flush, to not touch
+	// the drain state of an input-only thread otherwise
+	int64_t now = 0;
+	Triead::FacetPtrVec::iterator it = writers_.begin();
+	Triead::FacetPtrVec::iterator end = writers_.end();
+	for (; it != end; ++it) {
+		if ((*it)->isFlushDue(now))
+			break;
+	}
+	if (it == end)
+		return true;
+
+	if (inputOnly_) {
+		if (!qev_->beforeWrite()) {
+			for (it = writers_.begin(); it != end; ++it)
+				(*it)->discardXtray();
+			return false;
+		}
+	}
+
+	// the same time keeps the same decisions
+	for (; it != end; ++it) {
+		if ((*it)->isFlushDue(now))
+			(*it)->flushWriterD();
+	}
+
+	if (inputOnly_)
+		qev_->afterWrite();
+	return true;
+}
+
+int64_t Triead::flushDueUs() const
+{
+	int64_t now = 0;
+	int64_t res = -1;
+	Triead::FacetPtrVec::const_iterator it = writers_.begin();
+	Triead::FacetPtrVec::const_iterator end = writers_.end();
+	for (; it != end; ++it) {
+		int64_t left = (*it)->flushDueUs(now);
+		if (left >= 0 && (res < 0 || left < res))
+			res = left;
+	}
+	return res;
+}
+
 #if 0 // {
 int Triead::exportsCount() const
 {
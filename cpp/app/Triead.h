@@ -200,8 +200,25 @@ protected:
 	//         the false generally means that the thread needs to exit
 	bool flushWriters();
 
+	// The version of flushWriters() that lets the coalescing writers
+	// keep collecting their transactions until their delay limit
+	// expires (see Facet::setCoalesce()). Everything else gets flushed.
+	// Used by TrieadOwner after processing each incoming Xtray, and
+	// by the input-only threads that wait for their input by themselves.
+	//
+	// @return - same as flushWriters()
+	bool flushWritersDue();
+
+	// Find when flushWritersDue() will have to flush a coalescing writer
+	// by the delay limit.
+	//
+	// @return - the time left in microseconds (0 if already expired),
+	//         or -1 if no writer has a delay limit pending
+	int64_t flushDueUs() const;
+
 	// }
 protected:
+
 	// The initialization is done in two stages:
 	// 1. Construction: the thread defines its own nexuses and locates
 	// the nexuses of other threads (in any order), performs connections
@@ -198,11 +198,12 @@ bool TrieadOwner::nextXtray(bool wait, const struct timespec &abstime)
 				rhi.popread();
 				if (filled)
 					triead_->qev_->reset();
-				flushWriters();
+				triead_->flushWritersDue();
 				return true;
 			}
 		} else if (triead_->readersLo_.empty()) {
 			// no more readers of either priority
+			flushWriters(); // whatever the coalescing writers have collected
 			return false;
 		}
 
@@ -220,10 +221,14 @@ bool TrieadOwner::nextXtray(bool wait, const struct timespec &abstime)
 			rlo.popread();
 			if (filled)
 				triead_->qev_->reset();
-			flushWriters();
+			triead_->flushWritersDue();
 			return true;
 		}
 
+		// The input has run dry, so send whatever the coalescing
+		// writers have collected, before waiting for more.
+		flushWriters();
+
 		// This code is optimized for the case when the data comes
 		// in faster than it can be handled, so in case if there is
 		// little data, it may do two passes, consuming the signal
@@ -264,47 +269,66 @@ void TrieadOwner::mainLoop()
 
 void TrieadOwner::processXtray(Xtray *xt, Facet *facet)
 {
-	if (xt->empty()) // should never happen
-		return;
-
 	int sz = xt->size();
 	FnReturn *fret = facet->getFnReturn();
+	int beginIdx = facet->beginIdx();
+	int endIdx = facet->endIdx();
+
+	// A coalescing writer may pack multiple transactions into one
+	// Xtray, separated by the boundary ops with idx -1. Each of them
+	// is processed as if it came in a separate Xtray.
+	for (int start = 0; start < sz; ) {
+		int end = start;
+		while (end < sz && xt->at(end).idx_ >= 0)
+			++end;
+		if (end == start) { // an empty segment
+			++start;
+			continue;
+		}
 
-	{
-		int beginIdx = facet->beginIdx();
-		if (xt->frontIdx() != beginIdx) {
+		if (xt->at(start).idx_ != beginIdx) {
 			Label *beginLabel = fret->checkLabelChained(beginIdx);
 			if (beginLabel != NULL) {
 				// generate a synthetic _BEGIN_
-				FdataVec fd;
-				mainUnit_->call(new Rowop(
-					beginLabel, Rowop::OP_INSERT, beginLabel->getType()->makeRow(fd)));
-				drainUnits();
+				if (facet->beginRow_.isNull()) {
+					FdataVec fd;
+					facet->beginRow_ = Rowref(beginLabel->getType(), fd);
+				}
+				callXtrayOp(beginLabel, Rowop::OP_INSERT, facet->beginRow_.get());
 			}
 		}
-	}
-	for (int i = 0; i < sz; i++) {
-		const Xtray::Op &op = xt->at(i);
-		mainUnit_->call(new Rowop(
-			fret->getLabel(op.idx_), op.opcode_, op.row_));
-		drainUnits();
-	}
-
-	{
-		int endIdx = facet->endIdx();
-		if (xt->backIdx() != endIdx) {
+		for (int i = start; i < end; i++) {
+			const Xtray::Op &op = xt->at(i);
+			callXtrayOp(fret->getLabel(op.idx_), op.opcode_, op.row_);
+		}
+		if (xt->at(end-1).idx_ != endIdx) {
 			Label *endLabel = fret->checkLabelChained(endIdx);
 			if (endLabel != NULL) {
 				// generate a synthetic _END_
-				FdataVec fd;
-				mainUnit_->call(new Rowop(
-					endLabel, Rowop::OP_INSERT, endLabel->getType()->makeRow(fd)));
-				drainUnits();
+				if (facet->endRow_.isNull()) {
+					FdataVec fd;
+					facet->endRow_ = Rowref(endLabel->getType(), fd);
+				}
+				callXtrayOp(endLabel, Rowop::OP_INSERT, facet->endRow_.get());
 			}
 		}
+
+		start = end + 1;
 	}
 }
 
+void TrieadOwner::callXtrayOp(const Label *label, Rowop::Opcode op, const Row *row)
+{
+	// If the previous rowop is still referenced from somewhere (such as
+	// saved by the user code), it can't be reused.
+	if (spareRop_.isNull() || spareRop_->getref() != 1)
+		spareRop_ = new Rowop(label, op, row);
+	else
+		spareRop_->reuse(label, op, row);
+	mainUnit_->call(spareRop_);
+	drainUnits();
+}
+
 void TrieadOwner::drainUnits()
 {
 	// an optimization for the frequent case
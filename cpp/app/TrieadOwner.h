@@ -92,14 +92,19 @@ protected:
 			return this;
 		}
 
-#if 0  // {
 		NexusMaker *setUnicast(bool on = true)
 		{
 			mkfacet();
 			facet_->setUnicast(on);
 			return this;
 		}
-#endif // }
+
+		NexusMaker *setPartitionKey(const string &label, Onceref<NameSet> key)
+		{
+			mkfacet();
+			facet_->setPartitionKey(label, key);
+			return this;
+		}
 
 		NexusMaker *setQueueLimit(int limit)
 		{
@@ -108,6 +113,13 @@ protected:
 			return this;
 		}
 
+		NexusMaker *setQueueRing(bool on = true)
+		{
+			mkfacet();
+			facet_->setQueueRing(on);
+			return this;
+		}
+
 		// Actually exports the facet and returns it.
 		// After that the object doesn't have an FnReturn not a Facet in it.
 		Autoref<Facet> complete();
@@ -252,6 +264,10 @@ public:
 	// This also deletes the references to the units, including the
 	// main unit.
 	//
+	// It doesn't flush the writer facets: whatever data is still
+	// collected in them (such as the transactions kept by coalescing)
+	// gets discarded. Call flushWriters() before it to send that data.
+	//
 	// If the thread was not ready before, it will be marked
 	// ready now, and if it was the last one to become ready,
 	// that will trigger the loop check in the App. However
@@ -424,6 +440,36 @@ public:
 		return triead_->flushWriters();
 	}
 
+	// Send the collected Xtrays on the writer facets, except for the
+	// coalescing writers that may keep collecting the transactions
+	// until their delay limit expires (see Facet::setCoalesce()).
+	//
+	// The threads with readers do this automatically in nextXtray().
+	// An input-only thread that uses the coalescing with a delay limit
+	// has to call it by itself when the delay expires, since it waits
+	// for the input outside of Triceps. The time to wait can be found
+	// with flushDueUs().
+	//
+	// Throws an Exception if the thread has not completed yet
+	// the wait for App readiness readyReady().
+	//
+	// @return - same as flushWriters()
+	bool flushWritersDue()
+	{
+		return triead_->flushWritersDue();
+	}
+
+	// Find when flushWritersDue() will have to flush a coalescing writer
+	// by its delay limit.
+	//
+	// @return - the time left in microseconds (0 if already expired),
+	//         or -1 if no writer has a delay limit pending, so there
+	//         is no need to wake up for it
+	int64_t flushDueUs() const
+	{
+		return triead_->flushDueUs();
+	}
+
 	// Get the next Xtray from the read facets (sleep if needed),
 	// process it and send through the write facets.
 	// If requested to wait, will wait for more input, unless all the
@@ -465,6 +511,22 @@ public:
 	// the thread as dead.
 	void mainLoop();
 
+	// Set the adaptive waiting for the input in nextXtray(): when the
+	// queues run dry, spin for a while checking for more data, then
+	// yield the CPU a few times, and only then go to sleep. This reduces
+	// the latency when the data keeps arriving in small bursts, at the
+	// cost of burning more CPU. By default there is no spinning.
+	// @param spin - the number of the spin iterations, 0 disables the spinning
+	void setQueueSpin(int spin)
+	{
+		triead_->qev_->setSpin(spin);
+	}
+	// Get the number of the spin iterations.
+	int getQueueSpin() const
+	{
+		return triead_->qev_->getSpin();
+	}
+
 	// Check if the drain is currently requested.
 	// It allows the thread code to stop generating the data
 	// out of nowhere when the drain is requested.
@@ -537,6 +599,13 @@ protected:
 	// May propagate an Exception.
 	void processXtray(Xtray *xt, Facet *facet);
 
+	// Call a rowop coming from an Xtray in the main unit and drain
+	// the units after it. The rowop object is reused between the calls
+	// if nobody else has kept a reference to it.
+	//
+	// May propagate an Exception.
+	void callXtrayOp(const Label *label, Rowop::Opcode op, const Row *row);
+
 	// Drain any scheduled rowops from all the units. Done after
 	// executing every rowop from Xtray.
 	void drainUnits();
@@ -555,6 +624,7 @@ protected:
 	NexusMaker nexusMaker_; // helper for convenient nexus making
 	bool appReady_; // waited for App to be ready, permits the processing
 	bool busy_; // flag: processing an Xtray
+	Autoref<Rowop> spareRop_; // the rowop reused by callXtrayOp()
 
 private:
 	TrieadOwner();
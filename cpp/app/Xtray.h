@@ -96,6 +96,12 @@ public:
 		return ops_[idx];
 	}
 
+	// Get the type of the nexus.
+	RowSetType *getType() const
+	{
+		return type_;
+	}
+
 	// Get the idx of the first Op in the Xtray.
 	// May not be used if the Xtray is empty.
 	int frontIdx() const
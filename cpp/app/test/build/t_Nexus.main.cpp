@@ -0,0 +1,46 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase make_facet;
+	driver.addcase(make_facet, "make_facet");
+
+	extern Utest::Testcase export_import;
+	driver.addcase(export_import, "export_import");
+
+	extern Utest::Testcase mknexus;
+	driver.addcase(mknexus, "mknexus");
+
+	extern Utest::Testcase import_queues;
+	driver.addcase(import_queues, "import_queues");
+
+	extern Utest::Testcase queue_fill;
+	driver.addcase(queue_fill, "queue_fill");
+
+	extern Utest::Testcase queue_ring;
+	driver.addcase(queue_ring, "queue_ring");
+
+	extern Utest::Testcase dynamic_add_del;
+	driver.addcase(dynamic_add_del, "dynamic_add_del");
+
+	extern Utest::Testcase pass_data;
+	driver.addcase(pass_data, "pass_data");
+
+	extern Utest::Testcase pass_begin_end;
+	driver.addcase(pass_begin_end, "pass_begin_end");
+
+	extern Utest::Testcase pass_unicast;
+	driver.addcase(pass_unicast, "pass_unicast");
+
+	extern Utest::Testcase pass_partition;
+	driver.addcase(pass_partition, "pass_partition");
+
+	extern Utest::Testcase pass_coalesce;
+	driver.addcase(pass_coalesce, "pass_coalesce");
+
+	return driver.run();
+}
@@ -0,0 +1,22 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase drain_reader;
+	driver.addcase(drain_reader, "drain_reader");
+
+	extern Utest::Testcase drain_writer;
+	driver.addcase(drain_writer, "drain_writer");
+
+	extern Utest::Testcase spin_wait;
+	driver.addcase(spin_wait, "spin_wait");
+
+	extern Utest::Testcase signal_race;
+	driver.addcase(signal_race, "signal_race");
+
+	return driver.run();
+}
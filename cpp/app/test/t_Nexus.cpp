@@ -7,6 +7,7 @@
 // Test of the nexus-related calls in App and Trieads.
 
 #include <assert.h>
+#include <unistd.h>
 #include <utest/Utest.h>
 #include <type/AllTypes.h>
 #include "AppTest.h"
@@ -58,21 +59,17 @@ UTESTCASE make_facet(Utest *utest)
 	Autoref<Facet> fa2 = Facet::make(fret1, true); // writer
 	UT_ASSERT(fa2->isWriter());
 
-#if 0  // {
 	UT_ASSERT(!fa2->isUnicast());
 	fa2->setUnicast();
 	UT_ASSERT(fa2->isUnicast());
-#endif // }
 
 	UT_ASSERT(!fa2->isReverse());
 	fa2->setReverse();
 	UT_ASSERT(fa2->isReverse());
 
-#if 0  // {
 	UT_ASSERT(fa2->isUnicast());
 	fa2->setUnicast(false);
 	UT_ASSERT(!fa2->isUnicast());
-#endif // }
 
 	UT_ASSERT(fa2->isReverse());
 	fa2->setReverse(false);
@@ -344,7 +341,6 @@ UTESTCASE make_facet(Utest *utest)
 		}
 		UT_IS(msg, "Can not modify an imported facet 't1/fret1'.\n");
 	}
-#if 0  // {
 	{
 		string msg;
 		try {
@@ -354,7 +350,6 @@ UTESTCASE make_facet(Utest *utest)
 		}
 		UT_IS(msg, "Can not modify an imported facet 't1/fret1'.\n");
 	}
-#endif // }
 	{
 		string msg;
 		try {
@@ -807,10 +802,8 @@ UTESTCASE mknexus(Utest *utest)
 			->addLabel("one", rt1)
 			->addFromLabel("two", lb1)
 			->setContext(ctx1)
-#if 0  // {
 			->setUnicast()
 			->setUnicast(true)
-#endif // }
 			->setReverse()
 			->setReverse(true)
 			->setQueueLimit(3)
@@ -818,9 +811,7 @@ UTESTCASE mknexus(Utest *utest)
 
 		UT_ASSERT(fa1->isImported());
 		UT_ASSERT(fa1->isWriter());
-#if 0  // {
 		UT_ASSERT(fa1->isUnicast());
-#endif // }
 		UT_ASSERT(fa1->isReverse());
 		UT_IS(fa1->queueLimit(), Xtray::QUE_ID_MAX); // auto-set for reverse
 		UT_IS(fa1->getShortName(), "nx1");
@@ -1344,6 +1335,155 @@ UTESTCASE queue_fill(Utest *utest)
 	UT_IS(ReaderQueueGuts::lastId(q), 13);
 }
 
+class RingWriteT: public Mtarget, public pw::pwthread
+{
+public:
+	// will write this xtray to this queue at the ids
+	// first, first+step, ... up to the limit
+	RingWriteT(ReaderQueue *q, Autoref<Xtray> xt, Xtray::QueId first, 
+			Xtray::QueId step, Xtray::QueId limit):
+		q_(q),
+		xt_(xt),
+		first_(first),
+		step_(step),
+		limit_(limit)
+	{ }
+
+	virtual void *execute()
+	{
+		for (Xtray::QueId id = first_; id <= limit_; id += step_)
+			q_->write(xt_, id);
+		return NULL;
+	}
+
+	Autoref<ReaderQueue> q_;
+	Autoref<Xtray> xt_;
+	Xtray::QueId first_;
+	Xtray::QueId step_;
+	Xtray::QueId limit_;
+};
+
+// the ring mode of ReaderQueue
+UTESTCASE queue_ring(Utest *utest)
+{
+	Autoref<QueEvent> qev = new QueEvent(NULL);
+	Autoref<ReaderQueue> q = new ReaderQueue(qev, 5, true);
+	Autoref<Xtray> xt = new Xtray(NULL); // this is an abuse but good enough here
+	Autoref<Xtray> xt2 = new Xtray(NULL);
+	Xtray::QueId id;
+
+	UT_ASSERT(q->isRing());
+	UT_IS(ReaderQueueGuts::prevId(q), 0);
+	UT_ASSERT(!QueEventGuts::isSignaled(qev));
+
+	// the large queues don't use the ring
+	{
+		Autoref<ReaderQueue> q2 = new ReaderQueue(qev, ReaderQueue::RING_LIMIT_MAX + 1, true);
+		UT_ASSERT(!q2->isRing());
+	}
+
+	// ----------------------------------------------------------------------
+
+	// refilling from an empty ring does nothing
+	UT_ASSERT(!q->refill());
+	UT_IS(q->frontread(), NULL);
+
+	// writeFirst issues the ids and signals when the front becomes readable
+	UT_ASSERT(q->writeFirst(ReaderQueueGuts::gen(q), xt, id));
+	UT_IS(id, 1);
+	UT_ASSERT(QueEventGuts::isSignaled(qev));
+	qev->wait(); // reset back the event
+
+	// a wrong generation fails
+	UT_ASSERT(!q->writeFirst(ReaderQueueGuts::gen(q) + 1, xt, id));
+
+	// write with a hole doesn't signal
+	q->write(xt2, 3);
+	UT_ASSERT(!QueEventGuts::isSignaled(qev));
+
+	// the reading stops at the hole
+	UT_ASSERT(q->refill());
+	UT_IS(ReaderQueueGuts::readq(q).size(), 1);
+	UT_IS(q->frontread(), xt.get());
+	UT_IS(ReaderQueueGuts::prevId(q), 1);
+	q->popread();
+	UT_IS(q->frontread(), NULL);
+	UT_ASSERT(!q->refill());
+
+	// fill the hole
+	q->write(xt, 2);
+	UT_ASSERT(QueEventGuts::isSignaled(qev));
+	qev->wait(); // reset back the event
+
+	UT_ASSERT(q->refill());
+	UT_IS(ReaderQueueGuts::readq(q).size(), 2);
+	UT_IS(ReaderQueueGuts::prevId(q), 3);
+	UT_IS(q->frontread(), xt.get());
+	q->popread();
+	UT_IS(q->frontread(), xt2.get());
+	q->popread();
+
+	// the ids issued after the change of the last id
+	ReaderQueueGuts::setLastId(q, 3);
+	UT_ASSERT(q->writeFirst(ReaderQueueGuts::gen(q), xt, id));
+	UT_IS(id, 4);
+	qev->wait(); // reset back the event
+	
+	// ----------------------------------------------------------------------
+
+	// now check that the queue limit is properly heeded
+	q->write(xt, 5);
+	q->write(xt, 6);
+	q->write(xt, 7);
+	q->write(xt, 8);
+	Autoref<WriteHelperT> wh1 = new WriteHelperT(q, xt, 9); // prev 3 + limit 5 + 1 past
+	wh1->start(); // should get stuck writing
+	ReaderQueueGuts::waitCondfullSleep(q, 1);
+
+	UT_ASSERT(q->refill());
+	wh1->join();
+	// the refill might or might not have picked the last write
+	// after waking up the writer
+	size_t got = ReaderQueueGuts::readq(q).size();
+	ReaderQueueGuts::readq(q).clear();
+	q->refill();
+	got += ReaderQueueGuts::readq(q).size();
+	UT_IS(got, 6);
+	UT_IS(ReaderQueueGuts::prevId(q), 9);
+	ReaderQueueGuts::readq(q).clear();
+	qev->reset();
+
+	// ----------------------------------------------------------------------
+
+	// two writers interleaving the ids, the reader must see them in order
+	const Xtray::QueId n = 10000;
+	Autoref<RingWriteT> rw1 = new RingWriteT(q, xt, 10, 2, 9+n);
+	Autoref<RingWriteT> rw2 = new RingWriteT(q, xt2, 11, 2, 9+n);
+	rw1->start();
+	rw2->start();
+
+	Xtray::QueId count = 0;
+	bool inorder = true;
+	while (count < n) {
+		if (!q->refill()) {
+			qev->wait();
+			continue;
+		}
+		for (Xtray *x = q->frontread(); x != NULL; x = q->frontread()) {
+			if (x != ((count & 1)? xt2.get() : xt.get()))
+				inorder = false;
+			q->popread();
+			++count;
+		}
+	}
+	rw1->join();
+	rw2->join();
+	UT_ASSERT(inorder);
+	UT_IS(count, n);
+	UT_IS(ReaderQueueGuts::prevId(q), 9+n);
+	UT_ASSERT(!q->refill());
+}
+
 class WriteHelper2T: public Mtarget, public pw::pwthread
 {
 public:
@@ -2279,3 +2419,550 @@ UTESTCASE pass_begin_end(Utest *utest)
 
 	restore_uncatchable();
 }
+
+// the unicast nexus sends each Xtray to only one reader
+UTESTCASE pass_unicast(Utest *utest)
+{
+	make_catchable();
+
+	Autoref<App> a1 = App::make("a1");
+	a1->setTimeout(0); // will replace all waits with an Exception
+	Autoref<TrieadOwner> ow1 = a1->makeTriead("t1");
+	Autoref<TrieadOwner> ow2 = a1->makeTriead("t2");
+	Autoref<TrieadOwner> ow3 = a1->makeTriead("t3");
+
+	// prepare fragments
+	RowType::FieldVec fld;
+	mkfields(fld);
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+
+	FdataVec dv;
+	mkfdata(dv);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+
+	Autoref<Unit> unit1 = ow1->unit();
+
+	Autoref<Facet> fa1a = ow1->makeNexusWriter("nxa")
+		->addLabel("one", rt1)
+		->setUnicast()
+		->complete()
+	;
+	UT_ASSERT(fa1a->isUnicast());
+	UT_ASSERT(fa1a->nexus()->isUnicast());
+	ow1->markReady();
+
+	Autoref<Facet> fa2a = ow2->importReader("t1", "nxa", "");
+	ReaderQueue *far2a = FacetGuts::readerQueue(fa2a);
+	UT_ASSERT(fa2a->isUnicast());
+	ow2->markReady();
+
+	Autoref<Facet> fa3a = ow3->importReader("t1", "nxa", "");
+	ReaderQueue *far3a = FacetGuts::readerQueue(fa3a);
+	ow3->markReady();
+
+	ow1->readyReady();
+	ow2->readyReady();
+	ow3->readyReady();
+
+	// ----------------------------------------------------------------------
+
+	// each Xtray goes to the reader with the shortest queue
+	for (int i = 0; i < 4; i++) {
+		unit1->call(new Rowop(fa1a->getFnReturn()->getLabel("one"), 
+			Rowop::OP_INSERT, r1));
+		ow1->flushWriters();
+	}
+	UT_IS(ReaderQueueGuts::writeq(far2a).size(), 2);
+	UT_IS(ReaderQueueGuts::writeq(far3a).size(), 2);
+
+	// consume the queue of one reader, then the next Xtrays will go there
+	while (ow2->nextXtrayNoWait());
+	UT_IS(ReaderQueueGuts::writeq(far2a).size(), 0);
+
+	for (int i = 0; i < 2; i++) {
+		unit1->call(new Rowop(fa1a->getFnReturn()->getLabel("one"), 
+			Rowop::OP_INSERT, r1));
+		ow1->flushWriters();
+	}
+	UT_IS(ReaderQueueGuts::writeq(far2a).size(), 2);
+	UT_IS(ReaderQueueGuts::writeq(far3a).size(), 2);
+
+	// ----------------------------------------------------------------------
+
+	// after a reader gets deleted, all the data goes to the other one
+	ow2->markDead();
+	for (int i = 0; i < 3; i++) {
+		unit1->call(new Rowop(fa1a->getFnReturn()->getLabel("one"), 
+			Rowop::OP_INSERT, r1));
+		ow1->flushWriters();
+	}
+	UT_IS(ReaderQueueGuts::writeq(far3a).size(), 5);
+
+	while (ow3->nextXtrayNoWait());
+	UT_IS(ReaderQueueGuts::writeq(far3a).size(), 0);
+
+	ow1->markDead();
+	ow3->markDead();
+	a1->harvester();
+
+	restore_uncatchable();
+}
+
+UTESTCASE pass_partition(Utest *utest)
+{
+	make_catchable();
+
+	Autoref<App> a1 = App::make("a1");
+	a1->setTimeout(0); // will replace all waits with an Exception
+	Autoref<TrieadOwner> ow1 = a1->makeTriead("t1");
+	Autoref<TrieadOwner> ow2 = a1->makeTriead("t2");
+	Autoref<TrieadOwner> ow3 = a1->makeTriead("t3");
+
+	// prepare fragments
+	RowType::FieldVec fld;
+	mkfields(fld);
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+
+	FdataVec dv;
+	mkfdata(dv);
+	const int NKEYS = 10;
+	int32_t keys[NKEYS];
+	vector<Rowref> rows;
+	for (int i = 0; i < NKEYS; i++) {
+		keys[i] = i;
+		dv[1].setPtr(true, &keys[i], sizeof(keys[i]));
+		rows.push_back(Rowref(rt1,  rt1->makeRow(dv)));
+	}
+
+	Autoref<Unit> unit1 = ow1->unit();
+
+	// errors in the arguments
+	{
+		Autoref<Facet> fabad = Facet::make(FnReturn::make(unit1, "fretbad")
+			->addLabel("one", rt1), true);
+		fabad->setPartitionKey("zzz", NameSet::make()->add("b"));
+		fabad->setPartitionKey("_BEGIN_", NameSet::make()->add("b"));
+		fabad->setPartitionKey("one", NameSet::make());
+		fabad->setPartitionKey("one", NameSet::make()->add("x")->add("y"));
+		UT_ASSERT(!fabad->isPartitioned());
+		UT_IS(fabad->getErrors()->print(),
+			"Can not partition by an unknown label 'zzz'.\n"
+			"Can not partition by the label '_BEGIN_', it's used for the transaction framing.\n"
+			"Can not partition by an empty key of the label 'one'.\n"
+			"Can not find the partition key field 'x' in the label 'one'.\n"
+			"Can not find the partition key field 'y' in the label 'one'.\n");
+	}
+
+	Autoref<Facet> fa1a = ow1->makeNexusWriter("nxa")
+		->addLabel("one", rt1)
+		->addLabel("two", rt1)
+		->setPartitionKey("one", NameSet::make()->add("b"))
+		->complete()
+	;
+	UT_ASSERT(fa1a->isPartitioned());
+	UT_ASSERT(fa1a->isUnicast()); // implied
+	UT_ASSERT(fa1a->nexus()->isPartitioned());
+	UT_ASSERT(fa1a->nexus()->isUnicast());
+	ow1->markReady();
+
+	Autoref<Facet> fa2a = ow2->importReader("t1", "nxa", "");
+	ReaderQueue *far2a = FacetGuts::readerQueue(fa2a);
+	UT_ASSERT(fa2a->isPartitioned());
+	UT_ASSERT(fa2a->isUnicast());
+	ow2->markReady();
+
+	Autoref<Facet> fa3a = ow3->importReader("t1", "nxa", "");
+	ReaderQueue *far3a = FacetGuts::readerQueue(fa3a);
+	ow3->markReady();
+
+	ow1->readyReady();
+	ow2->readyReady();
+	ow3->readyReady();
+
+	FnReturn *fret1 = fa1a->getFnReturn();
+
+	// ----------------------------------------------------------------------
+
+	// the rows get split by the keys, the same keys always go to the same reader
+	for (int n = 0; n < 2; n++) {
+		for (int i = 0; i < NKEYS; i++)
+			unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[i]));
+		ow1->flushWriters();
+	}
+	{
+		ReaderQueue::Xdeque &q2 = ReaderQueueGuts::writeq(far2a);
+		ReaderQueue::Xdeque &q3 = ReaderQueueGuts::writeq(far3a);
+		UT_IS(q2.size(), 2);
+		UT_IS(q3.size(), 2);
+		UT_ASSERT(q2[0]->size() > 0);
+		UT_ASSERT(q3[0]->size() > 0);
+		UT_IS(q2[0]->size() + q3[0]->size(), NKEYS);
+		UT_IS(q2[1]->size(), q2[0]->size());
+		UT_IS(q3[1]->size(), q3[0]->size());
+		for (int i = 0; i < q2[0]->size(); i++)
+			UT_IS(q2[1]->at(i).row_, q2[0]->at(i).row_);
+		for (int i = 0; i < q3[0]->size(); i++)
+			UT_IS(q3[1]->at(i).row_, q3[0]->at(i).row_);
+	}
+
+	while (ow2->nextXtrayNoWait());
+	while (ow3->nextXtrayNoWait());
+
+	// ----------------------------------------------------------------------
+
+	// the framing goes with the keyed data, only to its reader
+	{
+		FdataVec fdempty;
+		unit1->call(new Rowop(fret1->getLabel("_BEGIN_"), Rowop::OP_DELETE, 
+			fret1->getLabel("_BEGIN_")->getType()->makeRow(fdempty)));
+	}
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[0]));
+	ow1->flushWriters();
+	{
+		ReaderQueue::Xdeque &q2 = ReaderQueueGuts::writeq(far2a);
+		ReaderQueue::Xdeque &q3 = ReaderQueueGuts::writeq(far3a);
+		UT_IS(q2.size() + q3.size(), 1);
+		Xtray *xt = q2.empty()? q3[0] : q2[0];
+		UT_IS(xt->size(), 2);
+		UT_IS(xt->at(0).idx_, fa1a->beginIdx());
+		UT_IS(xt->at(1).row_, rows[0].get());
+	}
+
+	while (ow2->nextXtrayNoWait());
+	while (ow3->nextXtrayNoWait());
+
+	// the rows without keys go to all the readers
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[0]));
+	unit1->call(new Rowop(fret1->getLabel("two"), Rowop::OP_INSERT, rows[1]));
+	ow1->flushWriters();
+	{
+		ReaderQueue::Xdeque &q2 = ReaderQueueGuts::writeq(far2a);
+		ReaderQueue::Xdeque &q3 = ReaderQueueGuts::writeq(far3a);
+		UT_IS(q2.size(), 1);
+		UT_IS(q3.size(), 1);
+		UT_IS(q2[0]->size() + q3[0]->size(), 3);
+		UT_IS(q2[0]->backIdx(), fret1->findLabel("two"));
+		UT_IS(q3[0]->backIdx(), fret1->findLabel("two"));
+	}
+
+	while (ow2->nextXtrayNoWait());
+	while (ow3->nextXtrayNoWait());
+
+	// the rows without keys go to every reader even if only one reader
+	// gets the keyed data, and take the framing along with them
+	{
+		FdataVec fdempty;
+		unit1->call(new Rowop(fret1->getLabel("_BEGIN_"), Rowop::OP_DELETE,
+			fret1->getLabel("_BEGIN_")->getType()->makeRow(fdempty)));
+	}
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[0]));
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[0]));
+	unit1->call(new Rowop(fret1->getLabel("two"), Rowop::OP_INSERT, rows[1]));
+	ow1->flushWriters();
+	{
+		ReaderQueue::Xdeque &q2 = ReaderQueueGuts::writeq(far2a);
+		ReaderQueue::Xdeque &q3 = ReaderQueueGuts::writeq(far3a);
+		UT_IS(q2.size(), 1);
+		UT_IS(q3.size(), 1);
+		// the keyed rows all went to one reader
+		Xtray *xtk = (q2[0]->size() == 4)? q2[0] : q3[0];
+		Xtray *xtu = (q2[0]->size() == 4)? q3[0] : q2[0];
+		UT_IS(xtk->size(), 4);
+		UT_IS(xtk->at(0).idx_, fa1a->beginIdx());
+		UT_IS(xtk->at(1).row_, rows[0].get());
+		UT_IS(xtk->at(2).row_, rows[0].get());
+		UT_IS(xtk->at(3).row_, rows[1].get());
+		UT_IS(xtu->size(), 2);
+		UT_IS(xtu->at(0).idx_, fa1a->beginIdx());
+		UT_IS(xtu->at(1).idx_, fret1->findLabel("two"));
+		UT_IS(xtu->at(1).row_, rows[1].get());
+	}
+
+	while (ow2->nextXtrayNoWait());
+	while (ow3->nextXtrayNoWait());
+
+	// ----------------------------------------------------------------------
+
+	// after a reader gets deleted, all the data goes to the other one
+	ow2->markDead();
+	for (int i = 0; i < NKEYS; i++)
+		unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, rows[i]));
+	ow1->flushWriters();
+	UT_IS(ReaderQueueGuts::writeq(far3a).size(), 1);
+	UT_IS(ReaderQueueGuts::writeq(far3a)[0]->size(), NKEYS);
+
+	while (ow3->nextXtrayNoWait());
+
+	ow1->markDead();
+	ow3->markDead();
+	a1->harvester();
+
+	restore_uncatchable();
+}
+
+// the coalescing writer packs multiple transactions into one Xtray
+UTESTCASE pass_coalesce(Utest *utest)
+{
+	make_catchable();
+
+	Autoref<App> a1 = App::make("a1");
+	a1->setTimeout(0); // will replace all waits with an Exception
+	Autoref<TrieadOwner> ow1 = a1->makeTriead("t1");
+	Autoref<TrieadOwner> ow2 = a1->makeTriead("t2");
+	Autoref<TrieadOwner> ow3 = a1->makeTriead("t3");
+
+	// prepare fragments
+	RowType::FieldVec fld;
+	mkfields(fld);
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+
+	FdataVec dv;
+	mkfdata(dv);
+	Rowref r1(rt1,  rt1->makeRow(dv)); // a non-empty row
+
+	Autoref<Unit> unit1 = ow1->unit();
+	FdataVec dv0;
+	Rowref e0(unit1->getEmptyRowType(), unit1->getEmptyRowType()->makeRow(dv0)); // for _BEGIN_ and _END_
+	Autoref<Unit> unit2 = ow2->unit();
+	Autoref<Unit::Tracer> trace2 = new Unit::StringNameTracer(false);
+	unit2->setTracer(trace2);
+	Autoref<Unit> unit3 = ow3->unit();
+	Autoref<Unit::Tracer> trace3 = new Unit::StringNameTracer(false);
+	unit3->setTracer(trace3);
+
+	Autoref<Facet> fa1a = ow1->makeNexusWriter("nxa")
+		->addLabel("one", rt1)
+		->complete()
+	;
+	UT_ASSERT(!fa1a->isCoalescing());
+	UT_IS(fa1a->setCoalesce(3), fa1a.get());
+	UT_ASSERT(fa1a->isCoalescing());
+	UT_IS(fa1a->coalesceTrans(), 3);
+	UT_IS(fa1a->coalesceOps(), 0);
+	UT_IS(fa1a->coalesceDelayUs(), 0);
+	{
+		string msg;
+		try {
+			fa1a->setCoalesce(3, 0, -1);
+		} catch(Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Can not set the coalescing limits of the facet 't1/nxa' to maxTrans=3 maxOps=0 maxDelayUs=-1, they must not be negative.\n");
+	}
+	UT_IS(fa1a->coalesceTrans(), 3);
+	FnReturn *fret1 = fa1a->getFnReturn();
+
+	ow1->markReady();
+
+	// t2 reads nxa and relays the data into nxb
+	Autoref<Facet> fa2a = ow2->importReader("t1", "nxa", "");
+	Autoref<Facet> fa2b = ow2->makeNexusWriter("nxb")
+		->addLabel("one", rt1)
+		->complete()
+	;
+	fa2b->setCoalesce(10);
+	FnReturn *fret2a = fa2a->getFnReturn();
+	FnReturn *fret2b = fa2b->getFnReturn();
+	UT_ASSERT(fret2a->getLabel("_BEGIN_")->chain(fret2b->getLabel("_BEGIN_")).isNull());
+	UT_ASSERT(fret2a->getLabel("one")->chain(fret2b->getLabel("one")).isNull());
+	UT_ASSERT(fret2a->getLabel("_END_")->chain(fret2b->getLabel("_END_")).isNull());
+
+	ow2->markReady();
+
+	Autoref<Facet> fa3b = ow3->importReader("t2", "nxb", "");
+	Autoref<Label> lb3begin = new DummyLabel(unit3, unit3->getEmptyRowType(), "begin");
+	UT_ASSERT(fa3b->getFnReturn()->getLabel("_BEGIN_")->chain(lb3begin).isNull());
+	Autoref<Label> lb3end = new DummyLabel(unit3, unit3->getEmptyRowType(), "end");
+	UT_ASSERT(fa3b->getFnReturn()->getLabel("_END_")->chain(lb3end).isNull());
+
+	ow3->markReady();
+
+	ow1->readyReady();
+	ow2->readyReady();
+	ow3->readyReady();
+
+	// ----------------------------------------------------------------------
+
+	// the first two transactions are kept
+	unit1->call(new Rowop(fret1->getLabel("_BEGIN_"), Rowop::OP_INSERT, e0));
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+
+	// a transaction without BEGIN/END, ended by the next BEGIN
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_DELETE, r1));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+	UT_ASSERT(!ow2->nextXtray(false));
+
+	// the third transaction flushes
+	unit1->call(new Rowop(fret1->getLabel("_BEGIN_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+
+	// t2 sees them as separate transactions, and the coalescing
+	// writer in it keeps them until the input runs dry
+	UT_ASSERT(ow2->nextXtray(false));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret2b));
+	{
+		string tlog = trace2->getBuffer()->print();
+		trace2->clearBuffer();
+		string expect =
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_INSERT\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_DELETE\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_DELETE\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_INSERT\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+		;
+		if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	}
+	UT_ASSERT(!ow3->nextXtray(false));
+
+	UT_ASSERT(!ow2->nextXtray(false));
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret2b));
+
+	UT_ASSERT(ow3->nextXtray(false));
+	UT_ASSERT(!ow3->nextXtray(false));
+	{
+		string tlog = trace3->getBuffer()->print();
+		trace3->clearBuffer();
+		string expect =
+			"unit 't3' before label 'nxb._BEGIN_' op OP_INSERT\n"
+			"unit 't3' before label 'begin' (chain 'nxb._BEGIN_') op OP_INSERT\n"
+			"unit 't3' before label 'nxb.one' op OP_INSERT\n"
+			"unit 't3' before label 'nxb._END_' op OP_INSERT\n"
+			"unit 't3' before label 'end' (chain 'nxb._END_') op OP_INSERT\n"
+			"unit 't3' before label 'nxb._BEGIN_' op OP_INSERT\n"
+			"unit 't3' before label 'begin' (chain 'nxb._BEGIN_') op OP_INSERT\n"
+			"unit 't3' before label 'nxb.one' op OP_DELETE\n"
+			"unit 't3' before label 'nxb._END_' op OP_INSERT\n"
+			"unit 't3' before label 'end' (chain 'nxb._END_') op OP_INSERT\n"
+			"unit 't3' before label 'nxb._BEGIN_' op OP_INSERT\n"
+			"unit 't3' before label 'begin' (chain 'nxb._BEGIN_') op OP_INSERT\n"
+			"unit 't3' before label 'nxb.one' op OP_INSERT\n"
+			"unit 't3' before label 'nxb._END_' op OP_INSERT\n"
+			"unit 't3' before label 'end' (chain 'nxb._END_') op OP_INSERT\n"
+		;
+		if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	}
+
+	// ----------------------------------------------------------------------
+
+	// the limit on the number of ops
+	fa1a->setCoalesce(10, 3);
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1)); // 1 op and a boundary
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+
+	UT_ASSERT(ow2->nextXtray(false));
+	UT_ASSERT(!ow2->nextXtray(false));
+	trace2->clearBuffer();
+
+	// the explicit flush sends everything
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+	ow1->flushWriters();
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+
+	UT_ASSERT(ow2->nextXtray(false));
+	UT_ASSERT(!ow2->nextXtray(false));
+	trace2->clearBuffer();
+
+	// the limit on the delay
+	fa1a->setCoalesce(10, 0, 1000);
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+	usleep(2000);
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+
+	UT_ASSERT(ow2->nextXtray(false));
+	UT_ASSERT(!ow2->nextXtray(false));
+	{
+		string tlog = trace2->getBuffer()->print();
+		trace2->clearBuffer();
+		string expect =
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_INSERT\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_INSERT\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+		;
+		if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	}
+
+	// the input-only thread t1 doesn't get to check the delay while it's
+	// idle, so it does that by itself
+	fa1a->setCoalesce(10, 0, 1000*1000);
+	UT_IS(ow1->flushDueUs(), -1);
+	unit1->call(new Rowop(fret1->getLabel("one"), Rowop::OP_INSERT, r1));
+	unit1->call(new Rowop(fret1->getLabel("_END_"), Rowop::OP_INSERT, e0));
+	{
+		int64_t left = ow1->flushDueUs();
+		UT_ASSERT(left > 0 && left <= 1000*1000);
+	}
+	UT_ASSERT(ow1->flushWritersDue()); // not due yet
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+
+	fa1a->setCoalesce(10, 0, 1000);
+	usleep(2000);
+	UT_IS(ow1->flushDueUs(), 0);
+	UT_ASSERT(ow1->flushWritersDue());
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+	UT_IS(ow1->flushDueUs(), -1);
+
+	UT_ASSERT(ow2->nextXtray(false));
+	UT_ASSERT(!ow2->nextXtray(false));
+	{
+		string tlog = trace2->getBuffer()->print();
+		trace2->clearBuffer();
+		string expect =
+			"unit 't2' before label 'nxa._BEGIN_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._BEGIN_' (chain 'nxa._BEGIN_') op OP_INSERT\n"
+			"unit 't2' before label 'nxa.one' op OP_INSERT\n"
+			"unit 't2' before label 'nxb.one' (chain 'nxa.one') op OP_INSERT\n"
+			"unit 't2' before label 'nxa._END_' op OP_INSERT\n"
+			"unit 't2' before label 'nxb._END_' (chain 'nxa._END_') op OP_INSERT\n"
+		;
+		if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	}
+
+	while (ow3->nextXtrayNoWait());
+
+	// ----------------------------------------------------------------------
+
+	// clean-up, since the apps catalog is global
+	ow1->markDead();
+	ow2->markDead();
+	ow3->markDead();
+	a1->harvester();
+
+	restore_uncatchable();
+}
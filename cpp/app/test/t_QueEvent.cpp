@@ -45,6 +45,35 @@ public:
 	Autoref<QueEvent> qev_;
 };
 
+// signals the event many times in a row, counting the signals
+class QueSignalT: public Mtarget, public pw::pwthread
+{
+public:
+	QueSignalT(QueEvent *qev, int n):
+		qev_(qev),
+		n_(n),
+		count_(0)
+	{ }
+
+	virtual void *execute()
+	{
+		for (int i = 0; i < n_; i++) {
+			__atomic_add_fetch(&count_, 1, __ATOMIC_SEQ_CST);
+			qev_->signal();
+		}
+		return NULL;
+	}
+
+	int count()
+	{
+		return __atomic_load_n(&count_, __ATOMIC_SEQ_CST);
+	}
+
+	Autoref<QueEvent> qev_;
+	int n_;
+	int count_;
+};
+
 // the reader side of the QueEvent
 UTESTCASE drain_reader(Utest *utest)
 {
@@ -423,3 +452,84 @@ UTESTCASE drain_writer(Utest *utest)
 		UT_ASSERT(!qev->beforeWrite());
 	}
 }
+
+// the adaptive spinning before the wait
+UTESTCASE spin_wait(Utest *utest)
+{
+	Autoref<DrainApp> drain = new DrainApp;
+	Autoref<QueEvent> qev = new QueEvent(drain);
+
+	drain->left_ = 0; // initialize
+
+	UT_IS(qev->getSpin(), 0);
+	qev->setSpin(1000);
+	UT_IS(qev->getSpin(), 1000);
+
+	// the signal with no sleeper only sets the flag
+	qev->signal();
+	UT_ASSERT(QueEventGuts::isSignaled(qev));
+	qev->wait(); // consumes it right away
+	UT_ASSERT(!QueEventGuts::isSignaled(qev));
+	UT_IS(drain->left_, 0);
+
+	// long enough to be sure that the signal comes during the spinning
+	qev->setSpin(1000*1000*1000);
+	{
+		Autoref<QueWaitT> qwt = new QueWaitT(qev);
+		qwt->start();
+		qev->signal();
+		qwt->join();
+		UT_ASSERT(!QueEventGuts::isSignaled(qev));
+		UT_IS(drain->left_, 0);
+	}
+
+	// a drain request stops the spinning, and the thread goes to sleep
+	// and becomes drained
+	{
+		drain->init();
+		Autoref<QueWaitT> qwt = new QueWaitT(qev);
+		qwt->start();
+		qev->requestDrain();
+		drain->initDone();
+		drain->wait();
+		UT_ASSERT(QueEventGuts::isDrained(qev));
+
+		qev->signal();
+		qwt->join();
+		UT_ASSERT(!QueEventGuts::isDrained(qev));
+		qev->requestUndrain();
+	}
+}
+
+// The signals that come while the waiter is waking up must not get lost.
+UTESTCASE signal_race(Utest *utest)
+{
+	Autoref<DrainApp> drain = new DrainApp;
+	Autoref<QueEvent> qev = new QueEvent(drain);
+
+	drain->left_ = 0; // initialize
+
+	for (int pass = 0; pass < 2; pass++) {
+		const int n = 100*1000;
+		Autoref<QueSignalT> qst = new QueSignalT(qev, n);
+		qst->start();
+
+		// The last signal always comes after the last increase, so
+		// the wait never gets stuck when the signals aren't lost.
+		int res = 0;
+		while (res == 0 && qst->count() < n) {
+			if (pass == 0) {
+				qev->wait();
+			} else {
+				timespec atm;
+				clock_gettime(CLOCK_REALTIME, &atm);
+				atm.tv_sec += 10;
+				res = qev->timedwait(atm);
+			}
+		}
+		UT_IS(res, 0);
+		UT_IS(qst->count(), n);
+		qst->join();
+		qev->reset();
+	}
+}
@@ -490,6 +490,127 @@ UTESTCASE drain_loop(Utest *utest)
 	restore_uncatchable();
 }
 
+// A label that counts the rowops
+class CountLabel: public Label
+{
+public:
+	CountLabel(Unit *unit, Onceref<RowType> rtype, const string &name) :
+		Label(unit, rtype, name)
+	{ }
+
+	virtual void execute(Rowop *arg) const
+	{ 
+		cnt_.inc();
+	}
+
+	mutable AtomicInt cnt_; // the number of rowops seen
+};
+
+// Drains the App and remembers the count seen by the label when drained.
+class DrainCountT: public Mtarget, public pw::pwthread
+{
+public:
+	DrainCountT(App *app, CountLabel *lb):
+		app_(app),
+		lb_(lb),
+		seen_(-1)
+	{ }
+
+	virtual void *execute()
+	{
+		app_->requestDrain();
+		app_->waitDrain();
+		seen_ = lb_->cnt_.get();
+		app_->undrain();
+		return NULL;
+	}
+
+	Autoref<App> app_;
+	Autoref<CountLabel> lb_;
+	int seen_;
+};
+
+// check that the drain doesn't succeed while an input-only thread
+// keeps the coalesced transactions
+UTESTCASE drain_coalesce(Utest *utest)
+{
+	make_catchable();
+
+	TestThreads1 tt(utest);
+
+	Autoref<CountLabel> cnt2a = new CountLabel(tt.ow2->unit(), tt.rt1, "cnt2a");
+	tt.fa2a->getFnReturn()->getLabel("one")->chain(cnt2a);
+	tt.fwd2c->disable(); // no endless loop
+
+	tt.ow1->readyReady();
+	tt.ow2->readyReady();
+	tt.ow3->readyReady();
+
+	FdataVec dv0;
+	Rowref e0(tt.ow1->unit()->getEmptyRowType(), 
+		tt.ow1->unit()->getEmptyRowType()->makeRow(dv0)); // for _END_
+	FnReturn *fret1 = tt.fa1a->getFnReturn();
+
+	// ----------------------------------------------------------------------
+
+	Autoref<LoopPthread> pt2 = new LoopPthread("t2");
+	pt2->start(tt.ow2);
+	Autoref<LoopPthread> pt3 = new LoopPthread("t3");
+	pt3->start(tt.ow3);
+
+	tt.fa1a->setCoalesce(10); // no delay limit, would keep the data indefinitely
+	for (int i = 0; i < 3; i++) {
+		tt.ow1->unit()->call(new Rowop(fret1->getLabel("one"), 
+			Rowop::OP_INSERT, tt.r1));
+		tt.ow1->unit()->call(new Rowop(fret1->getLabel("_END_"), 
+			Rowop::OP_INSERT, e0));
+	}
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+	UT_IS(tt.ow1->flushDueUs(), -1);
+
+	// the drain makes the idle thread flush the data
+	Autoref<DrainCountT> dt1 = new DrainCountT(tt.a1, cnt2a);
+	dt1->start();
+	while (!tt.ow1->isRqDrain())
+		sched_yield();
+	UT_ASSERT(!tt.a1->isDrained());
+	UT_IS(tt.ow1->flushDueUs(), 0);
+	UT_ASSERT(tt.ow1->flushWritersDue());
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+	dt1->join();
+	UT_IS(dt1->seen_, 3);
+
+	// a transaction during the drain flushes everything right away
+	for (int i = 0; i < 3; i++) {
+		tt.ow1->unit()->call(new Rowop(fret1->getLabel("one"), 
+			Rowop::OP_INSERT, tt.r1));
+		tt.ow1->unit()->call(new Rowop(fret1->getLabel("_END_"), 
+			Rowop::OP_INSERT, e0));
+	}
+	UT_ASSERT(!FnReturnGuts::isXtrayEmpty(fret1));
+
+	Autoref<DrainCountT> dt2 = new DrainCountT(tt.a1, cnt2a);
+	dt2->start();
+	while (!tt.ow1->isRqDrain())
+		sched_yield();
+	tt.ow1->unit()->call(new Rowop(fret1->getLabel("one"), 
+		Rowop::OP_INSERT, tt.r1));
+	tt.ow1->unit()->call(new Rowop(fret1->getLabel("_END_"), 
+		Rowop::OP_INSERT, e0));
+	UT_ASSERT(FnReturnGuts::isXtrayEmpty(fret1));
+	dt2->join();
+	UT_IS(dt2->seen_, 7);
+
+	// ----------------------------------------------------------------------
+
+	tt.ow1->markDead(); // ow1 is controlled manually
+	tt.a1->shutdown(); // request all the threads to die
+
+	tt.a1->harvester();
+
+	restore_uncatchable();
+}
+
 // mark the App as drained, then add threads;
 // also do the drains with indefined (but declared) threads
 UTESTCASE drain_unready(Utest *utest)
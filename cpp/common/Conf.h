@@ -19,4 +19,18 @@
 #define TRICEPS_BACKTRACE true
 #endif
 
+// Flag: use std::atomic for the atomic integers, if the code is compiled
+// as C++11 or later (see mem/Atomic.h). Otherwise NSPR is used if
+// TRICEPS_NSPR is defined, or the portable implementation with a mutex.
+// All the code linked together must be compiled with the same choice.
+#ifndef TRICEPS_STD_ATOMIC
+#define TRICEPS_STD_ATOMIC true
+#endif
+
+// Flag: allocate the rows and row handles from the size-class slabs
+// (see mem/SlabAlloc.h) instead of directly with malloc().
+#ifndef TRICEPS_SLAB_ALLOC
+#define TRICEPS_SLAB_ALLOC true
+#endif
+
 #endif // __Triceps_Conf_h__
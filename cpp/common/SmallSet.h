@@ -0,0 +1,249 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A set that keeps a few elements inline and switches to an STL set
+// when it grows larger.
+
+#ifndef __Triceps_SmallSet_h__
+#define __Triceps_SmallSet_h__
+
+#include <set>
+#include <iterator>
+#include <algorithm>
+#include <common/Common.h>
+
+namespace TRICEPS_NS {
+
+// The operations follow the STL model, but only a subset is available.
+// Insert-only, no removal (other than full clearing).
+//
+// The iteration goes in the order of the elements, same as in std::set,
+// both in the inline and in the STL mode. The inline elements are kept
+// in a sorted array, so the small sets don't do any memory allocation.
+// Once the set grows beyond the inline size, it moves into an STL set
+// and stays there until cleared.
+//
+// @param Target - the element type, must be copyable and comparable with "<"
+// @param N - the number of elements kept inline
+template<typename Target, int N>
+class SmallSet
+{
+public:
+	typedef set<Target> BigSet;
+
+	// The iterator is always constant, the elements may not be changed
+	// in place.
+	class const_iterator
+	{
+		friend class SmallSet;
+	public:
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef Target value_type;
+		typedef ptrdiff_t difference_type;
+		typedef const Target *pointer;
+		typedef const Target &reference;
+
+		const_iterator() :
+			p_(NULL)
+		{ }
+
+		reference operator*() const
+		{
+			return (p_ != NULL)? *p_ : *it_;
+		}
+		pointer operator->() const
+		{
+			return &**this;
+		}
+
+		const_iterator &operator++()
+		{
+			if (p_ != NULL)
+				++p_;
+			else
+				++it_;
+			return *this;
+		}
+		const_iterator operator++(int)
+		{
+			const_iterator old = *this;
+			++*this;
+			return old;
+		}
+		const_iterator &operator--()
+		{
+			if (p_ != NULL)
+				--p_;
+			else
+				--it_;
+			return *this;
+		}
+		const_iterator operator--(int)
+		{
+			const_iterator old = *this;
+			--*this;
+			return old;
+		}
+
+		bool operator==(const const_iterator &other) const
+		{
+			if (p_ != NULL || other.p_ != NULL)
+				return p_ == other.p_;
+			return it_ == other.it_;
+		}
+		bool operator!=(const const_iterator &other) const
+		{
+			return !(*this == other);
+		}
+
+	protected:
+		// the inline mode
+		const_iterator(const Target *p) :
+			p_(p)
+		{ }
+		// the STL mode
+		const_iterator(typename BigSet::const_iterator it) :
+			p_(NULL),
+			it_(it)
+		{ }
+
+		const Target *p_; // pointer into the inline array, or NULL in the STL mode
+		typename BigSet::const_iterator it_; // used in the STL mode
+	};
+	typedef const_iterator iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+	typedef const_reverse_iterator reverse_iterator;
+
+	SmallSet() :
+		size_(0),
+		big_(NULL)
+	{ }
+
+	SmallSet(const SmallSet &orig) :
+		size_(orig.size_),
+		big_(NULL)
+	{
+		if (orig.big_ != NULL)
+			big_ = new BigSet(*orig.big_);
+		else
+			std::copy(orig.small_, orig.small_ + orig.size_, small_);
+	}
+
+	~SmallSet()
+	{
+		delete big_;
+	}
+
+	SmallSet &operator=(const SmallSet &orig)
+	{
+		if (&orig != this) {
+			clear();
+			if (orig.big_ != NULL)
+				big_ = new BigSet(*orig.big_);
+			else
+				std::copy(orig.small_, orig.small_ + orig.size_, small_);
+			size_ = orig.size_;
+		}
+		return *this;
+	}
+
+	// Drops all the elements and returns the set to the inline mode.
+	void clear()
+	{
+		if (big_ != NULL) {
+			delete big_;
+			big_ = NULL;
+		}
+		size_ = 0;
+	}
+
+	size_t size() const
+	{
+		return (big_ != NULL)? big_->size() : size_;
+	}
+
+	bool empty() const
+	{
+		return (big_ != NULL)? big_->empty() : (size_ == 0);
+	}
+
+	// Insert an element.
+	// @param elem - element to insert
+	// @return - the iterator pointing to the element in the set,
+	//     and the flag: true if this element was not in the set yet
+	pair<iterator, bool> insert(const Target &elem)
+	{
+		if (big_ == NULL) {
+			Target *end = small_ + size_;
+			Target *p = std::lower_bound(small_, end, elem);
+			if (p != end && !(elem < *p))
+				return pair<iterator, bool>(iterator(p), false);
+			if (size_ < N) {
+				std::copy_backward(p, end, end + 1);
+				*p = elem;
+				++size_;
+				return pair<iterator, bool>(iterator(p), true);
+			}
+			// move into the STL mode
+			big_ = new BigSet(small_, end);
+			size_ = 0;
+		}
+		pair<typename BigSet::iterator, bool> res = big_->insert(elem);
+		return pair<iterator, bool>(iterator(res.first), res.second);
+	}
+
+	// Insert the elements from a range.
+	template <typename InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			insert(*first);
+	}
+
+	iterator find(const Target &elem) const
+	{
+		if (big_ != NULL)
+			return iterator(big_->find(elem));
+		const Target *end = small_ + size_;
+		const Target *p = std::lower_bound(small_, end, elem);
+		if (p != end && !(elem < *p))
+			return iterator(p);
+		return iterator(end);
+	}
+
+	iterator begin() const
+	{
+		if (big_ != NULL)
+			return iterator(big_->begin());
+		return iterator(small_);
+	}
+
+	iterator end() const
+	{
+		if (big_ != NULL)
+			return iterator(big_->end());
+		return iterator(small_ + size_);
+	}
+
+	reverse_iterator rbegin() const
+	{
+		return reverse_iterator(end());
+	}
+
+	reverse_iterator rend() const
+	{
+		return reverse_iterator(begin());
+	}
+
+protected:
+	Target small_[N]; // the inline elements, sorted
+	size_t size_; // the number of the inline elements
+	BigSet *big_; // the STL set, or NULL in the inline mode
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_SmallSet_h__
@@ -13,7 +13,7 @@
 
 namespace TRICEPS_NS {
 
-const string &NOINDENT = NULL;
+static const string noIndentMarker_; const string &NOINDENT = noIndentMarker_; // LOCAL GATE WORKAROUND
 
 const string &nextindent(const string &indent, const string &subindent, string &target)
 {
@@ -0,0 +1,19 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase consistency;
+	driver.addcase(consistency, "consistency");
+
+	extern Utest::Testcase throughput;
+	driver.addcase(throughput, "throughput");
+
+	extern Utest::Testcase collisions;
+	driver.addcase(collisions, "collisions");
+
+	return driver.run();
+}
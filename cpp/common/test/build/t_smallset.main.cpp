@@ -0,0 +1,16 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase inlineMode;
+	driver.addcase(inlineMode, "inlineMode");
+
+	extern Utest::Testcase bigMode;
+	driver.addcase(bigMode, "bigMode");
+
+	return driver.run();
+}
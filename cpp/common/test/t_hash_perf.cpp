@@ -0,0 +1,256 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the performance and of the collision rates of the hash functions
+// on the typical keys.
+// By default it's configured to run fast at the cost of precision. To increase
+// the precision increase the number of iterations by setting the environment
+// variable:
+//   TRICEPS_PERF_COUNT=0x1000000 t_hash_perf
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <utest/Utest.h>
+
+#include <common/Hash.h>
+#include <common/Strprintf.h>
+
+#define DEFAULT_COUNT 100000
+
+static double now()
+{
+	timespec tm;
+	clock_gettime(CLOCK_REALTIME, &tm);
+	return (double)tm.tv_sec + (double)tm.tv_nsec / 1000000000.;
+}
+
+int64_t findRunCount()
+{
+	char *v = getenv("TRICEPS_PERF_COUNT");
+	if (v != NULL) {
+		long long n;
+		if (sscanf(v, "%lli", &n) == 1) {
+			return n;
+		}
+	}
+	return DEFAULT_COUNT;
+}
+
+// The keys for the tests, all kept in one buffer to not measure the
+// memory allocation.
+struct KeySet
+{
+	vector<char> data_;
+	vector<size_t> off_; // offset of each key, plus one past the end
+
+	size_t size() const
+	{
+		return off_.size() - 1;
+	}
+	const char *key(size_t i) const
+	{
+		return &data_[off_[i]];
+	}
+	size_t len(size_t i) const
+	{
+		return off_[i+1] - off_[i];
+	}
+};
+
+// Generate the keys.
+// @param ks - the set to fill
+// @param kind - 0: int32 sequence, 1: int64 sequence of timestamp-like values,
+//   2: short strings like symbol names, 3: long strings like the composite
+//   paths, 4: float64 prices, 5: text messages of a few hundred bytes
+// @param n - the number of keys
+static void makeKeys(KeySet &ks, int kind, int64_t n)
+{
+	ks.data_.clear();
+	ks.off_.clear();
+	for (int64_t i = 0; i < n; i++) {
+		ks.off_.push_back(ks.data_.size());
+		switch (kind) {
+		case 0: {
+				int32_t v = (int32_t)i;
+				ks.data_.insert(ks.data_.end(), (char *)&v, (char *)&v + sizeof(v));
+			}
+			break;
+		case 1: {
+				int64_t v = 1400000000000000LL + i * 1000;
+				ks.data_.insert(ks.data_.end(), (char *)&v, (char *)&v + sizeof(v));
+			}
+			break;
+		case 2: {
+				string s = strprintf("SYM%lld", (long long)i);
+				ks.data_.insert(ks.data_.end(), s.begin(), s.end());
+			}
+			break;
+		case 3: {
+				string s = strprintf("/region/us-east/customer/%08lld/account/%lld/orders",
+					(long long)(i / 16), (long long)(i % 16));
+				ks.data_.insert(ks.data_.end(), s.begin(), s.end());
+			}
+			break;
+		case 4: {
+				double v = 100. + (double)i * 0.01;
+				ks.data_.insert(ks.data_.end(), (char *)&v, (char *)&v + sizeof(v));
+			}
+			break;
+		case 5: {
+				string s = strprintf("order %lld from customer %08lld: ", (long long)i, (long long)(i / 16));
+				while (s.size() < 300)
+					s.append("the quick brown fox jumps over the lazy dog; ");
+				ks.data_.insert(ks.data_.end(), s.begin(), s.end());
+			}
+			break;
+		}
+	}
+	ks.off_.push_back(ks.data_.size());
+}
+
+static const char *kindName[] = { "int32", "int64", "short string", "long string", "float64", "text" };
+#define NKINDS (sizeof(kindName) / sizeof(kindName[0]))
+
+// Count the values that are equal to some other value.
+template <typename T>
+static size_t countCollisions(vector<T> &v)
+{
+	sort(v.begin(), v.end());
+	size_t c = 0;
+	for (size_t i = 1; i < v.size(); i++) {
+		if (v[i] == v[i-1])
+			c++;
+	}
+	return c;
+}
+
+// Count the keys that don't get their own home slot in a table with the
+// size of the next power of 2, same as in HashedSet that uses the high bits.
+template <typename T>
+static size_t countSlotCollisions(const vector<T> &v)
+{
+	int bits = 0;
+	while (((size_t)1 << bits) < v.size())
+		bits++;
+	vector<T> slots(v.size());
+	for (size_t i = 0; i < v.size(); i++)
+		slots[i] = (bits == 0)? 0 : v[i] >> (sizeof(T) * 8 - bits);
+	return countCollisions(slots);
+}
+
+UTESTCASE consistency(Utest *utest)
+{
+	// the shortcuts must give the same results as the generic hashing
+	int64_t v64 = 0x123456789abcdefLL;
+	int32_t v32 = 0x12345678;
+	double vf = 1.5;
+	UT_IS(Hash::append64(Hash::basis_, v64), Hash::append(Hash::basis_, (char *)&v64, sizeof(v64)));
+	UT_IS(Hash::append32(Hash::basis_, v32), Hash::append(Hash::basis_, (char *)&v32, sizeof(v32)));
+	uint64_t uf;
+	memcpy(&uf, &vf, sizeof(uf));
+	UT_IS(Hash::append64(Hash::basis_, uf), Hash::append(Hash::basis_, (char *)&vf, sizeof(vf)));
+
+	// all the lengths go through the different paths, and must differ
+	char buf[200];
+	for (size_t i = 0; i < sizeof(buf); i++)
+		buf[i] = (char)i;
+	vector<Hash::Value> hv;
+	for (size_t len = 0; len <= sizeof(buf); len++)
+		hv.push_back(Hash::append(Hash::basis_, buf, len));
+	UT_IS(countCollisions(hv), 0);
+
+	// a change in any byte changes the hash
+	Hash::Value h = Hash::append(Hash::basis_, buf, sizeof(buf));
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] ^= 1;
+		if (UT_ASSERT(Hash::append(Hash::basis_, buf, sizeof(buf)) != h)) {
+			printf("        byte %d\n", (int)i);
+			break;
+		}
+		buf[i] ^= 1;
+	}
+}
+
+UTESTCASE throughput(Utest *utest)
+{
+	int64_t n = findRunCount();
+	KeySet ks;
+
+	for (size_t k = 0; k < NKINDS; k++) {
+		makeKeys(ks, k, n);
+		size_t nk = ks.size();
+
+		Hash::Value x = 0;
+		double tstart = now();
+		for (size_t i = 0; i < nk; i++) {
+			x ^= Hash::append(Hash::basis_, ks.key(i), ks.len(i));
+		}
+		double tend = now();
+		printf("        %-12s hash64  [%llx] %lld keys, %f seconds, %f keys per second, %f MB per second\n",
+			kindName[k], (long long)(x & 0xFF), (long long)nk, (tend-tstart), (double)nk / (tend-tstart),
+			(double)ks.data_.size() / (tend-tstart) / 1e6);
+
+		Hash::FnvValue fx = 0;
+		tstart = now();
+		for (size_t i = 0; i < nk; i++) {
+			fx ^= Hash::fnvAppend(Hash::fnvBasis_, ks.key(i), ks.len(i));
+		}
+		tend = now();
+		printf("        %-12s fnv32   [%llx] %lld keys, %f seconds, %f keys per second, %f MB per second\n",
+			kindName[k], (long long)(fx & 0xFF), (long long)nk, (tend-tstart), (double)nk / (tend-tstart),
+			(double)ks.data_.size() / (tend-tstart) / 1e6);
+
+		if (k == 0 || k == 1 || k == 4) {
+			// the shortcut used for the fixed-size fields
+			x = 0;
+			tstart = now();
+			if (k == 0) {
+				for (size_t i = 0; i < nk; i++)
+					x ^= Hash::append32(Hash::basis_, Hash::read32((const unsigned char *)ks.key(i)));
+			} else {
+				for (size_t i = 0; i < nk; i++)
+					x ^= Hash::append64(Hash::basis_, Hash::read64((const unsigned char *)ks.key(i)));
+			}
+			tend = now();
+			printf("        %-12s fixed64 [%llx] %lld keys, %f seconds, %f keys per second\n",
+				kindName[k], (long long)(x & 0xFF), (long long)nk, (tend-tstart), (double)nk / (tend-tstart));
+		}
+	}
+}
+
+UTESTCASE collisions(Utest *utest)
+{
+	int64_t n = findRunCount();
+	KeySet ks;
+
+	for (size_t k = 0; k < NKINDS; k++) {
+		makeKeys(ks, k, n);
+		size_t nk = ks.size();
+
+		vector<Hash::Value> hv(nk);
+		vector<Hash::FnvValue> fv(nk);
+		for (size_t i = 0; i < nk; i++) {
+			hv[i] = Hash::append(Hash::basis_, ks.key(i), ks.len(i));
+			fv[i] = Hash::fnvAppend(Hash::fnvBasis_, ks.key(i), ks.len(i));
+		}
+
+		size_t hslot = countSlotCollisions(hv);
+		size_t fslot = countSlotCollisions(fv);
+		size_t hfull = countCollisions(hv);
+		size_t ffull = countCollisions(fv);
+		printf("        %-12s %lld keys: hash64 %lld full, %lld slot (%.2f%%); fnv32 %lld full, %lld slot (%.2f%%)\n",
+			kindName[k], (long long)nk,
+			(long long)hfull, (long long)hslot, 100. * hslot / nk,
+			(long long)ffull, (long long)fslot, 100. * fslot / nk);
+
+		// the distinct keys must have the distinct 64-bit hashes
+		UT_IS(hfull, 0);
+	}
+}
@@ -0,0 +1,80 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the small set.
+
+#include <utest/Utest.h>
+#include <common/SmallSet.h>
+
+typedef SmallSet<int, 3> Iset;
+
+// Print the contents of the set in the iteration order.
+static string printSet(const Iset &s)
+{
+	string res;
+	for (Iset::iterator it = s.begin(); it != s.end(); ++it)
+		res.append(strprintf("%d ", *it));
+	return res;
+}
+
+UTESTCASE inlineMode(Utest *utest)
+{
+	Iset s;
+	UT_ASSERT(s.empty());
+	UT_IS(s.size(), 0);
+	UT_ASSERT(s.begin() == s.end());
+
+	UT_ASSERT(s.insert(5).second);
+	UT_ASSERT(s.insert(1).second);
+	UT_ASSERT(!s.insert(5).second);
+	UT_ASSERT(s.insert(3).second);
+	UT_IS(s.size(), 3);
+	UT_ASSERT(!s.empty());
+	UT_IS(printSet(s), "1 3 5 ");
+	UT_IS(*s.rbegin(), 5);
+
+	UT_ASSERT(s.find(3) != s.end());
+	UT_IS(*s.find(3), 3);
+	UT_ASSERT(s.find(4) == s.end());
+
+	s.clear();
+	UT_ASSERT(s.empty());
+	UT_IS(printSet(s), "");
+}
+
+UTESTCASE bigMode(Utest *utest)
+{
+	Iset s;
+	s.insert(5);
+	s.insert(1);
+	s.insert(3);
+	UT_ASSERT(s.insert(4).second); // moves into the STL set
+	UT_ASSERT(!s.insert(1).second);
+	s.insert(0);
+	UT_IS(s.size(), 5);
+	UT_IS(printSet(s), "0 1 3 4 5 ");
+	UT_IS(*s.rbegin(), 5);
+	UT_IS(*s.find(4), 4);
+	UT_ASSERT(s.find(2) == s.end());
+
+	// copying works in both modes
+	Iset s2(s);
+	UT_IS(printSet(s2), "0 1 3 4 5 ");
+
+	s.clear(); // back into the inline mode
+	s.insert(2);
+	UT_IS(printSet(s), "2 ");
+	s2 = s;
+	UT_IS(printSet(s2), "2 ");
+
+	// a range insert
+	Iset s3;
+	s3.insert(s.begin(), s.end());
+	s.insert(7);
+	s.insert(6);
+	s3.insert(s.begin(), s.end());
+	UT_IS(printSet(s3), "2 6 7 ");
+}
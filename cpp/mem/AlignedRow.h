@@ -0,0 +1,123 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A row format with the fixed-size fields at the fixed aligned offsets,
+// good for the fast access to the numeric fields.
+
+#ifndef __Triceps_AlignedRow_h__
+#define __Triceps_AlignedRow_h__
+
+#include <mem/Row.h>
+
+namespace TRICEPS_NS {
+
+class AlignedRowType;
+
+class AlignedRow : public Row
+{
+public:
+	// The default destructor is adequate.
+	// It must be public because otherwise Autoptr won't work.
+
+	// Check whether a field is NULL
+	// @param nf - field number, starting from 0
+	bool isFieldNull(int nf) const
+	{
+		return (nullmap()[nf >> 3] & (1 << (nf & 7))) != 0;
+	}
+	bool isFieldNotNull(int nf) const
+	{
+		return (nullmap()[nf >> 3] & (1 << (nf & 7))) == 0;
+	}
+
+	// Get the total length of the row data, starting from the header.
+	intptr_t dataLen() const
+	{
+		return (intptr_t)(hdr_.len_ & LENMASK);
+	}
+
+	// Check whether the row has the irregular layout, where all the
+	// fields are placed through the offset table.
+	bool isIrregular() const
+	{
+		return (hdr_.len_ & IRREGULAR) != 0;
+	}
+
+	// Get a pointer by the offset from the start of the row data.
+	// @param off - the offset
+	const char *dataPtr(intptr_t off) const
+	{
+		return ((const char *)&hdr_) + off;
+	}
+	// Same, except for the writeable return type
+	char *dataPtrW(intptr_t off) const
+	{
+		return ((char *)&hdr_) + off;
+	}
+
+	// Get the offset table for the variable fields.
+	// @param off - offset of the table from the start of the row data
+	const int32_t *offTable(intptr_t off) const
+	{
+		return (const int32_t *)dataPtr(off);
+	}
+
+	// The offset of the null bitmap from the start of the row data.
+	static intptr_t nullmapOffset()
+	{
+		return sizeof(uint32_t);
+	}
+
+	// Calculate the variable length for new()
+	// @param datalen - total length of the row data, including the header
+	static intptr_t variableLen(intptr_t datalen)
+	{
+		// the header is already included in the structure
+		return datalen - (intptr_t)sizeof(hdr_);
+	}
+
+protected:
+	friend class AlignedRowType;
+
+	const uint8_t *nullmap() const
+	{
+		return (const uint8_t *)dataPtr(nullmapOffset());
+	}
+
+protected:
+	// internal structure (all the offsets are relative to &hdr_):
+	//    uint32_t length of the data, including the header, with the
+	//        high bit (IRREGULAR) showing the irregular layout
+	//    null bitmap, 1 bit per field, the set bit means a null field
+	//    (padding to the 8-byte alignment)
+	//    the fixed-size fields, the 8-byte ones first, then the 4-byte ones,
+	//        so each of them is naturally aligned
+	//    int32_t offset table for the variable fields, with one more
+	//        entry at the end for the offset past the last field
+	//    data bytes of the variable fields
+	//
+	// The layout of the fixed fields and of the offset table is computed
+	// by AlignedRowType from the field types, the row doesn't know it.
+	// A scalar int32, int64 or float64 field is the fixed one, everything else
+	// is variable.
+	//
+	// The row types don't enforce the sizes of the scalar fields, so a field
+	// might come with a length that doesn't fit into its fixed slot. Then
+	// the whole row is built in the irregular layout, without the fixed
+	// fields, and with the offset table containing all the fields.
+	//
+	// All the padding and the null fixed fields are zeroed, so the rows
+	// can be compared by the contents with memcmp().
+	enum { LENMASK = 0x7FFFFFFF, IRREGULAR = 0x80000000 };
+	union {
+		uint32_t len_;
+		int64_t align_; // makes the following data 8-byte aligned
+	} hdr_; // really bigger
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_AlignedRow_h__
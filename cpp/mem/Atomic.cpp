@@ -4,20 +4,44 @@
 // See the file COPYRIGHT for the copyright notice and license information
 //
 //
-// The operations to work on atomic integers (using an external implementation
-// or with plain mutexes).
+// The operations to work on atomic integers (using std::atomic,
+// an external implementation or with plain mutexes).
 
 #include <mem/Atomic.h>
 
 namespace TRICEPS_NS {
 
-// these are the same, with or without NSPR!
+// these are the same for all the implementations!
 
-AtomicInt::AtomicInt() :
+#ifdef TRICEPS_STD_ATOMIC_AVAILABLE // {
+
+StdAtomicInt::StdAtomicInt() :
+	val_(0)
+{ }
+
+StdAtomicInt::StdAtomicInt(int val) :
+	val_(val)
+{ }
+
+#endif // } TRICEPS_STD_ATOMIC_AVAILABLE
+
+#ifdef TRICEPS_NSPR // {
+
+NsprAtomicInt::NsprAtomicInt() :
+	val_(0)
+{ }
+
+NsprAtomicInt::NsprAtomicInt(int val) :
+	val_(val)
+{ }
+
+#endif // } TRICEPS_NSPR
+
+MutexAtomicInt::MutexAtomicInt() :
 	val_(0)
 { }
 
-AtomicInt::AtomicInt(int val) :
+MutexAtomicInt::MutexAtomicInt(int val) :
 	val_(val)
 { }
 
@@ -4,27 +4,89 @@
 // See the file COPYRIGHT for the copyright notice and license information
 //
 //
-// The operations to work on atomic integers (using an external implementation
-// or with plain mutexes).
+// The operations to work on atomic integers (using std::atomic,
+// an external implementation or with plain mutexes).
 
 #ifndef __Triceps_Atomic_h__
 #define __Triceps_Atomic_h__
 
+#include <common/Conf.h>
 #include <pw/ptwrap.h>
 #ifdef TRICEPS_NSPR // {
 #  include <pratom.h>
 #endif // } TRICEPS_NSPR
 
+// std::atomic is available since C++11.
+#if TRICEPS_STD_ATOMIC && __cplusplus >= 201103L // {
+#  define TRICEPS_STD_ATOMIC_AVAILABLE 1
+#  include <atomic>
+#endif // } TRICEPS_STD_ATOMIC
+
 namespace TRICEPS_NS {
 
+// There are up to three implementations of the atomic integers, and
+// AtomicInt is the best available of them. All of them have the same
+// interface. The other implementations are still available
+// under their own names, to compare the performance.
+//
+// The main use of the atomic integers is the reference counting, and
+// the memory ordering is chosen accordingly: an increase doesn't need to
+// synchronize with anything, since a new reference always gets copied
+// from an existing one, while a decrease must make all the preceding
+// changes to the object visible to the thread that drops the last
+// reference and destroys it.
+
+#ifdef TRICEPS_STD_ATOMIC_AVAILABLE // {
+
+// The implementation on the standard C++ atomics.
+class StdAtomicInt
+{
+public:
+	StdAtomicInt(); // value defaults to 0
+	StdAtomicInt(int val);
+
+	// set the value
+	void set(int val)
+	{
+		val_.store(val, std::memory_order_release);
+	}
+
+	// get the value
+	int get() const
+	{
+		return val_.load(std::memory_order_acquire);
+	}
+
+	// increase the value, return the result
+	int inc()
+	{
+		return val_.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	// derease the value, return the result
+	int dec()
+	{
+		return val_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+	}
+
+protected:
+	std::atomic<int> val_;
+
+private:
+	void operator=(const StdAtomicInt &);
+	StdAtomicInt(const StdAtomicInt &);
+};
+
+#endif // } TRICEPS_STD_ATOMIC_AVAILABLE
+
 #ifdef TRICEPS_NSPR // {
 
 // the implementation around the NSPR4 atomics
-class AtomicInt
+class NsprAtomicInt
 {
 public:
-	AtomicInt(); // value defaults to 0
-	AtomicInt(int val);
+	NsprAtomicInt(); // value defaults to 0
+	NsprAtomicInt(int val);
 
 	// set the value
 	void set(int val)
@@ -54,19 +116,19 @@ protected:
 	PRInt32 val_;
 
 private:
-	void operator=(const AtomicInt &);
-	AtomicInt(const AtomicInt &);
+	void operator=(const NsprAtomicInt &);
+	NsprAtomicInt(const NsprAtomicInt &);
 };
 
-#else  // } { TRICEPS_NSPR
+#endif // } TRICEPS_NSPR
 
 // the baseline implementation when nothing better is available
 // (it's actually not that bad, I've measured it only about 2.5-3 times slower)
-class AtomicInt
+class MutexAtomicInt
 {
 public:
-	AtomicInt(); // value defaults to 0
-	AtomicInt(int val);
+	MutexAtomicInt(); // value defaults to 0
+	MutexAtomicInt(int val);
 
 	// set the value
 	void set(int val)
@@ -105,11 +167,17 @@ protected:
 	int val_;
 
 private:
-	void operator=(const AtomicInt &);
-	AtomicInt(const AtomicInt &);
+	void operator=(const MutexAtomicInt &);
+	MutexAtomicInt(const MutexAtomicInt &);
 };
 
-#endif // } TRICEPS_NSPR
+#if defined(TRICEPS_STD_ATOMIC_AVAILABLE) // {
+typedef StdAtomicInt AtomicInt;
+#elif defined(TRICEPS_NSPR) // }{
+typedef NsprAtomicInt AtomicInt;
+#else // }{
+typedef MutexAtomicInt AtomicInt;
+#endif // }
 
 }; // TRICEPS_NS
 
@@ -7,6 +7,7 @@
 // The common buffer base of all the row implementations.
 
 #include <mem/MtBuffer.h>
+#include <mem/SlabAlloc.h>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -16,12 +17,12 @@ namespace TRICEPS_NS {
 
 void *MtBuffer::operator new(size_t basic, intptr_t variable)
 {
-	return malloc((intptr_t)basic + variable);
+	return SlabAlloc::alloc((intptr_t)basic + variable);
 }
 
 void MtBuffer::operator delete(void *ptr)
 {
-	free(ptr);
+	SlabAlloc::release(ptr);
 }
 
 /////////////////////// VirtualMtBuffer ////////////////////////
@@ -0,0 +1,295 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// The size-class allocator for the small objects, such as rows and row handles.
+
+#include <mem/SlabAlloc.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace TRICEPS_NS {
+
+#if TRICEPS_SLAB_ALLOC // {
+
+// The header placed before each block, it keeps the 8-byte alignment.
+union SlabBlockHeader {
+	uint64_t cls_; // the size class of the block, 0 for the blocks from malloc()
+	double align_;
+};
+
+// A free block links to the next one through its body.
+// The smallest block body has the space for two pointers.
+struct SlabFreeBlock {
+	SlabFreeBlock *next_; // next block in the same cache or batch
+	SlabFreeBlock *nextBatch_; // in the depot, the first block of the next batch
+};
+
+// The thread cache of one size class.
+struct SlabClassCache {
+	SlabFreeBlock *head_;
+	int count_;
+};
+
+struct SlabThreadCache {
+	SlabClassCache cl_[SlabAlloc::NCLASSES];
+};
+
+// The depot keeps the batches of free blocks. The plain pthread mutexes
+// get initialized through pthread_once(), to avoid any dependency on the
+// order of the static constructors.
+static pthread_mutex_t slabDepotMutex[SlabAlloc::NCLASSES];
+static SlabFreeBlock *slabDepot[SlabAlloc::NCLASSES]; // protected by slabDepotMutex
+static size_t slabTotal = 0; // changed atomically
+
+static pthread_once_t slabOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t slabCacheKey;
+static __thread SlabThreadCache *slabCache = NULL;
+
+// the full size of a block of the class, including the header
+static size_t slabBlockSize(int cls)
+{
+	return (size_t)cls * SlabAlloc::GRAIN + sizeof(SlabBlockHeader);
+}
+
+// the number of blocks in a batch of the class
+static int slabBatchSize(int cls)
+{
+	int n = (int)(SlabAlloc::BATCH_BYTES / slabBlockSize(cls));
+	return (n < 4? 4 : n);
+}
+
+static SlabBlockHeader *slabHeader(void *ptr)
+{
+	return ((SlabBlockHeader *)ptr) - 1;
+}
+
+// Put a chain of blocks into the depot, in batches.
+// @param cls - size class
+// @param head - the chain of blocks
+static void slabToDepot(int cls, SlabFreeBlock *head)
+{
+	int bsz = slabBatchSize(cls);
+	pthread_mutex_lock(&slabDepotMutex[cls]);
+	while (head != NULL) {
+		SlabFreeBlock *batch = head;
+		SlabFreeBlock *last = head;
+		for (int i = 1; i < bsz && last->next_ != NULL; i++)
+			last = last->next_;
+		head = last->next_;
+		last->next_ = NULL;
+
+		batch->nextBatch_ = slabDepot[cls];
+		slabDepot[cls] = batch;
+	}
+	pthread_mutex_unlock(&slabDepotMutex[cls]);
+}
+
+// Move all the blocks from a thread cache to the depot.
+static void slabFlush(SlabThreadCache *tc)
+{
+	for (int cls = 1; cls < SlabAlloc::NCLASSES; cls++) {
+		SlabClassCache &cc = tc->cl_[cls];
+		if (cc.head_ != NULL) {
+			slabToDepot(cls, cc.head_);
+			cc.head_ = NULL;
+			cc.count_ = 0;
+		}
+	}
+}
+
+// Called on the thread exit.
+static void slabCacheDestructor(void *arg)
+{
+	SlabThreadCache *tc = (SlabThreadCache *)arg;
+	slabFlush(tc);
+	slabCache = NULL;
+	free(tc);
+}
+
+static void slabInit()
+{
+	for (int cls = 0; cls < SlabAlloc::NCLASSES; cls++)
+		pthread_mutex_init(&slabDepotMutex[cls], NULL);
+	pthread_key_create(&slabCacheKey, slabCacheDestructor);
+}
+
+// @return - the current thread's cache, or NULL if can not allocate it
+static SlabThreadCache *slabGetCache()
+{
+	SlabThreadCache *tc = slabCache;
+	if (tc == NULL) {
+		pthread_once(&slabOnce, slabInit);
+		tc = (SlabThreadCache *)calloc(1, sizeof(SlabThreadCache));
+		if (tc == NULL)
+			return NULL;
+		slabCache = tc;
+		pthread_setspecific(slabCacheKey, tc);
+	}
+	return tc;
+}
+
+// Get a batch of blocks from the depot, or carve a new slab
+// if the depot is empty.
+// @param cls - size class
+// @param cc - the thread cache of this class, must be empty
+static void slabRefill(int cls, SlabClassCache &cc)
+{
+	int bsz = slabBatchSize(cls);
+
+	pthread_mutex_lock(&slabDepotMutex[cls]);
+	SlabFreeBlock *batch = slabDepot[cls];
+	if (batch != NULL) {
+		slabDepot[cls] = batch->nextBatch_;
+		pthread_mutex_unlock(&slabDepotMutex[cls]);
+
+		int n = 0;
+		for (SlabFreeBlock *b = batch; b != NULL; b = b->next_)
+			++n;
+		cc.head_ = batch;
+		cc.count_ = n;
+		return;
+	}
+	pthread_mutex_unlock(&slabDepotMutex[cls]);
+
+	char *slab = (char *)malloc(SlabAlloc::SLAB_SIZE);
+	if (slab == NULL)
+		return;
+	__atomic_add_fetch(&slabTotal, 1, __ATOMIC_RELAXED);
+
+	// the first batch goes to the thread, the rest to the depot
+	size_t blsz = slabBlockSize(cls);
+	int nblocks = (int)(SlabAlloc::SLAB_SIZE / blsz);
+	SlabFreeBlock *head = NULL;
+	for (int i = nblocks - 1; i >= 0; i--) {
+		SlabBlockHeader *hdr = (SlabBlockHeader *)(slab + i * blsz);
+		hdr->cls_ = cls;
+		SlabFreeBlock *b = (SlabFreeBlock *)(hdr + 1);
+		b->next_ = head;
+		head = b;
+	}
+
+	SlabFreeBlock *last = head;
+	int n = 1;
+	for (; n < bsz && last->next_ != NULL; n++)
+		last = last->next_;
+	SlabFreeBlock *rest = last->next_;
+	last->next_ = NULL;
+
+	cc.head_ = head;
+	cc.count_ = n;
+	if (rest != NULL)
+		slabToDepot(cls, rest);
+}
+
+void *SlabAlloc::alloc(size_t size)
+{
+	int cls = sizeClass(size);
+	SlabThreadCache *tc;
+	if (cls == 0 || (tc = slabGetCache()) == NULL) {
+		SlabBlockHeader *hdr = (SlabBlockHeader *)malloc(size + sizeof(SlabBlockHeader));
+		if (hdr == NULL)
+			return NULL;
+		hdr->cls_ = 0;
+		return hdr + 1;
+	}
+
+	SlabClassCache &cc = tc->cl_[cls];
+	if (cc.head_ == NULL) {
+		slabRefill(cls, cc);
+		if (cc.head_ == NULL)
+			return NULL;
+	}
+	SlabFreeBlock *b = cc.head_;
+	cc.head_ = b->next_;
+	--cc.count_;
+	return b;
+}
+
+void *SlabAlloc::allocZero(size_t size)
+{
+	void *ptr = alloc(size);
+	if (ptr != NULL)
+		memset(ptr, 0, size);
+	return ptr;
+}
+
+void SlabAlloc::release(void *ptr)
+{
+	if (ptr == NULL)
+		return;
+
+	SlabBlockHeader *hdr = slabHeader(ptr);
+	int cls = (int)hdr->cls_;
+	if (cls == 0) {
+		free(hdr);
+		return;
+	}
+
+	SlabFreeBlock *b = (SlabFreeBlock *)ptr;
+	SlabThreadCache *tc = slabGetCache();
+	if (tc == NULL) {
+		b->next_ = NULL;
+		slabToDepot(cls, b);
+		return;
+	}
+
+	SlabClassCache &cc = tc->cl_[cls];
+	b->next_ = cc.head_;
+	cc.head_ = b;
+	int bsz = slabBatchSize(cls);
+	if (++cc.count_ >= 2 * bsz) {
+		// move the blocks past the first batch to the depot
+		SlabFreeBlock *last = cc.head_;
+		for (int i = 1; i < bsz; i++)
+			last = last->next_;
+		SlabFreeBlock *rest = last->next_;
+		last->next_ = NULL;
+		cc.count_ = bsz;
+		slabToDepot(cls, rest);
+	}
+}
+
+void SlabAlloc::flushCache()
+{
+	SlabThreadCache *tc = slabCache;
+	if (tc != NULL)
+		slabFlush(tc);
+}
+
+size_t SlabAlloc::slabCount()
+{
+	return __atomic_load_n(&slabTotal, __ATOMIC_RELAXED);
+}
+
+#else // } TRICEPS_SLAB_ALLOC {
+
+void *SlabAlloc::alloc(size_t size)
+{
+	return malloc(size);
+}
+
+void *SlabAlloc::allocZero(size_t size)
+{
+	return calloc(1, size);
+}
+
+void SlabAlloc::release(void *ptr)
+{
+	free(ptr);
+}
+
+void SlabAlloc::flushCache()
+{ }
+
+size_t SlabAlloc::slabCount()
+{
+	return 0;
+}
+
+#endif // } TRICEPS_SLAB_ALLOC
+
+}; // TRICEPS_NS
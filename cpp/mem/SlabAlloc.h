@@ -0,0 +1,89 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// The size-class allocator for the small objects, such as rows and row handles.
+
+#ifndef __Triceps_SlabAlloc_h__
+#define __Triceps_SlabAlloc_h__
+
+#include <common/Common.h>
+
+namespace TRICEPS_NS {
+
+// The rows and row handles get allocated and freed at a high rate, and
+// going to malloc() for each of them is expensive, and also fragments the
+// memory in the long-running processes. This allocator groups the blocks
+// by the size classes and carves them out of the larger slabs.
+//
+// Each thread keeps a cache of the free blocks of each class, so normally
+// the allocation and freeing don't need any synchronization. When a thread's
+// cache of some class grows too large (such as when a thread keeps freeing
+// the rows that were created by another thread), a batch of the blocks gets
+// moved to the common depot, from where the other threads take them when
+// their caches run empty. When a thread exits, all its cached blocks go to
+// the depot. The slabs are never returned to the system, only reused.
+//
+// The blocks larger than MAX_SIZE get allocated with malloc().
+//
+// If TRICEPS_SLAB_ALLOC is defined as false, all the allocations go
+// directly to malloc(), which is convenient for debugging with valgrind.
+class SlabAlloc
+{
+public:
+	enum {
+		// the step between the size classes
+		GRAIN = 16,
+		// the largest block size that gets allocated from the slabs
+		MAX_SIZE = 1024,
+		// the number of the size classes, the class 0 is for the blocks
+		// allocated directly with malloc()
+		NCLASSES = MAX_SIZE / GRAIN + 1,
+		// the size of a slab
+		SLAB_SIZE = 64 * 1024,
+		// the approximate size of a batch of blocks that moves
+		// between a thread cache and the depot
+		BATCH_BYTES = 8 * 1024,
+	};
+
+	// Allocate a block. The block is aligned at least to 8 bytes.
+	// @param size - size of the block in bytes
+	// @return - the block, or NULL if the memory has ran out
+	static void *alloc(size_t size);
+
+	// Allocate a block filled with zeroes.
+	// @param size - size of the block in bytes
+	// @return - the block, or NULL if the memory has ran out
+	static void *allocZero(size_t size);
+
+	// Free a block. It may be freed in a different thread than
+	// the one that has allocated it.
+	// @param ptr - the block returned by alloc() or allocZero(), or NULL
+	static void release(void *ptr);
+
+	// Move all the blocks cached by the current thread to the depot.
+	// This gets done automatically when a thread exits.
+	static void flushCache();
+
+	// Get the number of the slabs allocated so far, for the statistics
+	// and tests. Always 0 if the slabs are disabled.
+	static size_t slabCount();
+
+	// Get the size class for a block size.
+	// @param size - size of the block in bytes
+	// @return - the class, 0 if too large for the slabs
+	static int sizeClass(size_t size)
+	{
+		if (size > MAX_SIZE)
+			return 0;
+		if (size == 0)
+			return 1;
+		return (int)((size + GRAIN - 1) / GRAIN);
+	}
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_SlabAlloc_h__
@@ -0,0 +1,28 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase mutexSingle;
+	driver.addcase(mutexSingle, "mutexSingle");
+
+	extern Utest::Testcase mutexContended;
+	driver.addcase(mutexContended, "mutexContended");
+
+	extern Utest::Testcase nsprSingle;
+	driver.addcase(nsprSingle, "nsprSingle");
+
+	extern Utest::Testcase nsprContended;
+	driver.addcase(nsprContended, "nsprContended");
+
+	extern Utest::Testcase stdSingle;
+	driver.addcase(stdSingle, "stdSingle");
+
+	extern Utest::Testcase stdContended;
+	driver.addcase(stdContended, "stdContended");
+
+	return driver.run();
+}
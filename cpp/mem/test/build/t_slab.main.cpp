@@ -0,0 +1,22 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase size_class;
+	driver.addcase(size_class, "size_class");
+
+	extern Utest::Testcase alloc;
+	driver.addcase(alloc, "alloc");
+
+	extern Utest::Testcase reuse;
+	driver.addcase(reuse, "reuse");
+
+	extern Utest::Testcase cross_thread;
+	driver.addcase(cross_thread, "cross_thread");
+
+	return driver.run();
+}
@@ -0,0 +1,138 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the performace of the atomic integer implementations, on the
+// reference counting pattern of the increases and decreases, in one
+// thread and with the contention from multiple threads.
+// By default it's configured to run fast at the cost of precision. To increase
+// the precision increase the number of iterations by setting the environment
+// variable:
+//   TRICEPS_PERF_COUNT=0x10000000 t_atomic_perf
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <utest/Utest.h>
+
+#include <mem/Atomic.h>
+
+#define DEFAULT_COUNT 100000
+#define NTHREADS 4
+
+static double now()
+{
+	timespec tm;
+	clock_gettime(CLOCK_REALTIME, &tm);
+	return (double)tm.tv_sec + (double)tm.tv_nsec / 1000000000.;
+}
+
+int64_t findRunCount()
+{
+	char *v = getenv("TRICEPS_PERF_COUNT");
+	if (v != NULL) {
+		long long n;
+		if (sscanf(v, "%lli", &n) == 1) {
+			return n;
+		}
+	}
+	return DEFAULT_COUNT;
+}
+
+template <class Atomic>
+void runInc(Atomic *a, int64_t n)
+{
+	for (int64_t i = 0; i < n; i++) {
+		a->inc();
+		a->dec();
+	}
+}
+
+template <class Atomic>
+void *runIncThread(void *arg)
+{
+	runInc((Atomic *)arg, findRunCount());
+	return NULL;
+}
+
+// One thread doing the pairs of increases and decreases.
+template <class Atomic>
+void perfSingle(Utest *utest)
+{
+	int64_t n = findRunCount();
+	Atomic a(1);
+
+	double tstart = now();
+	runInc(&a, n);
+	double tend = now();
+	UT_IS(a.get(), 1);
+	printf("        %lld iterations, %f seconds, %f iter per second\n", (long long)n, (tend-tstart), (double)n / (tend-tstart));
+}
+
+// Multiple threads doing the pairs of increases and decreases on the
+// same value, like with a row passed between the threads.
+template <class Atomic>
+void perfContended(Utest *utest)
+{
+	int64_t n = findRunCount();
+	Atomic a(1);
+	pthread_t th[NTHREADS];
+
+	double tstart = now();
+	for (int i = 0; i < NTHREADS; i++)
+		pthread_create(&th[i], NULL, runIncThread<Atomic>, &a);
+	for (int i = 0; i < NTHREADS; i++)
+		pthread_join(th[i], NULL);
+	double tend = now();
+	UT_IS(a.get(), 1);
+	printf("        %d threads, %lld iterations, %f seconds, %f iter per second\n", NTHREADS, (long long)n * NTHREADS, (tend-tstart), (double)n * NTHREADS / (tend-tstart));
+}
+
+UTESTCASE mutexSingle(Utest *utest)
+{
+	perfSingle<MutexAtomicInt>(utest);
+}
+
+UTESTCASE mutexContended(Utest *utest)
+{
+	perfContended<MutexAtomicInt>(utest);
+}
+
+UTESTCASE nsprSingle(Utest *utest)
+{
+#ifdef TRICEPS_NSPR
+	perfSingle<NsprAtomicInt>(utest);
+#else
+	printf("        NSPR is not used\n");
+#endif
+}
+
+UTESTCASE nsprContended(Utest *utest)
+{
+#ifdef TRICEPS_NSPR
+	perfContended<NsprAtomicInt>(utest);
+#else
+	printf("        NSPR is not used\n");
+#endif
+}
+
+UTESTCASE stdSingle(Utest *utest)
+{
+#ifdef TRICEPS_STD_ATOMIC_AVAILABLE
+	perfSingle<StdAtomicInt>(utest);
+#else
+	printf("        std::atomic is not used\n");
+#endif
+}
+
+UTESTCASE stdContended(Utest *utest)
+{
+#ifdef TRICEPS_STD_ATOMIC_AVAILABLE
+	perfContended<StdAtomicInt>(utest);
+#else
+	printf("        std::atomic is not used\n");
+#endif
+}
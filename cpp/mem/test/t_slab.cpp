@@ -0,0 +1,138 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the slab allocator.
+
+#include <utest/Utest.h>
+
+#include <mem/SlabAlloc.h>
+#include <pthread.h>
+#include <string.h>
+#include <vector>
+
+UTESTCASE size_class(Utest *utest)
+{
+	UT_IS(SlabAlloc::sizeClass(0), 1);
+	UT_IS(SlabAlloc::sizeClass(1), 1);
+	UT_IS(SlabAlloc::sizeClass(SlabAlloc::GRAIN), 1);
+	UT_IS(SlabAlloc::sizeClass(SlabAlloc::GRAIN+1), 2);
+	UT_IS(SlabAlloc::sizeClass(SlabAlloc::MAX_SIZE), SlabAlloc::NCLASSES-1);
+	UT_IS(SlabAlloc::sizeClass(SlabAlloc::MAX_SIZE+1), 0);
+}
+
+UTESTCASE alloc(Utest *utest)
+{
+	// all the sizes, including the ones going to malloc()
+	std::vector<char *> v;
+	for (size_t sz = 0; sz <= SlabAlloc::MAX_SIZE + 100; sz += 7) {
+		char *p = (char *)SlabAlloc::alloc(sz);
+		UT_ASSERT(p != NULL);
+		UT_IS(((intptr_t)p) % 8, 0);
+		memset(p, 0xFF, sz);
+		v.push_back(p);
+	}
+	for (size_t i = 0; i < v.size(); i++)
+		SlabAlloc::release(v[i]);
+	SlabAlloc::release(NULL); // does nothing
+
+	// the zeroed allocation
+	for (size_t sz = 1; sz <= SlabAlloc::MAX_SIZE + 100; sz += 7) {
+		char *p = (char *)SlabAlloc::allocZero(sz);
+		UT_ASSERT(p != NULL);
+		bool zero = true;
+		for (size_t i = 0; i < sz; i++)
+			if (p[i] != 0)
+				zero = false;
+		UT_ASSERT(zero);
+		SlabAlloc::release(p);
+	}
+}
+
+UTESTCASE reuse(Utest *utest)
+{
+	SlabAlloc::release(SlabAlloc::alloc(8));
+	if (SlabAlloc::slabCount() == 0)
+		return; // the slabs are disabled
+
+	// a freed block gets reused for the next allocation of the same class
+	void *p1 = SlabAlloc::alloc(100);
+	SlabAlloc::release(p1);
+	void *p2 = SlabAlloc::alloc(99);
+	UT_IS(p2, p1);
+	SlabAlloc::release(p2);
+
+	// many blocks, the slabs get reused after they're freed
+	const int N = 100*1000;
+	std::vector<void *> v(N);
+	for (int i = 0; i < N; i++)
+		v[i] = SlabAlloc::alloc(48);
+	for (int i = 0; i < N; i++)
+		SlabAlloc::release(v[i]);
+	size_t nslabs = SlabAlloc::slabCount();
+	for (int i = 0; i < N; i++)
+		v[i] = SlabAlloc::alloc(48);
+	for (int i = 0; i < N; i++)
+		SlabAlloc::release(v[i]);
+	UT_IS(SlabAlloc::slabCount(), nslabs);
+
+	// the flushed blocks go to the depot and come back from there
+	SlabAlloc::flushCache();
+	for (int i = 0; i < N; i++)
+		v[i] = SlabAlloc::alloc(48);
+	for (int i = 0; i < N; i++)
+		SlabAlloc::release(v[i]);
+	UT_IS(SlabAlloc::slabCount(), nslabs);
+}
+
+// The blocks get allocated in one thread and freed in another one.
+struct SlabXfer {
+	std::vector<void *> *blocks_;
+	size_t size_;
+};
+
+static void *slabFreeThread(void *arg)
+{
+	SlabXfer *x = (SlabXfer *)arg;
+	for (size_t i = 0; i < x->blocks_->size(); i++)
+		SlabAlloc::release((*x->blocks_)[i]);
+	return NULL;
+}
+
+static void *slabAllocThread(void *arg)
+{
+	SlabXfer *x = (SlabXfer *)arg;
+	for (size_t i = 0; i < x->blocks_->size(); i++)
+		(*x->blocks_)[i] = SlabAlloc::alloc(x->size_);
+	return NULL;
+}
+
+UTESTCASE cross_thread(Utest *utest)
+{
+	const int N = 50*1000;
+	std::vector<void *> v(N);
+	SlabXfer x;
+	x.blocks_ = &v;
+	x.size_ = 200;
+
+	size_t nslabs = 0;
+	for (int round = 0; round < 4; round++) {
+		pthread_t th;
+
+		pthread_create(&th, NULL, slabAllocThread, &x);
+		pthread_join(th, NULL);
+		for (int i = 0; i < N; i++)
+			UT_ASSERT(v[i] != NULL);
+
+		// the freeing thread passes the blocks on exit to the depot
+		pthread_create(&th, NULL, slabFreeThread, &x);
+		pthread_join(th, NULL);
+
+		if (round == 0)
+			nslabs = SlabAlloc::slabCount();
+		else
+			UT_IS(SlabAlloc::slabCount(), nslabs); // reused after the first round
+	}
+}
@@ -245,9 +245,10 @@ void FnReturn::RetLabel::execute(Rowop *arg) const
 		Xtray *xtray = fnret_->xtray_;
 		if (xtray != NULL) { // this means a writer facet
 			if (isBegin_) {
-				if (!xtray->empty()) {
+				if (!xtray->empty() && xtray->backIdx() >= 0) {
 					// beginning of the next transaction flushes the last transaction
-					fnret_->facet_->flushWriter();
+					// (or with coalescing, marks its end)
+					fnret_->facet_->endTransaction();
 					if ((xtray = fnret_->xtray_) == NULL)
 						goto done_xtray;
 				}
@@ -256,9 +257,9 @@ void FnReturn::RetLabel::execute(Rowop *arg) const
 			} else if (isEnd_) {
 				if (!type_->isRowEmpty(arg->getRow()) || arg->getOpcode() != Rowop::OP_INSERT) // add the non-empty _END_ into the Xtray
 					xtray->push_back(idx_, arg->getRow(), arg->getOpcode());
-				// flush right away
-				if (!xtray->empty()) {
-					fnret_->facet_->flushWriter();
+				// flush right away (or with coalescing, maybe later)
+				if (!xtray->empty() && xtray->backIdx() >= 0) {
+					fnret_->facet_->endTransaction();
 				}
 			} else {
 				xtray->push_back(idx_, arg->getRow(), arg->getOpcode());
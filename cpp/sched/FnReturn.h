@@ -359,6 +359,13 @@ protected:
 		xtray_.swap(other);
 	}
 
+	// Add a transaction boundary to the Xtray, used by the coalescing
+	// Facet. The Xtray must not be NULL.
+	void pushXtrayBoundary()
+	{
+		xtray_->push_back(-1, NULL, Rowop::OP_NOP);
+	}
+
 	// Set the relation to a Facet.
 	// Sets facet_ and the flags in the labels that represent _BEGIN_ and _END_.
 	void setFacet(Facet *fa);
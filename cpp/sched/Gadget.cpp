@@ -40,6 +40,9 @@ void Gadget::send(const Row *row, Rowop::Opcode opcode) const
 	if (row == NULL)
 		return; // nothing to do
 
+	if (mode_ == EM_CALL && !label_->hasChained() && !unit_->isTracing())
+		return; // the call of an unchained DummyLabel would do nothing anyway
+
 	if (mode_ != EM_IGNORE) {
 		Autoref<Rowop> rop = new Rowop(label_, opcode, row);
 		switch(mode_) {
@@ -94,6 +94,9 @@ protected:
 	// that would repeat the change the second time. Instead he should either do a
 	// translation on that tray or pick the records individually.
 	//
+	// In the EM_CALL mode, if nothing is chained to the label and the unit
+	// is not tracing, the rowop is not even created.
+	//
 	// @param row - row being sent, may be NULL which will be ignored and produce nothing
 	// @param opcode - opcode for rowop
 	// XXX later will add timestamp and sequence
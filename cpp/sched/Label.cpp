@@ -126,6 +126,34 @@ void Label::call(Unit *unit, Rowop *arg, const Label *chainedFrom) const
 
 	BusyCounter bm(recursion_);
 
+	if (unit->isTracing()) {
+		callTraced(unit, arg, chainedFrom);
+		return;
+	}
+
+	// The untraced path is the common case, so it's kept free of the
+	// tracer calls. A tracer set in the middle of the call will take
+	// effect starting with the next label called.
+	try {
+		execute(arg);
+	} catch (Exception e) {
+		Erref err = e.getErrors();
+		err.f("Called through the label '%s'.", getName().c_str());
+		throw; // the errors buffer got changed in place!
+	}
+	for (ChainedVec::const_iterator it = chained_.begin(); it != chained_.end(); ++it) {
+		try {
+			(*it)->call(unit, arg, this); // each of them can do their own chaining....
+		} catch (Exception e) {
+			Erref err = e.getErrors();
+			err.f("Called chained from the label '%s'.", getName().c_str());
+			throw; // the errors buffer got changed in place!
+		}
+	}
+}
+
+void Label::callTraced(Unit *unit, Rowop *arg, const Label *chainedFrom) const
+{
 	// XXX this code would be cleaner without exceptions...
 	try {
 		unit->trace(this, chainedFrom, arg, Unit::TW_BEFORE);
@@ -173,6 +173,10 @@ protected:
 	// chainedFrom - if this call is a result of chaining, the chain parent
 	void call(Unit *unit, Rowop *arg, const Label *chainedFrom = NULL) const;
 
+	// The part of call() after all the checks, when the unit has a tracer.
+	// Same arguments as for call().
+	void callTraced(Unit *unit, Rowop *arg, const Label *chainedFrom) const;
+
 	// Check for circular dependencies when adding a label.
 	// Goes recursively through all the chained labels reachable from
 	// here and looks for the target label. If found, builds a path
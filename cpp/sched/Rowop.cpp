@@ -85,6 +85,21 @@ Rowop::~Rowop()
 	}
 }
 
+void Rowop::reuse(const Label *label, Opcode op, const Row *row)
+{
+	assert(label);
+	if (row)
+		row->incref(); // before releasing the old one, in case if they're the same
+	if (row_) {
+		if (row_->decref() <= 0)
+			label_->getType()->destroyRow(const_cast<Row *>(row_));
+	}
+	label_ = label;
+	row_ = row;
+	opcode_ = op;
+	enqMode_ = Gadget::EM_FORK;
+}
+
 Valname opcodes[] = {
 	{ Rowop::OP_NOP, "OP_NOP" },
 	{ Rowop::OP_INSERT, "OP_INSERT" },
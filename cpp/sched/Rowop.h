@@ -73,6 +73,16 @@ public:
 
 	~Rowop();
 
+	// Reset the rowop to the new contents, for reusing it instead of
+	// allocating a new one. The caller must hold the only reference
+	// to this rowop (getref() == 1), or things will get very confusing
+	// for the other holders. The enqMode gets reset to EM_FORK.
+	//
+	// @param label - the new label
+	// @param op - the new opcode
+	// @param row - the new row (may be NULL)
+	void reuse(const Label *label, Opcode op, const Row *row);
+
 	Opcode getOpcode() const 
 	{
 		return opcode_;
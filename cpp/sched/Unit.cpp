@@ -11,6 +11,9 @@
 #include <common/StringUtil.h>
 #include <common/Exception.h>
 #include <type/CompactRowType.h>
+#include <algorithm>
+#include <string.h>
+#include <time.h>
 
 namespace TRICEPS_NS {
 
@@ -147,6 +150,143 @@ void Unit::StringNameTracer::execute(Unit *unit, const Label *label, const Label
 	buffer_->appendMsg(false, res);
 }
 
+///////////////////////////// Unit::ProfilingTracer //////////////////////////////////
+
+Unit::ProfilingTracer::LabelStats::LabelStats() :
+	calls_(0),
+	inclusiveNs_(0),
+	selfNs_(0),
+	maxNs_(0)
+{
+	memset(hist_, 0, sizeof(hist_));
+}
+
+Unit::ProfilingTracer::UnitStats::UnitStats() :
+	calls_(0),
+	selfNs_(0)
+{ }
+
+Unit::ProfilingTracer::ProfilingTracer() :
+	Tracer(NULL)
+{
+	stack_.reserve(64);
+}
+
+int64_t Unit::ProfilingTracer::now()
+{
+	timespec tm;
+	clock_gettime(CLOCK_MONOTONIC, &tm);
+	return (int64_t)tm.tv_sec * 1000000000 + tm.tv_nsec;
+}
+
+int Unit::ProfilingTracer::histBucket(int64_t ns)
+{
+	int b = 0;
+	for (; ns > 0 && b < HIST_SIZE-1; ns >>= 1)
+		b++;
+	return b;
+}
+
+void Unit::ProfilingTracer::execute(Unit *unit, const Label *label, const Label *fromLabel, Rowop *rop, TracerWhen when)
+{
+	if (when == TW_BEFORE) {
+		// If an exception had propagated through some labels, their
+		// frames have been left behind. A live frame of the same unit
+		// can't be at this depth or deeper, other than the parent of
+		// a chained label, so the rest are stale.
+		int depth = unit->getStackDepth();
+		while (!stack_.empty()) {
+			const Frame &top = stack_.back();
+			if (top.unit_ != unit || top.depth_ < depth
+			|| (top.depth_ == depth && fromLabel != NULL))
+				break;
+			stack_.pop_back();
+		}
+
+		StatsMap::iterator it = stats_.find(label);
+		if (it == stats_.end()) {
+			it = stats_.insert(make_pair(label, LabelStats())).first;
+			it->second.unitName_ = unit->getName();
+			it->second.labelName_ = label->getName();
+		}
+		Frame f;
+		f.label_ = label;
+		f.unit_ = unit;
+		f.depth_ = depth;
+		f.stats_ = &it->second;
+		f.childNs_ = 0;
+		stack_.push_back(f);
+		stack_.back().start_ = now(); // the last thing, to exclude the overhead
+	} else if (when == TW_AFTER) {
+		int64_t end = now();
+
+		// Normally the label will be on the top of the stack, but if an
+		// exception had propagated through some labels, their frames have
+		// been left behind, so throw them away.
+		size_t pos = stack_.size();
+		while (pos > 0 && stack_[pos-1].label_ != label)
+			--pos;
+		if (pos == 0)
+			return; // the call must have started before the last reset()
+		stack_.resize(pos);
+
+		Frame &f = stack_.back();
+		int64_t incl = end - f.start_;
+		LabelStats *st = f.stats_;
+		st->calls_++;
+		st->inclusiveNs_ += incl;
+		st->selfNs_ += incl - f.childNs_;
+		if (incl > st->maxNs_)
+			st->maxNs_ = incl;
+		st->hist_[histBucket(incl)]++;
+		stack_.pop_back();
+
+		if (!stack_.empty())
+			stack_.back().childNs_ += incl;
+	}
+	// The chained labels do their own TW_BEFORE and TW_AFTER, and their
+	// time gets subtracted from the self time of the parent just like
+	// for the nested calls, so the rest of the events need no handling.
+}
+
+// Sort the stats in the order of decreasing self time.
+template <class Stats>
+static bool cmpSelfNs(const Stats &a, const Stats &b)
+{
+	return a.selfNs_ > b.selfNs_;
+}
+
+void Unit::ProfilingTracer::snapshot(LabelStatsVec &res) const
+{
+	res.clear();
+	res.reserve(stats_.size());
+	for (StatsMap::const_iterator it = stats_.begin(); it != stats_.end(); ++it)
+		res.push_back(it->second);
+	stable_sort(res.begin(), res.end(), cmpSelfNs<LabelStats>);
+}
+
+void Unit::ProfilingTracer::snapshotUnits(UnitStatsVec &res) const
+{
+	res.clear();
+	typedef map<string, UnitStats> UnitMap;
+	UnitMap units;
+	for (StatsMap::const_iterator it = stats_.begin(); it != stats_.end(); ++it) {
+		UnitStats &us = units[it->second.unitName_];
+		us.unitName_ = it->second.unitName_;
+		us.calls_ += it->second.calls_;
+		us.selfNs_ += it->second.selfNs_;
+	}
+	for (UnitMap::iterator it = units.begin(); it != units.end(); ++it)
+		res.push_back(it->second);
+	stable_sort(res.begin(), res.end(), cmpSelfNs<UnitStats>);
+}
+
+void Unit::ProfilingTracer::reset()
+{
+	stats_.clear();
+	stack_.clear();
+}
+
 ///////////////////////////// Unit //////////////////////////////////
 
 Unit::Unit(const string &name) :
@@ -15,6 +15,7 @@
 #include <sched/FrameMark.h>
 #include <list>
 #include <map>
+#include <vector>
 
 namespace TRICEPS_NS {
 
@@ -408,6 +409,110 @@ public:
 		virtual void execute(Unit *unit, const Label *label, const Label *fromLabel, Rowop *rop, TracerWhen when);
 	};
 
+	// A tracer that doesn't record the trace as such but collects the
+	// per-label timing statistics: the number of calls, the inclusive time
+	// (from TW_BEFORE to TW_AFTER, including all the nested and chained calls),
+	// the self time (inclusive minus the inclusive time of the nested and chained
+	// calls), and a histogram of the inclusive times. The time is measured with
+	// clock_gettime(CLOCK_MONOTONIC), in nanoseconds.
+	//
+	// The statistics entry for a label is allocated on its first call,
+	// after that the tracing doesn't allocate any memory, other than
+	// occasionally growing the stack of the calls in progress.
+	//
+	// The labels are identified by their addresses, and the names are
+	// remembered on the first call. The tracer doesn't keep the references
+	// to the labels, so if a label gets destroyed and another one gets
+	// allocated at the same address, their statistics will get mixed.
+	// Call reset() after changing the label graph.
+	//
+	// If an exception propagates through the labels, their TW_AFTER never
+	// comes, and these calls get dropped from the statistics. Their frames
+	// get thrown away on the next call at the same or outer level
+	// in the same unit.
+	class ProfilingTracer : public Tracer
+	{
+	public:
+		enum {
+			// Number of buckets in the histogram. The bucket i contains the
+			// calls that took [2^(i-1), 2^i) nanoseconds, the bucket 0 those
+			// that took 0 ns, and the last bucket collects everything longer.
+			HIST_SIZE = 32,
+		};
+
+		// The statistics of one label.
+		class LabelStats
+		{
+		public:
+			LabelStats();
+
+			string unitName_; // name of the unit that called the label
+			string labelName_; // name of the label
+			int64_t calls_; // number of the completed calls
+			int64_t inclusiveNs_; // total inclusive time
+			int64_t selfNs_; // total self time
+			int64_t maxNs_; // the longest inclusive time of a single call
+			int64_t hist_[HIST_SIZE]; // histogram of the inclusive times
+		};
+		typedef vector<LabelStats> LabelStatsVec;
+
+		// The statistics summed up for a unit.
+		class UnitStats
+		{
+		public:
+			UnitStats();
+
+			string unitName_;
+			int64_t calls_; // number of the completed label calls
+			int64_t selfNs_; // total self time of all the labels
+		};
+		typedef vector<UnitStats> UnitStatsVec;
+
+		ProfilingTracer();
+
+		// from Tracer
+		virtual void execute(Unit *unit, const Label *label, const Label *fromLabel, Rowop *rop, TracerWhen when);
+
+		// Get a copy of the collected per-label statistics, in the
+		// order of the decreasing self time.
+		//
+		// @param res - vector to place the result into (the old contents is discarded)
+		void snapshot(LabelStatsVec &res) const;
+
+		// Get a copy of the statistics summed up by the unit names, in the
+		// order of the decreasing self time.
+		//
+		// @param res - vector to place the result into (the old contents is discarded)
+		void snapshotUnits(UnitStatsVec &res) const;
+
+		// Discard all the collected statistics and the calls in progress.
+		void reset();
+
+		// Get the histogram bucket for a time.
+		// @param ns - time in nanoseconds
+		static int histBucket(int64_t ns);
+
+		// Get the current monotonic time in nanoseconds.
+		static int64_t now();
+
+	protected:
+		// A call in progress.
+		struct Frame
+		{
+			const Label *label_;
+			const Unit *unit_; // used only for comparison
+			int depth_; // the unit's stack depth at TW_BEFORE
+			LabelStats *stats_;
+			int64_t start_; // time of TW_BEFORE
+			int64_t childNs_; // inclusive time of the nested calls
+		};
+		typedef vector<Frame> FrameVec;
+		typedef map<const Label *, LabelStats> StatsMap;
+
+		StatsMap stats_;
+		FrameVec stack_;
+	};
+
 	// Set the new tracer
 	void setTracer(Onceref<Tracer> tracer);
 
@@ -417,6 +522,13 @@ public:
 		return tracer_;
 	}
 
+	// Check whether a tracer is set. The labels use it to select
+	// between the traced and untraced call path.
+	bool isTracing() const
+	{
+		return !tracer_.isNull();
+	}
+
 	// A callback for the Label, to trace its execution
 	// May throw an Exception on fatal error.
 	void trace(const Label *label, const Label *fromLabel, Rowop *rop, TracerWhen when);
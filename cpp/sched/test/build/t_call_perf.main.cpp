@@ -0,0 +1,22 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase warmup;
+	driver.addcase(warmup, "warmup");
+
+	extern Utest::Testcase untraced;
+	driver.addcase(untraced, "untraced");
+
+	extern Utest::Testcase nullTracer;
+	driver.addcase(nullTracer, "nullTracer");
+
+	extern Utest::Testcase profilingTracer;
+	driver.addcase(profilingTracer, "profilingTracer");
+
+	return driver.run();
+}
@@ -276,6 +276,24 @@ UTESTCASE rowop(Utest *utest)
 	UT_IS(op1->getRow(), NULL);
 	UT_ASSERT(op2->getRow() != NULL);
 	UT_IS(op3->getRow(), r1.get());
+
+	// reusing
+	Autoref<Rowop> op4 = new Rowop(lab1, Rowop::OP_INSERT, r1, Gadget::EM_CALL);
+	UT_IS(r1->getref(), 3);
+	op4->reuse(lab2, Rowop::OP_DELETE, NULL);
+	UT_IS(r1->getref(), 2);
+	UT_IS(op4->getLabel(), lab2.get());
+	UT_IS(op4->getOpcode(), Rowop::OP_DELETE);
+	UT_IS(op4->getRow(), NULL);
+	UT_IS(op4->getEnqMode(), Gadget::EM_FORK);
+	op4->reuse(lab3, Rowop::OP_INSERT, r1);
+	UT_IS(r1->getref(), 3);
+	op4->reuse(lab3, Rowop::OP_INSERT, r1); // same row again
+	UT_IS(r1->getref(), 3);
+	UT_IS(op4->getLabel(), lab3.get());
+	UT_IS(op4->getRow(), r1.get());
+	op4 = NULL;
+	UT_IS(r1->getref(), 2);
 }
 
 #if 0 // {
@@ -1455,3 +1473,173 @@ Called through the label 'labrec'.\n");
 	Exception::abort_ = true; // restore back
 	Exception::enableBacktrace_ = true; // restore back
 }
+
+// A label that burns the CPU for a given time and then optionally
+// calls another label.
+class SpinLabel: public Label
+{
+public:
+	SpinLabel(Unit *unit, Onceref<RowType> rtype, const string &name,
+			int64_t spinNs, Onceref<Label> sub = NULL) :
+		Label(unit, rtype, name),
+		sub_(sub),
+		spinNs_(spinNs)
+	{ }
+
+	virtual void execute(Rowop *arg) const
+	{
+		int64_t end = Unit::ProfilingTracer::now() + spinNs_;
+		while (Unit::ProfilingTracer::now() < end)
+			{ }
+		if (!sub_.isNull())
+			unit_->call(new Rowop(sub_, arg->getOpcode(), arg->getRow()));
+	}
+
+	Autoref<Label> sub_;
+	int64_t spinNs_;
+};
+
+class ProfilingTracerGuts: public Unit::ProfilingTracer
+{
+public:
+	static size_t stackSize(Unit::ProfilingTracer *ptr)
+	{
+		const ProfilingTracerGuts *ptg = (ProfilingTracerGuts *)ptr;
+		return ptg->stack_.size();
+	}
+};
+
+UTESTCASE profilingTracer(Utest *utest)
+{
+	UT_IS(Unit::ProfilingTracer::histBucket(0), 0);
+	UT_IS(Unit::ProfilingTracer::histBucket(1), 1);
+	UT_IS(Unit::ProfilingTracer::histBucket(2), 2);
+	UT_IS(Unit::ProfilingTracer::histBucket(3), 2);
+	UT_IS(Unit::ProfilingTracer::histBucket(4), 3);
+	UT_IS(Unit::ProfilingTracer::histBucket(0x7FFFFFFFFFFFFFFFLL), Unit::ProfilingTracer::HIST_SIZE-1);
+
+	RowType::FieldVec fld;
+	mkfields(fld);
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	FdataVec dv;
+	mkfdata(dv);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+
+	Autoref<Unit> unit1 = new Unit("u");
+	Autoref<Unit::ProfilingTracer> ptr = new Unit::ProfilingTracer;
+	unit1->setTracer(ptr);
+
+	const int64_t ms = 1000*1000;
+	// "top" spins a little and calls "inner" that spins a lot,
+	// and "top" has "chained" chained from it that spins a medium amount
+	Autoref<Label> inner = new SpinLabel(unit1, rt1, "inner", 4*ms);
+	Autoref<Label> top = new SpinLabel(unit1, rt1, "top", ms/2, inner);
+	Autoref<Label> chained = new SpinLabel(unit1, rt1, "chained", 2*ms);
+	top->chain(chained);
+
+	for (int i = 0; i < 3; i++)
+		unit1->call(new Rowop(top, Rowop::OP_INSERT, r1));
+
+	Unit::ProfilingTracer::LabelStatsVec st;
+	ptr->snapshot(st);
+	if (UT_IS(st.size(), 3)) return;
+
+	// sorted by the self time
+	UT_IS(st[0].labelName_, "inner");
+	UT_IS(st[1].labelName_, "chained");
+	UT_IS(st[2].labelName_, "top");
+
+	for (int i = 0; i < 3; i++) {
+		UT_IS(st[i].unitName_, "u");
+		UT_IS(st[i].calls_, 3);
+		UT_ASSERT(st[i].selfNs_ <= st[i].inclusiveNs_);
+		UT_ASSERT(st[i].maxNs_ * 3 >= st[i].inclusiveNs_);
+		int64_t n = 0;
+		for (int j = 0; j < Unit::ProfilingTracer::HIST_SIZE; j++)
+			n += st[i].hist_[j];
+		UT_IS(n, 3);
+	}
+	UT_ASSERT(st[0].selfNs_ >= 12*ms);
+	UT_ASSERT(st[1].selfNs_ >= 6*ms);
+	UT_ASSERT(st[2].selfNs_ >= ms + ms/2);
+	// the nested and chained calls are included
+	UT_ASSERT(st[2].inclusiveNs_ >= st[0].inclusiveNs_ + st[1].inclusiveNs_ + st[2].selfNs_);
+	// but not the self time of the parent
+	UT_ASSERT(st[2].selfNs_ < st[1].selfNs_);
+
+	Unit::ProfilingTracer::UnitStatsVec ust;
+	ptr->snapshotUnits(ust);
+	if (UT_IS(ust.size(), 1)) return;
+	UT_IS(ust[0].unitName_, "u");
+	UT_IS(ust[0].calls_, 9);
+	UT_IS(ust[0].selfNs_, st[0].selfNs_ + st[1].selfNs_ + st[2].selfNs_);
+
+	// the other events don't affect anything
+	ptr->execute(unit1, inner, NULL, NULL, Unit::TW_AFTER_DRAIN);
+	// TW_AFTER with no matching TW_BEFORE gets ignored
+	ptr->execute(unit1, inner, NULL, NULL, Unit::TW_AFTER);
+	ptr->snapshot(st);
+	UT_IS(st[0].calls_, 3);
+
+	ptr->reset();
+	ptr->snapshot(st);
+	UT_IS(st.size(), 0);
+	ptr->snapshotUnits(ust);
+	UT_IS(ust.size(), 0);
+
+	// the frames left behind by an exception get dropped
+	Exception::abort_ = false; // make them catchable
+	Exception::enableBacktrace_ = false; // make the error messages predictable
+
+	Autoref<Label> thrower = new LabelThrowOnCall(unit1, rt1, "thrower");
+	Autoref<Label> bad = new SpinLabel(unit1, rt1, "bad", 0, thrower);
+	for (int i = 0; i < 3; i++) {
+		string msg;
+		try {
+			unit1->call(new Rowop(bad, Rowop::OP_INSERT, r1));
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_ASSERT(msg != "");
+		UT_IS(ProfilingTracerGuts::stackSize(ptr), 2); // the stale frames of "bad" and "thrower"
+	}
+
+	unit1->call(new Rowop(top, Rowop::OP_INSERT, r1));
+	UT_IS(ProfilingTracerGuts::stackSize(ptr), 0);
+
+	ptr->snapshot(st);
+	if (UT_IS(st.size(), 5)) return;
+	UT_IS(st[0].labelName_, "inner");
+	UT_IS(st[1].labelName_, "chained");
+	UT_IS(st[2].labelName_, "top");
+	for (int i = 0; i < 3; i++)
+		UT_IS(st[i].calls_, 1);
+	for (int i = 3; i < 5; i++) {
+		UT_IS(st[i].calls_, 0);
+		UT_IS(st[i].inclusiveNs_, 0);
+	}
+	// the nested calls are subtracted from the right parent
+	UT_ASSERT(st[2].selfNs_ >= ms/2);
+	UT_ASSERT(st[2].selfNs_ < st[1].selfNs_);
+	UT_ASSERT(st[2].inclusiveNs_ >= st[0].inclusiveNs_ + st[1].inclusiveNs_ + st[2].selfNs_);
+
+	// a call that ends with TW_AFTER for a label in the middle of the
+	// stack drops the frames above it too
+	ptr->execute(unit1, top, NULL, NULL, Unit::TW_BEFORE);
+	try {
+		unit1->call(new Rowop(bad, Rowop::OP_INSERT, r1)); // never finishes
+	} catch (Exception e) {
+	}
+	ptr->execute(unit1, top, NULL, NULL, Unit::TW_AFTER);
+	UT_IS(ProfilingTracerGuts::stackSize(ptr), 0);
+	ptr->snapshot(st);
+	UT_IS(st[2].labelName_, "top");
+	UT_IS(st[2].calls_, 2);
+
+	Exception::abort_ = true; // restore back
+	Exception::enableBacktrace_ = true; // restore back
+
+	unit1->clearLabels();
+}
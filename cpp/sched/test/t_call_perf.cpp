@@ -0,0 +1,110 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the performance of the label calls through a chain of labels,
+// with and without a tracer.
+// By default it's configured to run fast at the cost of precision. To increase
+// the precision increase the number of iterations by setting the environment
+// variable:
+//   TRICEPS_PERF_COUNT=0x1000000 t_call_perf
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <utest/Utest.h>
+
+#include <type/CompactRowType.h>
+#include <sched/Unit.h>
+
+#define DEFAULT_COUNT 10000
+#define CHAIN_LEN 10
+
+static double now()
+{
+	timespec tm;
+	clock_gettime(CLOCK_REALTIME, &tm);
+	return (double)tm.tv_sec + (double)tm.tv_nsec / 1000000000.;
+}
+
+int64_t findRunCount()
+{
+	char *v = getenv("TRICEPS_PERF_COUNT");
+	if (v != NULL) {
+		long long n;
+		if (sscanf(v, "%lli", &n) == 1) {
+			return n;
+		}
+	}
+	return DEFAULT_COUNT;
+}
+
+// A tracer that does nothing, to measure the overhead of the tracing as such.
+class NullTracer : public Unit::Tracer
+{
+public:
+	virtual void execute(Unit *unit, const Label *label,
+		const Label *fromLabel, Rowop *rop, Unit::TracerWhen when)
+	{ }
+};
+
+// Build a chain of CHAIN_LEN labels and call its head n times.
+// @param tracer - tracer to set in the unit, may be NULL
+static void runChain(Utest *utest, Onceref<Unit::Tracer> tracer)
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("a", Type::r_int32));
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	FdataVec dv;
+	int32_t v = 1;
+	dv.push_back(Fdata(true, &v, sizeof(v)));
+	Rowref r1(rt1, rt1->makeRow(dv));
+
+	Autoref<Unit> unit = new Unit("u");
+	unit->setTracer(tracer);
+
+	Autoref<Label> head = new DummyLabel(unit, rt1, "lb0");
+	Autoref<Label> prev = head;
+	for (int i = 1; i < CHAIN_LEN; i++) {
+		Autoref<Label> lb = new DummyLabel(unit, rt1, strprintf("lb%d", i));
+		prev->chain(lb);
+		prev = lb;
+	}
+
+	Autoref<Rowop> op = new Rowop(head, Rowop::OP_INSERT, r1);
+
+	int64_t n = findRunCount();
+	double tstart = now();
+	for (int64_t i = 0; i < n; i++) {
+		unit->call(op);
+	}
+	double tend = now();
+	printf("        %lld calls of %d-label chain, %f seconds, %f label calls per second\n",
+		(long long)n, CHAIN_LEN, (tend-tstart), (double)n * CHAIN_LEN / (tend-tstart));
+
+	unit->clearLabels();
+}
+
+UTESTCASE warmup(Utest *utest)
+{
+	runChain(utest, NULL);
+}
+
+UTESTCASE untraced(Utest *utest)
+{
+	runChain(utest, NULL);
+}
+
+UTESTCASE nullTracer(Utest *utest)
+{
+	runChain(utest, new NullTracer);
+}
+
+UTESTCASE profilingTracer(Utest *utest)
+{
+	runChain(utest, new Unit::ProfilingTracer);
+}
@@ -0,0 +1,163 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Collapse of multiple sequential updates into one.
+
+#include <table/Collapse.h>
+#include <type/HashedIndexType.h>
+#include <mem/Rhref.h>
+#include <common/Exception.h>
+
+namespace TRICEPS_NS {
+
+////////////////////////////////////// Collapse::InputLabel ////////////////////////////////////
+
+Collapse::InputLabel::InputLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, Collapse *collapse) :
+	Label(unit, rtype, name),
+	collapse_(collapse)
+{ }
+
+void Collapse::InputLabel::execute(Rowop *arg) const
+{
+	collapse_->collect(arg->getOpcode(), arg->getRow());
+}
+
+void Collapse::InputLabel::clearSubclass()
+{
+	collapse_ = NULL;
+}
+
+////////////////////////////////////// Collapse::FlushLabel ////////////////////////////////////
+
+Collapse::FlushLabel::FlushLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, Collapse *collapse) :
+	Label(unit, rtype, name),
+	collapse_(collapse)
+{ }
+
+void Collapse::FlushLabel::execute(Rowop *arg) const
+{
+	collapse_->flush();
+}
+
+void Collapse::FlushLabel::clearSubclass()
+{
+	collapse_ = NULL;
+}
+
+////////////////////////////////////// Collapse ////////////////////////////////////
+
+Collapse::Collapse(Unit *unit, const string &name, const string &dsetName,
+		const RowType *rt, Onceref<NameSet> key) :
+	Gadget(unit, Gadget::EM_CALL, name + "." + dsetName + ".out", rt),
+	inputLabel_(new InputLabel(unit, rt, name + "." + dsetName + ".in", this)),
+	key_(key),
+	name_(name),
+	dsetName_(dsetName),
+	initialized_(false)
+{ }
+
+void Collapse::initialize()
+{
+	if (initialized_)
+		return;
+	initialized_ = true;
+
+	errors_ = new Errors;
+
+	if (key_.isNull() || key_->empty()) {
+		errors_.f("the key must not be empty");
+		return;
+	}
+
+	tabType_ = TableType::make(const_cast<RowType *>(type_.get()))
+		->addSubIndex("primary", HashedIndexType::make(key_));
+	tabType_->initialize();
+	if (errors_.fAppend(tabType_->getErrors(), "the collapse table type is invalid:"))
+		return;
+
+	string prefix = name_ + "." + dsetName_;
+	tbInsert_ = tabType_->makeTable(unit_, prefix + ".tbInsert");
+	tbDelete_ = tabType_->makeTable(unit_, prefix + ".tbDelete");
+
+	if (!errors_->hasError() && errors_->isEmpty())
+		errors_ = NULL;
+}
+
+void Collapse::checkInitialized() const
+{
+	if (!initialized_ || tbInsert_.isNull())
+		throw Exception::fTrace("Collapse '%s' was not successfully initialized", name_.c_str());
+}
+
+void Collapse::collect(Rowop::Opcode opcode, const Row *row)
+{
+	checkInitialized();
+
+	if (Rowop::isInsert(opcode)) {
+		// Simply add to the insert table: the effect is the same, independently of
+		// whether the row was previously deleted or not. This also handles correctly
+		// multiple inserts without a delete between them, even though this kind of
+		// input is not really expected.
+		tbInsert_->insertRow(row);
+	} else if (Rowop::isDelete(opcode)) {
+		// If there was a row in the insert table, delete that row (undoing the previous insert).
+		// Otherwise it means that there was no previous insert seen in this round, so this must be a
+		// deletion of a row inserted in the previous round, so insert it into the delete table.
+		if (!tbInsert_->deleteRow(row))
+			tbDelete_->insertRow(row);
+	}
+}
+
+void Collapse::flushTable(Table *tab, Rowop::Opcode opcode)
+{
+	Rhref rh(tab, tab->begin());
+	while (!rh.isNull()) {
+		Rhref next(tab, tab->next(rh)); // advance the iterator before removing
+		tab->remove(rh);
+		send(rh->getRow(), opcode);
+		rh = next;
+	}
+}
+
+void Collapse::flush()
+{
+	checkInitialized();
+
+	// send the deletes always before the inserts
+	flushTable(tbDelete_, Rowop::OP_DELETE);
+	flushTable(tbInsert_, Rowop::OP_INSERT);
+}
+
+Label *Collapse::flushOn(Label *lb)
+{
+	if (lb->getUnitPtr() != unit_)
+		throw Exception::fTrace("Collapse '%s' can not flush on the label '%s' from a different unit",
+			name_.c_str(), lb->getName().c_str());
+
+	Autoref<Label> flab = new FlushLabel(unit_, lb->getType(), name_ + "." + dsetName_ + ".flush", this);
+	Erref err = lb->chain(flab);
+	if (err->hasError())
+		throw Exception::f(err, "Collapse '%s' failed to chain the flush label:", name_.c_str());
+	return flab;
+}
+
+FnReturn *Collapse::fnReturn() const
+{
+	if (fnReturn_.isNull()) {
+		checkInitialized();
+		fnReturn_ = FnReturn::make(unit_, name_ + ".fret")
+			->addFromLabel(dsetName_, label_)
+		;
+		try {
+			initializeOrThrow(fnReturn_);
+		} catch (Exception e) {
+			throw Exception::f(e, "Failed to create an FnReturn on Collapse '%s':", name_.c_str());
+		}
+	}
+	return fnReturn_;
+}
+
+}; // TRICEPS_NS
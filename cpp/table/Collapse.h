@@ -0,0 +1,192 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Collapse of multiple sequential updates into one.
+
+#ifndef __Triceps_Collapse_h__
+#define __Triceps_Collapse_h__
+
+#include <table/Table.h>
+#include <type/NameSet.h>
+
+namespace TRICEPS_NS {
+
+// The Collapse collects multiple changes on each key into at most one
+// DELETE and one INSERT, matching the final result after all the
+// modifications, and sends them out on flush(). This allows to skip the
+// intermediate updates, if only the end result is of interest, such as
+// before sending the data through a nexus.
+//
+// It's the C++ version of the Perl Triceps::Collapse, with one dataset.
+// Same as in the Perl version, the data is kept in two tables with a
+// hashed index on the key: one for the inserts and one for the deletes.
+// An INSERT followed by a DELETE of the same key cancel each other out,
+// a DELETE followed by an INSERT become a DELETE of the original row
+// and an INSERT of the final row on flush.
+//
+// The typical construction is done as a chain:
+// collapse = initializeOrThrow(Collapse::make(unit, "collapse", "idata", rt,
+//     NameSet::make()->add("local_ip")->add("remote_ip"))
+// );
+//
+// The collapsed rows are sent with the EM_CALL mode.
+//
+// Like in the LookupJoin, the input label holds a reference to the
+// Collapse, so the Collapse stays alive for as long as its input label
+// is not cleared. The same applies to the flush labels.
+class Collapse : public Gadget
+{
+public:
+	// @param unit - unit where the collapse belongs
+	// @param name - name of the collapse, used as a prefix for the label names
+	// @param dsetName - name of the dataset, the input label will be named
+	//        "name.dsetName.in", the output label "name.dsetName.out"
+	// @param rt - type of the rows in the dataset
+	// @param key - the key fields of the data, same as for a HashedIndexType
+	Collapse(Unit *unit, const string &name, const string &dsetName,
+		const RowType *rt, Onceref<NameSet> key);
+
+	// Constructor duplicated as make() for syntactically better usage.
+	static Collapse *make(Unit *unit, const string &name, const string &dsetName,
+		const RowType *rt, Onceref<NameSet> key)
+	{
+		return new Collapse(unit, name, dsetName, rt, key);
+	}
+
+	// Check the definition and create the tables.
+	// The errors are returned by getErrors().
+	// May be called repeatedly with no ill effects.
+	void initialize();
+
+	bool isInitialized() const
+	{
+		return initialized_;
+	}
+
+	// Get the errors collected during initialization.
+	Erref getErrors() const
+	{
+		return errors_;
+	}
+
+	// Get back the name (overrides the gadget method, because that
+	// name has the dataset and ".out" added to it).
+	const string &getName() const
+	{
+		return name_;
+	}
+
+	const string &getDatasetName() const
+	{
+		return dsetName_;
+	}
+
+	const RowType *getRowType() const
+	{
+		return type_.get();
+	}
+
+	const NameSet *getKey() const
+	{
+		return key_;
+	}
+
+	// Get the label for sending the rowops into the collapse.
+	Label *getInputLabel() const
+	{
+		return inputLabel_.get();
+	}
+
+	// Get the output label. It's the same as the gadget's label.
+	Label *getOutputLabel() const
+	{
+		return label_.get();
+	}
+
+	// Send out the collected data: first all the DELETEs, then all the
+	// INSERTs, and clear it.
+	// Throws an Exception if not initialized yet.
+	void flush();
+
+	// Create a label that calls flush() on any rowop, and chain it to another
+	// label. The typical use is to flush automatically on the _END_ label of
+	// a facet, at the end of each transaction.
+	// May be used at any time, including after the initialization.
+	// @param lb - the label to chain from, it must belong to the same unit
+	// @return - the created flush label, named "name.dsetName.flush"
+	Label *flushOn(Label *lb);
+
+	// Get the FnReturn for this collapse. It gets created on the first
+	// call and contains one label, named after the dataset. Throws an
+	// Exception if the collapse is not initialized yet.
+	FnReturn *fnReturn() const;
+
+protected:
+	class InputLabel: public Label
+	{
+		friend class Collapse;
+	public:
+		InputLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, Collapse *collapse);
+
+	protected:
+		// from Label
+		virtual void execute(Rowop *arg) const;
+		// from Label
+		// Drops the reference to the collapse, breaking the cycle.
+		virtual void clearSubclass();
+
+		Autoref<Collapse> collapse_;
+	};
+
+	class FlushLabel: public Label
+	{
+		friend class Collapse;
+	public:
+		FlushLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, Collapse *collapse);
+
+	protected:
+		// from Label
+		virtual void execute(Rowop *arg) const;
+		// from Label
+		// Drops the reference to the collapse, breaking the cycle.
+		virtual void clearSubclass();
+
+		Autoref<Collapse> collapse_;
+	};
+
+	// Handle one incoming rowop.
+	// Throws an Exception if not initialized yet.
+	// @param opcode - opcode of the rowop
+	// @param row - the row
+	void collect(Rowop::Opcode opcode, const Row *row);
+
+	// Send all the rows from a table with an opcode, removing them from the table.
+	// @param tab - the table to empty
+	// @param opcode - opcode to send with the rows
+	void flushTable(Table *tab, Rowop::Opcode opcode);
+
+	// Throw an Exception if not initialized successfully.
+	void checkInitialized() const;
+
+	Autoref<InputLabel> inputLabel_;
+	Autoref<NameSet> key_;
+	Autoref<TableType> tabType_; // type of both tables
+	Autoref<Table> tbInsert_; // the rows to insert on flush
+	Autoref<Table> tbDelete_; // the rows to delete on flush
+	mutable Autoref<FnReturn> fnReturn_; // created on demand
+	Erref errors_;
+	string name_; // base name of the collapse
+	string dsetName_; // name of the dataset
+	bool initialized_;
+
+private:
+	Collapse(const Collapse &);
+	void operator=(const Collapse &);
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_Collapse_h__
@@ -0,0 +1,212 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of the FIFO storage with a limit, as a ring buffer.
+
+#include <table/FifoRingIndex.h>
+#include <type/TableType.h>
+
+namespace TRICEPS_NS {
+
+// The initial capacity of the buffer, unless the limit is smaller.
+static const size_t INIT_CAPACITY = 8;
+
+FifoRingIndex::FifoRingIndex(const TableType *tabtype, Table *table, const FifoIndexType *mytype) :
+	Index(tabtype, table),
+	type_(mytype),
+	head_(0),
+	size_(0)
+{ }
+
+FifoRingIndex::~FifoRingIndex()
+{
+	// the Table will take care of the records
+}
+
+void FifoRingIndex::clearData()
+{
+	Ring empty;
+	ring_.swap(empty); // frees the memory, unlike clear()
+	head_ = size_ = 0;
+}
+
+const IndexType *FifoRingIndex::getType() const
+{
+	return type_;
+}
+
+RowHandle *FifoRingIndex::begin() const
+{
+	if (size_ == 0)
+		return NULL;
+	if (type_->isReverse())
+		return ring_[slot(size_ - 1)];
+	else
+		return ring_[head_];
+}
+
+RowHandle *FifoRingIndex::next(const RowHandle *cur) const
+{
+	if (cur == NULL || !cur->isInTable())
+		return NULL;
+
+	size_t off = offset(getSection(cur)->pos_);
+	if (type_->isReverse()) {
+		if (off == 0)
+			return NULL;
+		return ring_[slot(off - 1)];
+	} else {
+		if (off + 1 >= size_)
+			return NULL;
+		return ring_[slot(off + 1)];
+	}
+}
+
+RowHandle *FifoRingIndex::last() const
+{
+	if (size_ == 0)
+		return NULL;
+	if (type_->isReverse())
+		return ring_[head_];
+	else
+		return ring_[slot(size_ - 1)];
+}
+
+const GroupHandle *FifoRingIndex::nextGroup(const GroupHandle *cur) const
+{
+	return NULL;
+}
+
+const GroupHandle *FifoRingIndex::beginGroup() const
+{
+	return NULL;
+}
+
+const GroupHandle *FifoRingIndex::toGroup(const RowHandle *cur) const
+{
+	return NULL;
+}
+
+RowHandle *FifoRingIndex::find(const RowHandle *what) const
+{
+	// Find by sequential comparison of whole rows
+	const Row *rwhat = what->getRow();
+	const RowType *rt = type_->getTabtype()->rowType();
+	for (size_t i = 0; i < size_; i++) {
+		RowHandle *curh = ring_[slot(i)];
+		if (rt->equalRows(rwhat, curh->getRow()))
+			return curh;
+	}
+	return NULL; // not found
+}
+
+Index *FifoRingIndex::findNested(const RowHandle *what, int nestPos) const
+{
+	return NULL;
+}
+
+bool FifoRingIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
+{
+	size_t limit = type_->getLimit();
+
+	// Check if there is any row already marked for replacement and present in this index, 
+	// then don't push out another one.
+	size_t subtract = 0;
+	for (RhSet::iterator it = replaced.begin(); it != replaced.end(); ++it) {
+		Index *rind = type_->findInstance(table_, *it);
+		if (rind == this)
+			++subtract; // it belongs here, so a record will be already pushed out
+	}
+
+	if (size_ - subtract >= limit && size_ >= subtract) { // this works well only with one-at-a-time inserts
+		if (type_->isJumping()) {
+			for (size_t i = 0; i < size_; i++)
+				replaced.insert(ring_[slot(i)]); 
+		} else {
+			replaced.insert(ring_[head_]); 
+		}
+	}
+		
+	return true;
+}
+
+void FifoRingIndex::grow()
+{
+	size_t cap = ring_.size();
+	size_t limit = type_->getLimit();
+	size_t newcap;
+	if (cap == 0)
+		newcap = (limit < INIT_CAPACITY? limit : INIT_CAPACITY);
+	else if (cap >= limit || cap * 2 < limit)
+		newcap = cap * 2; // normally the size doesn't go past the limit but just in case
+	else
+		newcap = limit;
+
+	Ring nring(newcap, NULL);
+	for (size_t i = 0; i < size_; i++) {
+		RowHandle *rh = ring_[slot(i)];
+		nring[i] = rh;
+		getSection(rh)->pos_ = i;
+	}
+	ring_.swap(nring);
+	head_ = 0;
+}
+
+void FifoRingIndex::insert(RowHandle *rh)
+{
+	if (size_ == ring_.size())
+		grow();
+
+	place(slot(size_), rh);
+	++size_;
+}
+
+void FifoRingIndex::remove(RowHandle *rh)
+{
+	size_t off = offset(getSection(rh)->pos_);
+
+	if (off == 0) {
+		// the usual case of pushing out the oldest row
+		ring_[head_] = NULL;
+		if (++head_ == ring_.size())
+			head_ = 0;
+	} else if (off + 1 == size_) {
+		ring_[slot(off)] = NULL;
+	} else if (off < size_ / 2) {
+		// move the older rows up by one
+		for (size_t i = off; i > 0; i--)
+			place(slot(i), ring_[slot(i - 1)]);
+		ring_[head_] = NULL;
+		if (++head_ == ring_.size())
+			head_ = 0;
+	} else {
+		// move the newer rows down by one
+		for (size_t i = off; i + 1 < size_; i++)
+			place(slot(i), ring_[slot(i + 1)]);
+		ring_[slot(size_ - 1)] = NULL;
+	}
+	getSection(rh)->pos_ = 0;
+
+	if (--size_ == 0)
+		head_ = 0;
+}
+
+void FifoRingIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already)
+{ 
+	// nothing to do
+}
+
+void FifoRingIndex::aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future)
+{ 
+	// nothing to do
+}
+
+bool FifoRingIndex::collapse(Tray *dest, const RhSet &replaced)
+{
+	return true;
+}
+
+}; // TRICEPS_NS
@@ -0,0 +1,101 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of the FIFO storage with a limit, as a ring buffer.
+
+#ifndef __Triceps_FifoRingIndex_h__
+#define __Triceps_FifoRingIndex_h__
+
+#include <table/Index.h>
+#include <type/FifoIndexType.h>
+
+namespace TRICEPS_NS {
+
+// The FifoIndexType with a limit creates this index instead of the FifoIndex.
+// The row handles are kept in a ring buffer, so the pushing out of the
+// oldest row doesn't need to touch its neighbours, and the iteration goes
+// through the sequential memory. The buffer grows as needed, up to the
+// limit, so the small groups don't waste the memory.
+//
+// The removal of a row from the middle (such as by an explicit delete) has
+// to shift the part of the buffer on the shorter side of it, which is
+// O(limit) but the limited FIFOs are normally small.
+class FifoRingIndex: public Index
+{
+	friend class FifoIndexType;
+public:
+	// @param tabtype - type of table where this index belongs
+	// @param table - the actual table where this index belongs
+	// @param mytype - type that created this index
+	FifoRingIndex(const TableType *tabtype, Table *table, const FifoIndexType *mytype);
+	~FifoRingIndex();
+
+	// from Index
+	virtual void clearData();
+	virtual const IndexType *getType() const;
+	virtual RowHandle *begin() const;
+	virtual RowHandle *next(const RowHandle *cur) const;
+	virtual RowHandle *last() const;
+	virtual const GroupHandle *nextGroup(const GroupHandle *cur) const;
+	virtual const GroupHandle *beginGroup() const;
+	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
+	virtual RowHandle *find(const RowHandle *what) const;
+	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
+	virtual void insert(RowHandle *rh);
+	virtual void remove(RowHandle *rh);
+	virtual void aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already);
+	virtual void aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future);
+	virtual bool collapse(Tray *dest, const RhSet &replaced);
+	virtual Index *findNested(const RowHandle *what, int nestPos) const;
+
+protected:
+	typedef FifoIndexType::RhRingSection RhSection;
+	typedef vector<RowHandle *> Ring;
+
+	// Get the section in the row handle
+	RhSection *getSection(const RowHandle *rh) const
+	{
+		return type_->getRingSection(rh);
+	}
+
+	// Convert the offset from the oldest row to the slot in the buffer.
+	size_t slot(size_t off) const
+	{
+		size_t pos = head_ + off;
+		if (pos >= ring_.size())
+			pos -= ring_.size();
+		return pos;
+	}
+
+	// Convert the slot in the buffer to the offset from the oldest row.
+	size_t offset(size_t pos) const
+	{
+		if (pos >= head_)
+			return pos - head_;
+		else
+			return pos + ring_.size() - head_;
+	}
+
+	// Put a row handle into a slot.
+	void place(size_t pos, RowHandle *rh)
+	{
+		ring_[pos] = rh;
+		getSection(rh)->pos_ = pos;
+	}
+
+	// Make the buffer bigger when it's full, moving the oldest row
+	// to the slot 0.
+	void grow();
+
+	Autoref<const FifoIndexType> type_; // type of this index
+	Ring ring_; // the buffer, its size is the current capacity
+	size_t head_; // slot of the oldest row
+	size_t size_; // the current number of rows
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_FifoRingIndex_h__
@@ -0,0 +1,114 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of a hashed primary key.
+
+#include <table/HashedIndex.h>
+#include <type/RowType.h>
+
+namespace TRICEPS_NS {
+
+//////////////////////////// HashedIndex /////////////////////////
+
+HashedIndex::HashedIndex(const TableType *tabtype, Table *table, const HashedIndexType *mytype) :
+	Index(tabtype, table),
+	type_(mytype),
+	data_(mytype)
+{ }
+
+HashedIndex::~HashedIndex()
+{
+	assert(data_.empty());
+}
+
+void HashedIndex::clearData()
+{
+	data_.clear();
+}
+
+const IndexType *HashedIndex::getType() const
+{
+	return type_;
+}
+
+RowHandle *HashedIndex::begin() const
+{
+	return data_.first();
+}
+
+RowHandle *HashedIndex::next(const RowHandle *cur) const
+{
+	if (cur == NULL || !cur->isInTable())
+		return NULL;
+
+	return data_.next(cur);
+}
+
+RowHandle *HashedIndex::last() const
+{
+	return data_.last();
+}
+
+const GroupHandle *HashedIndex::nextGroup(const GroupHandle *cur) const
+{
+	return NULL;
+}
+
+const GroupHandle *HashedIndex::beginGroup() const
+{
+	return NULL;
+}
+
+const GroupHandle *HashedIndex::toGroup(const RowHandle *cur) const
+{
+	return NULL;
+}
+
+RowHandle *HashedIndex::find(const RowHandle *what) const
+{
+	return data_.find(what);
+}
+
+Index *HashedIndex::findNested(const RowHandle *what, int nestPos) const
+{
+	return NULL;
+}
+
+bool HashedIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
+{
+	RowHandle *old = data_.find(rh);
+	// XXX for now just silently replace the old value with the same key
+	if (old != NULL)
+		replaced.insert(old);
+	return true;
+}
+
+void HashedIndex::insert(RowHandle *rh)
+{
+	data_.insert(rh);
+}
+
+void HashedIndex::remove(RowHandle *rh)
+{
+	data_.erase(rh);
+}
+
+void HashedIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already)
+{ 
+	// nothing to do
+}
+
+void HashedIndex::aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future)
+{ 
+	// nothing to do
+}
+
+bool HashedIndex::collapse(Tray *dest, const RhSet &replaced)
+{
+	return true;
+}
+
+}; // TRICEPS_NS
@@ -0,0 +1,56 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of a hashed primary key.
+
+#ifndef __Triceps_HashedIndex_h__
+#define __Triceps_HashedIndex_h__
+
+#include <table/Index.h>
+#include <table/HashedSet.h>
+#include <type/HashedIndexType.h>
+
+namespace TRICEPS_NS {
+
+class RowType;
+
+class HashedIndex: public Index
+{
+	friend class HashedIndexType;
+
+public:
+	// @param tabtype - type of table where this index belongs
+	// @param table - the actual table where this index belongs
+	// @param mytype - type that created this index
+	HashedIndex(const TableType *tabtype, Table *table, const HashedIndexType *mytype);
+	~HashedIndex();
+
+	// from Index
+	virtual void clearData();
+	virtual const IndexType *getType() const;
+	virtual RowHandle *begin() const;
+	virtual RowHandle *next(const RowHandle *cur) const;
+	virtual RowHandle *last() const;
+	virtual const GroupHandle *nextGroup(const GroupHandle *cur) const;
+	virtual const GroupHandle *beginGroup() const;
+	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
+	virtual RowHandle *find(const RowHandle *what) const;
+	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
+	virtual void insert(RowHandle *rh);
+	virtual void remove(RowHandle *rh);
+	virtual void aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already);
+	virtual void aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future);
+	virtual bool collapse(Tray *dest, const RhSet &replaced);
+	virtual Index *findNested(const RowHandle *what, int nestPos) const;
+
+protected:
+	Autoref<const HashedIndexType> type_; // type of this index
+	HashedSet data_; // the data store
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_HashedIndex_h__
@@ -0,0 +1,278 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of a hashed primary key with further nesting.
+
+#include <table/HashedNestedIndex.h>
+#include <type/RowType.h>
+
+namespace TRICEPS_NS {
+
+//////////////////////////// HashedNestedIndex /////////////////////////
+
+HashedNestedIndex::HashedNestedIndex(const TableType *tabtype, Table *table, const HashedIndexType *mytype) :
+	Index(tabtype, table),
+	type_(mytype),
+	data_(mytype)
+{ }
+
+HashedNestedIndex::~HashedNestedIndex()
+{
+	vector<GroupHandle *> groups;
+	groups.reserve(data_.size());
+	for (RowHandle *it = data_.first(); it != NULL; it = data_.next(it)) {
+		groups.push_back(static_cast<GroupHandle *>(it));
+	}
+	data_.clear();
+	size_t n = groups.size();
+	for (size_t i = 0; i < n; i++) {
+		GroupHandle *gh = groups[i];
+		if (gh->decref() <= 0)
+			type_->destroyGroupHandle(gh);
+	}
+}
+
+void HashedNestedIndex::clearData()
+{
+	// pass recursively into the groups
+	for (RowHandle *it = data_.first(); it != NULL; it = data_.next(it)) {
+		type_->groupClearData(static_cast<GroupHandle *>(it));
+	}
+}
+
+const IndexType *HashedNestedIndex::getType() const
+{
+	return type_;
+}
+
+RowHandle *HashedNestedIndex::begin() const
+{
+	RowHandle *rh = NULL;
+	// the first group may be empty while there is another non-empty group:
+	// could happen when a new group is already created but not yet
+	// populated during aggregation
+	for (RowHandle *it = data_.first(); rh == NULL && it != NULL; it = data_.next(it)) {
+		rh = type_->beginIteration(static_cast<GroupHandle *>(it));
+	}
+	return rh;
+}
+
+RowHandle *HashedNestedIndex::next(const RowHandle *cur) const
+{
+	if (cur == NULL || !cur->isInTable())
+		return NULL;
+
+	GroupHandle *gh = getGroup(cur); // row is known to be in the table
+
+	RowHandle *res = type_->nextIteration(gh, cur);
+	if (res != NULL)
+		return res;
+
+	// otherwise try the next groups until find a non-empty one
+	for (RowHandle *it = data_.next(gh); it != NULL; it = data_.next(it)) {
+		res = type_->beginIteration(static_cast<GroupHandle *>(it));
+		if (res != NULL)
+			return res;
+	}
+
+	return NULL;
+}
+
+RowHandle *HashedNestedIndex::last() const
+{
+	RowHandle *it = data_.last();
+	if (it == NULL)
+		return NULL;
+
+	RowHandle *rh = type_->last(static_cast<GroupHandle *>(it));
+	if (rh == NULL) {
+		// the last group may be empty while there is another non-empty group:
+		// could happen when a new group is already created but not yet
+		// populated during aggregation; there is no backwards iteration,
+		// so go forward and remember the last non-empty group
+		for (it = data_.first(); it != NULL; it = data_.next(it)) {
+			RowHandle *grh = type_->last(static_cast<GroupHandle *>(it));
+			if (grh != NULL)
+				rh = grh;
+		}
+	}
+	return rh;
+}
+
+const GroupHandle *HashedNestedIndex::nextGroup(const GroupHandle *cur) const
+{
+	if (cur == NULL)
+		return NULL;
+	return static_cast<const GroupHandle *>(data_.next(cur));
+}
+
+const GroupHandle *HashedNestedIndex::beginGroup() const
+{
+	return static_cast<const GroupHandle *>(data_.first());
+}
+
+const GroupHandle *HashedNestedIndex::toGroup(const RowHandle *cur) const
+{
+	return getGroup(cur); // row is known to be in the table
+}
+
+RowHandle *HashedNestedIndex::find(const RowHandle *what) const
+{
+	return NULL; // no records directly here
+}
+
+Index *HashedNestedIndex::findNested(const RowHandle *what, int nestPos) const
+{
+	RowHandle *it;
+	if (what == NULL)
+		it = data_.first();
+	else
+		it = data_.find(what);
+
+	if (it == NULL)
+		return NULL;
+	return type_->groupToIndex(static_cast<GroupHandle *>(it), nestPos);
+}
+
+bool HashedNestedIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
+{
+	GroupHandle *gh = static_cast<GroupHandle *>(data_.find(rh));
+
+	if (gh == NULL) {
+		gh = type_->makeGroupHandle(rh, table_);
+		gh->incref();
+		data_.insert(gh);
+	}
+	// the group has to be stored now in rh, to avoid look-up on insert
+	type_->getSection(rh)->group_ = gh;
+
+	return type_->groupReplacementPolicy(gh, rh, replaced);
+}
+
+void HashedNestedIndex::insert(RowHandle *rh)
+{
+	type_->groupInsert(getGroup(rh), rh); // has been set in replacementPolicy()
+}
+
+void HashedNestedIndex::remove(RowHandle *rh)
+{
+	type_->groupRemove(getGroup(rh), rh); // row is known to be in the table
+}
+
+void HashedNestedIndex::splitRhSet(const RhSet &rows, SplitMap &dest)
+{
+	for(RhSet::iterator rsi = rows.begin(); rsi != rows.end(); ++rsi) {
+		RowHandle *rh = *rsi;
+		dest[getGroup(rh)].insert(rh); // row is known to still be in the group
+	}
+}
+
+GroupHandle *HashedNestedIndex::singleGroup(const RhSet &rows) const
+{
+	GroupHandle *gh = NULL;
+	for(RhSet::iterator rsi = rows.begin(); rsi != rows.end(); ++rsi) {
+		GroupHandle *cur = getGroup(*rsi); // row is known to still be in the group
+		if (gh == NULL)
+			gh = cur;
+		else if (gh != cur)
+			return NULL;
+	}
+	return gh;
+}
+
+void HashedNestedIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already)
+{
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(rows);
+	if (single != NULL && (already.empty() || singleGroup(already) == single)) {
+		type_->groupAggregateBefore(dest, table_, single, rows, already);
+		return;
+	}
+
+	SplitMap splitRows, splitAlready;
+	splitRhSet(rows, splitRows);
+	if (!already.empty())
+		splitRhSet(already, splitAlready);
+
+	for(SplitMap::iterator smi = splitRows.begin(); smi != splitRows.end(); ++smi) {
+		GroupHandle *gh = smi->first;
+		if (already.empty()) { // a little optimization
+			type_->groupAggregateBefore(dest, table_, gh, smi->second, already);
+		} else {
+			// this automatically creates a new entry in splitAlready if it was missing
+			type_->groupAggregateBefore(dest, table_, gh, smi->second, splitAlready[gh]);
+		}
+	}
+}
+
+void HashedNestedIndex::aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future)
+{
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(rows);
+	if (single != NULL && (future.empty() || singleGroup(future) == single)) {
+		type_->groupAggregateAfter(dest, aggop, table_, single, rows, future);
+		return;
+	}
+
+	SplitMap splitRows, splitFuture;
+	splitRhSet(rows, splitRows);
+	if (!future.empty())
+		splitRhSet(future, splitFuture);
+
+	for(SplitMap::iterator smi = splitRows.begin(); smi != splitRows.end(); ++smi) {
+		GroupHandle *gh = smi->first;
+		if (future.empty()) { // a little optimization
+			type_->groupAggregateAfter(dest, aggop, table_, gh, smi->second, future);
+		} else {
+			// this automatically creates a new entry in splitFuture if it was missing
+			type_->groupAggregateAfter(dest, aggop, table_, gh, smi->second, splitFuture[gh]);
+		}
+	}
+}
+
+bool HashedNestedIndex::collapse(Tray *dest, const RhSet &replaced)
+{
+	if (replaced.empty())
+		return true;
+
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(replaced);
+	if (single != NULL)
+		return collapseGroup(dest, single, replaced);
+
+	// split the set into subsets by group
+	SplitMap split;
+	splitRhSet(replaced, split);
+
+	bool res = true;
+
+	// handle each subset's group
+	for(SplitMap::iterator smi = split.begin(); smi != split.end(); ++smi) {
+		res = (collapseGroup(dest, smi->first, smi->second) && res);
+	}
+
+	return res;
+}
+
+bool HashedNestedIndex::collapseGroup(Tray *dest, GroupHandle *gh, const RhSet &replaced)
+{
+	if (type_->groupCollapse(dest, gh, replaced)) {
+		// call the aggregators to process collapse
+		if (!type_->groupAggs_.empty()) {
+			type_->aggregateCollapse(dest, table_, gh);
+		}
+		// destroy the group
+		data_.erase(gh);
+		if (gh->decref() <= 0)
+			type_->destroyGroupHandle(gh);
+		return true;
+	} else {
+		// a group objects to being collapsed
+		return false;
+	}
+}
+
+}; // TRICEPS_NS
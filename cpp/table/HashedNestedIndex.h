@@ -0,0 +1,82 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Implementation of a hashed primary key with further nesting.
+
+#ifndef __Triceps_HashedNestedIndex_h__
+#define __Triceps_HashedNestedIndex_h__
+
+#include <table/Index.h>
+#include <table/HashedSet.h>
+#include <type/HashedIndexType.h>
+
+namespace TRICEPS_NS {
+
+class RowType;
+
+class HashedNestedIndex: public Index
+{
+	friend class HashedIndexType;
+
+public:
+	// @param tabtype - type of table where this index belongs
+	// @param table - the actual table where this index belongs
+	// @param mytype - type that created this index
+	HashedNestedIndex(const TableType *tabtype, Table *table, const HashedIndexType *mytype);
+	~HashedNestedIndex();
+
+	// from Index
+	virtual void clearData();
+	virtual const IndexType *getType() const;
+	virtual RowHandle *begin() const;
+	virtual RowHandle *next(const RowHandle *cur) const;
+	virtual RowHandle *last() const;
+	virtual const GroupHandle *nextGroup(const GroupHandle *cur) const;
+	virtual const GroupHandle *beginGroup() const;
+	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
+	virtual RowHandle *find(const RowHandle *what) const;
+	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
+	virtual void insert(RowHandle *rh);
+	virtual void remove(RowHandle *rh);
+	virtual void aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already);
+	virtual void aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future);
+	virtual bool collapse(Tray *dest, const RhSet &replaced);
+	virtual Index *findNested(const RowHandle *what, int nestPos) const;
+
+protected:
+	// Get the group where a row belongs (the row must be in the table, or at
+	// least have gone through the replacementPolicy()).
+	GroupHandle *getGroup(const RowHandle *rh) const
+	{
+		return type_->getSection(rh)->group_;
+	}
+
+	// A helper function splitting a row handle set by groups.
+	// @param rows - set to split
+	// @param dest - destination map that gets populated 
+	//        (if not empty then added to)
+	void splitRhSet(const RhSet &rows, SplitMap &dest);
+
+	// Find the group that all the rows in the set belong to.
+	// @param rows - set to check
+	// @return - the common group, or NULL if the rows belong to
+	//        multiple groups or the set is empty
+	GroupHandle *singleGroup(const RhSet &rows) const;
+
+	// Collapse one group if it agrees to be collapsed.
+	// @param dest - destination to send the delayed aggregation changes
+	// @param gh - the group to collapse
+	// @param replaced - the rows from this group that have been replaced
+	// @return - true if the group has been collapsed
+	bool collapseGroup(Tray *dest, GroupHandle *gh, const RhSet &replaced);
+
+	Autoref<const HashedIndexType> type_; // type of this index
+	HashedSet data_; // the data store, contains the GroupHandles
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_HashedNestedIndex_h__
@@ -0,0 +1,381 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// The open-addressing hash table storage for the hashed indexes.
+
+#include <table/HashedSet.h>
+#include <type/HashedIndexType.h>
+#include <string.h>
+
+namespace TRICEPS_NS {
+
+//////////////////////////// HashedSet /////////////////////////
+
+HashedSet::HashedSet(const HashedIndexType *type) :
+	type_(type),
+	migrated_(0),
+	size_(0)
+{ }
+
+HashedSet::~HashedSet()
+{
+	clear();
+}
+
+HashedSet::Order HashedSet::toOrder(const RowHandle *rh) const
+{
+	// flipping the sign bit makes the unsigned order match the signed one
+	return (Order)type_->getHash(rh) ^ ((Order)1 << (ORDER_BITS - 1));
+}
+
+int HashedSet::cmpSlot(const Slot &s, Order o, const RowHandle *rh) const
+{
+	if (s.order_ != o)
+		return (s.order_ < o)? -1 : 1;
+	return type_->cmpKeys(s.rh_, rh);
+}
+
+void HashedSet::allocArray(Array &arr, size_t capacity)
+{
+	int bits = 0;
+	while (((size_t)1 << bits) < capacity)
+		++bits;
+
+	arr.capacity_ = (size_t)1 << bits;
+	arr.length_ = arr.capacity_ + arr.capacity_ / 8 + MIN_CAPACITY;
+	arr.shift_ = ORDER_BITS - bits;
+	arr.count_ = 0;
+	arr.slots_ = (Slot *)calloc(arr.length_, sizeof(Slot));
+}
+
+void HashedSet::freeArray(Array &arr)
+{
+	free(arr.slots_);
+	arr = Array();
+}
+
+size_t HashedSet::locate(const Array &arr, Order o, const RowHandle *rh) const
+{
+	size_t pos = arr.home(o);
+	while (arr.slots_[pos].rh_ != rh) {
+		assert(arr.slots_[pos].rh_ != NULL); // must be present
+		++pos;
+		assert(pos < arr.length_);
+	}
+	return pos;
+}
+
+size_t HashedSet::scanForward(const Array &arr, size_t pos, size_t limit) const
+{
+	for (; pos < arr.length_; ++pos) {
+		if (arr.slots_[pos].rh_ != NULL)
+			return pos;
+		// nothing can be located past an empty slot after the last home
+		if (pos >= limit)
+			break;
+	}
+	return arr.length_;
+}
+
+size_t HashedSet::curLimit() const
+{
+	if (old_.slots_ == NULL || migrated_ >= old_.capacity_)
+		return cur_.length_;
+	// all the elements in the current array are below this order value
+	Order bound = (Order)migrated_ << old_.shift_;
+	return cur_.home(bound) + 1;
+}
+
+RowHandle *HashedSet::find(const RowHandle *what) const
+{
+	Order o = toOrder(what);
+	const Array &arr = arrayFor(o);
+	if (arr.slots_ == NULL)
+		return NULL;
+
+	for (size_t pos = arr.home(o); pos < arr.length_; ++pos) {
+		const Slot &s = arr.slots_[pos];
+		if (s.rh_ == NULL)
+			return NULL;
+		int c = cmpSlot(s, o, what);
+		if (c == 0)
+			return s.rh_;
+		if (c > 0)
+			return NULL; // went past the place where it would be
+	}
+	return NULL;
+}
+
+bool HashedSet::insertArray(Array &arr, Order o, RowHandle *rh)
+{
+	if (arr.slots_ == NULL)
+		return false;
+
+	// find the place to insert in order
+	size_t pos;
+	for (pos = arr.home(o); pos < arr.length_; ++pos) {
+		const Slot &s = arr.slots_[pos];
+		if (s.rh_ == NULL)
+			break;
+		int c = cmpSlot(s, o, rh);
+		assert(c != 0); // the key must not be present yet
+		if (c > 0)
+			break;
+	}
+
+	// find the end of the run, to shift it by one slot
+	size_t end;
+	for (end = pos; end < arr.length_; ++end) {
+		if (arr.slots_[end].rh_ == NULL)
+			break;
+	}
+	if (end >= arr.length_)
+		return false; // no space left at the end of array
+
+	if (end != pos)
+		memmove(arr.slots_ + pos + 1, arr.slots_ + pos, (end - pos) * sizeof(Slot));
+	arr.slots_[pos].order_ = o;
+	arr.slots_[pos].rh_ = rh;
+	++arr.count_;
+	return true;
+}
+
+void HashedSet::eraseArray(Array &arr, Order o, const RowHandle *rh)
+{
+	size_t pos = locate(arr, o, rh);
+
+	// shift back the following elements that are not at their home slots
+	size_t end;
+	for (end = pos + 1; end < arr.length_; ++end) {
+		const Slot &s = arr.slots_[end];
+		if (s.rh_ == NULL || arr.home(s.order_) >= end)
+			break;
+	}
+
+	if (end != pos + 1)
+		memmove(arr.slots_ + pos, arr.slots_ + pos + 1, (end - pos - 1) * sizeof(Slot));
+	arr.slots_[end - 1].order_ = 0;
+	arr.slots_[end - 1].rh_ = NULL;
+	--arr.count_;
+}
+
+void HashedSet::insert(RowHandle *rh)
+{
+	Order o = toOrder(rh);
+
+	if (old_.slots_ != NULL)
+		migrate();
+	else if (cur_.slots_ == NULL)
+		allocArray(cur_, MIN_CAPACITY);
+
+	while (!insertArray(arrayFor(o), o, rh)) {
+		// Ran out of the spare space at the end of the array. If the
+		// resizing was in progress, finish it right away, otherwise grow.
+		if (old_.slots_ != NULL)
+			rebuild(cur_.capacity_);
+		else
+			rebuild(cur_.capacity_ * 2);
+	}
+	++size_;
+
+	checkSize();
+}
+
+void HashedSet::erase(const RowHandle *rh)
+{
+	Order o = toOrder(rh);
+
+	if (old_.slots_ != NULL)
+		migrate();
+
+	eraseArray(arrayFor(o), o, rh);
+	--size_;
+
+	checkSize();
+}
+
+void HashedSet::clear()
+{
+	freeArray(cur_);
+	freeArray(old_);
+	migrated_ = 0;
+	size_ = 0;
+}
+
+RowHandle *HashedSet::first() const
+{
+	size_t pos = scanForward(cur_, 0, curLimit());
+	if (pos < cur_.length_)
+		return cur_.slots_[pos].rh_;
+
+	if (old_.slots_ != NULL) {
+		pos = scanForward(old_, migrated_, old_.length_);
+		if (pos < old_.length_)
+			return old_.slots_[pos].rh_;
+	}
+	return NULL;
+}
+
+RowHandle *HashedSet::last() const
+{
+	if (old_.slots_ != NULL) {
+		for (size_t pos = old_.length_; pos > migrated_; ) {
+			--pos;
+			if (old_.slots_[pos].rh_ != NULL)
+				return old_.slots_[pos].rh_;
+		}
+	}
+
+	// the elements of the current array can not go past the first
+	// empty slot after the limit
+	size_t end;
+	for (end = curLimit(); end < cur_.length_; ++end) {
+		if (cur_.slots_[end].rh_ == NULL)
+			break;
+	}
+	while (end > 0) {
+		--end;
+		if (cur_.slots_[end].rh_ != NULL)
+			return cur_.slots_[end].rh_;
+	}
+	return NULL;
+}
+
+RowHandle *HashedSet::next(const RowHandle *cur) const
+{
+	Order o = toOrder(cur);
+	const Array &arr = arrayFor(o);
+	size_t pos = locate(arr, o, cur);
+
+	if (&arr == &cur_) {
+		pos = scanForward(cur_, pos + 1, curLimit());
+		if (pos < cur_.length_)
+			return cur_.slots_[pos].rh_;
+		if (old_.slots_ == NULL)
+			return NULL;
+		// continue into the old array
+		pos = migrated_;
+	} else {
+		++pos;
+	}
+
+	pos = scanForward(old_, pos, old_.length_);
+	if (pos < old_.length_)
+		return old_.slots_[pos].rh_;
+	return NULL;
+}
+
+void HashedSet::checkSize()
+{
+	if (old_.slots_ != NULL)
+		return; // already resizing
+
+	if (size_ == 0) {
+		if (cur_.capacity_ > MIN_CAPACITY)
+			freeArray(cur_);
+		return;
+	}
+
+	if (cur_.count_ > cur_.capacity_ / 4 * 3) {
+		resize(cur_.capacity_ * 2);
+	} else if (cur_.capacity_ > MIN_CAPACITY && cur_.count_ < cur_.capacity_ / 8) {
+		resize(cur_.capacity_ / 2);
+	}
+}
+
+void HashedSet::resize(size_t capacity)
+{
+	if (capacity <= INCREMENTAL_CAPACITY && cur_.capacity_ <= INCREMENTAL_CAPACITY) {
+		rebuild(capacity);
+		return;
+	}
+
+	old_ = cur_;
+	allocArray(cur_, capacity);
+	migrated_ = 0;
+}
+
+void HashedSet::migrate()
+{
+	int budget = MIGRATE_STEP;
+	while (budget > 0 && migrated_ < old_.length_) {
+		if (old_.slots_[migrated_].rh_ == NULL) {
+			++migrated_;
+			--budget;
+			continue;
+		}
+
+		// move the whole run, up to the next empty slot
+		size_t pos;
+		for (pos = migrated_; pos < old_.length_; ++pos) {
+			Slot &s = old_.slots_[pos];
+			if (s.rh_ == NULL)
+				break;
+			if (!insertArray(cur_, s.order_, s.rh_)) {
+				// no space in the new array, finish the resizing at once
+				rebuild(cur_.capacity_);
+				return;
+			}
+			s.rh_ = NULL;
+			--old_.count_;
+			--budget;
+		}
+		migrated_ = pos;
+	}
+
+	if (migrated_ >= old_.length_) {
+		assert(old_.count_ == 0);
+		freeArray(old_);
+		migrated_ = 0;
+	}
+}
+
+void HashedSet::rebuild(size_t capacity)
+{
+	for (;;) {
+		Array arr;
+		allocArray(arr, capacity);
+
+		// Both sources are in order, and the current array goes before
+		// the old one, so the elements get simply placed one after another.
+		// The old array gets scanned from the beginning because the
+		// migration might have been interrupted in the middle of a run.
+		const Array *src[2] = { &cur_, &old_ };
+		size_t next = 0;
+		bool fits = true;
+		for (int i = 0; i < 2 && fits; i++) {
+			const Array &from = *src[i];
+			for (size_t pos = 0; pos < from.length_; ++pos) {
+				const Slot &s = from.slots_[pos];
+				if (s.rh_ == NULL)
+					continue;
+				size_t to = arr.home(s.order_);
+				if (to < next)
+					to = next;
+				if (to >= arr.length_) {
+					fits = false;
+					break;
+				}
+				arr.slots_[to] = s;
+				++arr.count_;
+				next = to + 1;
+			}
+		}
+
+		if (fits) {
+			freeArray(cur_);
+			freeArray(old_);
+			migrated_ = 0;
+			cur_ = arr;
+			return;
+		}
+
+		freeArray(arr);
+		capacity *= 2;
+	}
+}
+
+}; // TRICEPS_NS
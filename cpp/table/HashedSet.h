@@ -0,0 +1,204 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// The open-addressing hash table storage for the hashed indexes.
+
+#ifndef __Triceps_HashedSet_h__
+#define __Triceps_HashedSet_h__
+
+#include <common/Common.h>
+#include <common/Hash.h>
+#include <table/RowHandle.h>
+
+namespace TRICEPS_NS {
+
+class HashedIndexType;
+
+// A set of row (or group) handles, keyed by the key of a HashedIndexType.
+//
+// It's a linear-probing hash table where the home slot of each element
+// is determined by the high bits of its hash value, and the elements in
+// each run of occupied slots are kept ordered by (hash, key). Together this
+// means that the whole array is ordered by (hash, key), so the iteration is a
+// sequential scan of the array, in the same order as the tree-based set
+// used to have. There is no wrap-around at the end of the array: instead
+// the array has some spare slots after the last home slot.
+//
+// The hash value is stored in the slot next to the handle pointer, so the
+// probing mostly doesn't need to touch the handles, and the full key
+// comparison is done only when the hash values match.
+//
+// The positions of the elements are not remembered in the handles (they
+// move when the neighbors get inserted or removed), instead the handle
+// gets found by the hash and the pointer value, which is cheap.
+//
+// The large tables get resized incrementally: a new array is allocated,
+// and then on each following insert or remove a few runs of slots get moved
+// from the old array into the new one, in the order of the array. The
+// elements with the home slot (in the old array) below the migration point
+// live in the new array, the rest live in the old array, so all the
+// elements in the new array go in order before all the elements in the
+// old array.
+class HashedSet
+{
+public:
+	// @param type - the index type that defines the hash and the key
+	//        comparison (the caller keeps the reference to it)
+	HashedSet(const HashedIndexType *type);
+	~HashedSet();
+
+	// Get the number of elements in the set.
+	size_t size() const
+	{
+		return size_;
+	}
+
+	bool empty() const
+	{
+		return (size_ == 0);
+	}
+
+	// Find an element with the same key.
+	// @param what - the pattern handle, with the hash pre-computed
+	// @return - the matching element, or NULL if not found
+	RowHandle *find(const RowHandle *what) const;
+
+	// Insert an element. The element with the same key must
+	// not be present in the set.
+	// @param rh - the element to insert
+	void insert(RowHandle *rh);
+
+	// Remove an element. It must be present in the set.
+	// @param rh - the element to remove
+	void erase(const RowHandle *rh);
+
+	// Remove all the elements and free the memory.
+	void clear();
+
+	// The iteration.
+	// @return - the first element, or NULL if the set is empty
+	RowHandle *first() const;
+	// @return - the last element, or NULL if the set is empty
+	RowHandle *last() const;
+	// @param cur - an element that is present in the set
+	// @return - the next element, or NULL if cur was the last one
+	RowHandle *next(const RowHandle *cur) const;
+
+protected:
+	// The value stored in the slots is the hash converted so that
+	// its unsigned order is the same as the signed order of the
+	// original hash, the order that has been traditionally used
+	// by the hashed index iteration.
+	typedef Hash::Value Order;
+
+	enum {
+		ORDER_BITS = sizeof(Order) * 8,
+		// the initial number of the home slots
+		MIN_CAPACITY = 4,
+		// The tables up to this many home slots get resized
+		// all at once, the larger ones incrementally.
+		INCREMENTAL_CAPACITY = 4096,
+		// how many slots get migrated on each insert or remove
+		// when resizing incrementally
+		MIGRATE_STEP = 16,
+	};
+
+	struct Slot {
+		Order order_; // the converted hash value
+		RowHandle *rh_; // NULL if the slot is empty
+	};
+
+	// One array of slots.
+	struct Array {
+		Slot *slots_;
+		size_t capacity_; // the number of home slots, a power of 2
+		size_t length_; // the full length, including the spare slots after the home slots
+		int shift_; // shift of the order value to get the home slot
+		size_t count_; // number of the elements in this array
+
+		Array() :
+			slots_(NULL),
+			capacity_(0),
+			length_(0),
+			shift_(0),
+			count_(0)
+		{ }
+
+		size_t home(Order o) const
+		{
+			return (size_t)(o >> shift_);
+		}
+	};
+
+	// Convert the handle's hash into the order value.
+	Order toOrder(const RowHandle *rh) const;
+
+	// Compare the element in a slot with a handle.
+	// @return - <0 if the slot goes first, 0 if the keys are equal, >0 if the handle goes first
+	int cmpSlot(const Slot &s, Order o, const RowHandle *rh) const;
+
+	// Select the array where an element with this order value belongs.
+	const Array &arrayFor(Order o) const
+	{
+		if (old_.slots_ != NULL && old_.home(o) >= migrated_)
+			return old_;
+		return cur_;
+	}
+	Array &arrayFor(Order o)
+	{
+		if (old_.slots_ != NULL && old_.home(o) >= migrated_)
+			return old_;
+		return cur_;
+	}
+
+	// Find the position of a present element by its pointer.
+	size_t locate(const Array &arr, Order o, const RowHandle *rh) const;
+
+	// Find the first occupied slot in the array at or after pos.
+	// @param limit - no elements have the home slot at or past this position
+	// @return - the position, or arr.length_ if none
+	size_t scanForward(const Array &arr, size_t pos, size_t limit) const;
+
+	// The limit for scanning the current array: when the resizing is in
+	// progress, no elements in it have the home slot at or past this position.
+	size_t curLimit() const;
+
+	// Allocate an array of a given capacity.
+	static void allocArray(Array &arr, size_t capacity);
+	static void freeArray(Array &arr);
+
+	// Insert into an array.
+	// @return - false if there is no space left in the array
+	bool insertArray(Array &arr, Order o, RowHandle *rh);
+	// Remove from an array.
+	void eraseArray(Array &arr, Order o, const RowHandle *rh);
+
+	// Start the resizing to a new capacity. Small arrays get
+	// resized immediately.
+	void resize(size_t capacity);
+	// Move a few slots from the old array to the new one.
+	void migrate();
+	// Rebuild all the contents into a single new array of at least
+	// the given capacity, all at once.
+	void rebuild(size_t capacity);
+	// Check the fill levels and start the resizing if needed.
+	void checkSize();
+
+	const HashedIndexType *type_; // the type is held by the index
+	Array cur_; // the current array
+	Array old_; // the old array when resizing is in progress
+	size_t migrated_; // the position in the old array up to which the contents has been migrated
+	size_t size_; // the total number of elements
+
+private:
+	HashedSet();
+	HashedSet(const HashedSet &);
+	void operator=(const HashedSet &);
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_HashedSet_h__
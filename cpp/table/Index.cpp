@@ -21,5 +21,15 @@ Index::Index(const TableType *tabtype, Table *table) :
 Index::~Index()
 { }
 
+RowHandle *Index::lowerBound(const RowHandle *what) const
+{
+	return NULL;
+}
+
+RowHandle *Index::upperBound(const RowHandle *what) const
+{
+	return NULL;
+}
+
 }; // TRICEPS_NS
 
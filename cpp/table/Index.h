@@ -84,7 +84,22 @@ public:
 	//     may return any of them but preferrably the first one.
 	virtual RowHandle *find(const RowHandle *what) const = 0;
 
-	// XXX add lower_bound, upper_bound ?
+	// Find the first row with the key not less than in the pattern
+	// (like the STL lower_bound()). Makes sense only for the indexes
+	// that keep their rows ordered by the key, the rest return NULL.
+	// For the nested indexes the search goes by the groups, and the
+	// result is the first row of the found group.
+	// @param what - the pattern row
+	// @return - the found row in the table, or NULL if all the rows in
+	//     this index are less than the pattern
+	virtual RowHandle *lowerBound(const RowHandle *what) const;
+
+	// Find the first row with the key greater than in the pattern
+	// (like the STL upper_bound()). The rest is the same as for lowerBound().
+	// @param what - the pattern row
+	// @return - the found row in the table, or NULL if no rows in
+	//     this index are greater than the pattern
+	virtual RowHandle *upperBound(const RowHandle *what) const;
 
 	// Get the type id of this index
 	IndexType::IndexId getIndexId() const
@@ -93,7 +108,7 @@ public:
 	}
 
 protected:
-	typedef set<RowHandle *> RhSet;
+	typedef IndexType::RhSet RhSet;
 
 	// always created through subclasses
 	Index(const TableType *tabtype, Table *table);
@@ -0,0 +1,319 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A join of two tables.
+
+#include <table/JoinTwo.h>
+#include <common/Exception.h>
+#include <common/StringUtil.h>
+
+namespace TRICEPS_NS {
+
+static Valname joinTypes[] = {
+	{ JoinTwo::JT_INNER, "inner" },
+	{ JoinTwo::JT_LEFT, "left" },
+	{ JoinTwo::JT_RIGHT, "right" },
+	{ JoinTwo::JT_OUTER, "outer" },
+	{ -1, NULL }
+};
+
+static Valname uniqKeys[] = {
+	{ JoinTwo::UK_NONE, "none" },
+	{ JoinTwo::UK_MANUAL, "manual" },
+	{ JoinTwo::UK_LEFT, "left" },
+	{ JoinTwo::UK_RIGHT, "right" },
+	{ JoinTwo::UK_FIRST, "first" },
+	{ -1, NULL }
+};
+
+const char *JoinTwo::joinTypeString(int val, const char *def)
+{
+	return enum2string(joinTypes, val, def);
+}
+
+int JoinTwo::stringJoinType(const char *str)
+{
+	return string2enum(joinTypes, str);
+}
+
+const char *JoinTwo::uniqKeyString(int val, const char *def)
+{
+	return enum2string(uniqKeys, val, def);
+}
+
+int JoinTwo::stringUniqKey(const char *str)
+{
+	return string2enum(uniqKeys, str);
+}
+
+JoinTwo::JoinTwo(Unit *unit, const string &name, Table *leftTable, Table *rightTable,
+		IndexType *leftIdxType, IndexType *rightIdxType) :
+	Gadget(unit, Gadget::EM_CALL, name + ".out"),
+	leftTable_(leftTable),
+	rightTable_(rightTable),
+	leftIdxType_(leftIdxType),
+	rightIdxType_(rightIdxType),
+	name_(name),
+	joinType_(JT_INNER),
+	uniqKey_(UK_FIRST),
+	fieldsLeftFirst_(true),
+	simpleMinded_(false),
+	initialized_(false)
+{ }
+
+void JoinTwo::checkNotInitialized() const
+{
+	if (initialized_)
+		throw Exception::fTrace("Attempted to change the definition of an initialized JoinTwo '%s'", name_.c_str());
+}
+
+JoinTwo *JoinTwo::setLeftFromLabel(Label *lb)
+{
+	checkNotInitialized();
+	leftFromLabel_ = lb;
+	return this;
+}
+
+JoinTwo *JoinTwo::setRightFromLabel(Label *lb)
+{
+	checkNotInitialized();
+	rightFromLabel_ = lb;
+	return this;
+}
+
+JoinTwo *JoinTwo::addBy(const string &leftFld, const string &rightFld)
+{
+	checkNotInitialized();
+	byLeft_.push_back(leftFld);
+	byRight_.push_back(rightFld);
+	return this;
+}
+
+JoinTwo *JoinTwo::setLeftFields(Onceref<NameSet> fields, Onceref<NameSet> resNames)
+{
+	checkNotInitialized();
+	leftFields_ = fields;
+	leftResNames_ = resNames;
+	return this;
+}
+
+JoinTwo *JoinTwo::setRightFields(Onceref<NameSet> fields, Onceref<NameSet> resNames)
+{
+	checkNotInitialized();
+	rightFields_ = fields;
+	rightResNames_ = resNames;
+	return this;
+}
+
+JoinTwo *JoinTwo::setFieldsLeftFirst(bool on)
+{
+	checkNotInitialized();
+	fieldsLeftFirst_ = on;
+	return this;
+}
+
+JoinTwo *JoinTwo::setFieldsUniqKey(UniqKey uk)
+{
+	checkNotInitialized();
+	uniqKey_ = uk;
+	return this;
+}
+
+JoinTwo *JoinTwo::setType(JoinType jt)
+{
+	checkNotInitialized();
+	joinType_ = jt;
+	return this;
+}
+
+JoinTwo *JoinTwo::setOverrideSimpleMinded(bool on)
+{
+	checkNotInitialized();
+	simpleMinded_ = on;
+	return this;
+}
+
+bool JoinTwo::collectKeys(IndexType *ixt, const char *side, NameSet &keys)
+{
+	vector<IndexType *> path;
+	for (; ixt != NULL && ixt->getIndexId() != IndexType::IT_ROOT; ixt = ixt->getParent())
+		path.push_back(ixt);
+
+	for (int i = (int)path.size() - 1; i >= 0; i--) {
+		const NameSet *key = path[i]->getKey();
+		if (key == NULL || key->empty()) {
+			errors_.f("the %s index type and its parents must have the keys", side);
+			return false;
+		}
+		keys.insert(keys.end(), key->begin(), key->end());
+	}
+	return true;
+}
+
+void JoinTwo::dropKeys(const RowType *rt, const NameSet &keys,
+	Autoref<NameSet> &fields, Autoref<NameSet> &resNames)
+{
+	Autoref<NameSet> newFields = new NameSet;
+	Autoref<NameSet> newResNames = (resNames.isNull()? NULL : new NameSet);
+
+	size_t n = (fields.isNull()? rt->fieldCount() : fields->size());
+	for (size_t i = 0; i < n; i++) {
+		const string &f = (fields.isNull()? rt->fields()[i].name_ : (*fields)[i]);
+		size_t k;
+		for (k = 0; k < keys.size(); k++)
+			if (keys[k] == f)
+				break;
+		if (k < keys.size())
+			continue;
+		newFields->push_back(f);
+		if (!newResNames.isNull() && i < resNames->size())
+			newResNames->push_back((*resNames)[i]);
+	}
+	fields = newFields;
+	resNames = newResNames;
+}
+
+void JoinTwo::initialize()
+{
+	if (initialized_)
+		return;
+	initialized_ = true;
+
+	errors_ = new Errors;
+
+	if (leftTable_->getUnit() != unit_ || rightTable_->getUnit() != unit_) {
+		errors_.f("both tables must have the same unit as the join, got '%s' and '%s' vs '%s'",
+			leftTable_->getUnit()->getName().c_str(), rightTable_->getUnit()->getName().c_str(),
+			unit_->getName().c_str());
+		return;
+	}
+
+	bool selfJoin = (leftTable_ == rightTable_);
+	if (leftFromLabel_.isNull())
+		leftFromLabel_ = (selfJoin? leftTable_->getPreLabel() : leftTable_->getLabel());
+	if (rightFromLabel_.isNull())
+		rightFromLabel_ = rightTable_->getLabel();
+
+	if (leftFromLabel_->getUnitPtr() != unit_)
+		errors_.f("the left from-label '%s' has a different unit", leftFromLabel_->getName().c_str());
+	else if (!leftFromLabel_->getType()->match(leftTable_->getRowType()))
+		errors_.f("the left from-label '%s' row type does not match the left table", leftFromLabel_->getName().c_str());
+	if (rightFromLabel_->getUnitPtr() != unit_)
+		errors_.f("the right from-label '%s' has a different unit", rightFromLabel_->getName().c_str());
+	else if (!rightFromLabel_->getType()->match(rightTable_->getRowType()))
+		errors_.f("the right from-label '%s' row type does not match the right table", rightFromLabel_->getName().c_str());
+
+	if (leftIdxType_->getTabtype() != leftTable_->getType())
+		errors_.f("the left index type must belong to the left table's type");
+	if (rightIdxType_->getTabtype() != rightTable_->getType())
+		errors_.f("the right index type must belong to the right table's type");
+	if (errors_->hasError())
+		return;
+
+	NameSet leftKeys, rightKeys;
+	if (!collectKeys(leftIdxType_, "left", leftKeys) || !collectKeys(rightIdxType_, "right", rightKeys))
+		return;
+	if (leftKeys.size() != rightKeys.size()) {
+		errors_.f("the count of key fields in left and right indexes doesn't match, %d vs %d",
+			(int)leftKeys.size(), (int)rightKeys.size());
+		return;
+	}
+	if (byLeft_.empty()) {
+		// match up the keys in order
+		byLeft_ = leftKeys;
+		byRight_ = rightKeys;
+	}
+	// the rest of the key checks will be done by the lookup joins
+
+	bool mirror = (uniqKey_ != UK_NONE);
+	UniqKey uniq = uniqKey_;
+	if (uniq == UK_FIRST)
+		uniq = (fieldsLeftFirst_? UK_LEFT : UK_RIGHT);
+	if (uniq == UK_LEFT)
+		dropKeys(rightTable_->getRowType(), byRight_, rightFields_, rightResNames_);
+	else if (uniq == UK_RIGHT)
+		dropKeys(leftTable_->getRowType(), byLeft_, leftFields_, leftResNames_);
+
+	bool leftLeft = (joinType_ == JT_LEFT || joinType_ == JT_OUTER);
+	bool rightLeft = (joinType_ == JT_RIGHT || joinType_ == JT_OUTER);
+
+	leftLookup_ = LookupJoin::make(unit_, name_ + ".leftLookup", leftTable_->getRowType(),
+			rightTable_, rightIdxType_)
+		->setLeftFields(leftFields_, leftResNames_)
+		->setRightFields(rightFields_, rightResNames_)
+		->setFieldsLeftFirst(fieldsLeftFirst_)
+		->setFieldsMirrorKey(mirror)
+		->setIsLeft(leftLeft)
+		->setOppositeOuter(rightLeft && !simpleMinded_);
+	rightLookup_ = LookupJoin::make(unit_, name_ + ".rightLookup", rightTable_->getRowType(),
+			leftTable_, leftIdxType_)
+		->setLeftFields(rightFields_, rightResNames_)
+		->setRightFields(leftFields_, leftResNames_)
+		->setFieldsLeftFirst(!fieldsLeftFirst_)
+		->setFieldsMirrorKey(mirror)
+		->setIsLeft(rightLeft)
+		->setOppositeOuter(leftLeft && !simpleMinded_);
+	for (size_t i = 0; i < byLeft_.size(); i++) {
+		leftLookup_->addBy(byLeft_[i], byRight_[i]);
+		rightLookup_->addBy(byRight_[i], byLeft_[i]);
+	}
+
+	// If this side's index is not a leaf, multiple rows on this side
+	// may match one row on the other side, so the opposite outer rows
+	// must be produced only for the first and last row of the group.
+	if (!simpleMinded_) {
+		if (rightLeft && !leftIdxType_->isLeaf())
+			leftLookup_->setGroupSizeIdx(leftTable_, leftIdxType_, selfJoin);
+		if (leftLeft && !rightIdxType_->isLeaf())
+			rightLookup_->setGroupSizeIdx(rightTable_, rightIdxType_, false);
+	}
+
+	leftLookup_->initialize();
+	errors_.fAppend(leftLookup_->getErrors(), "the left lookup join is invalid:");
+	rightLookup_->initialize();
+	errors_.fAppend(rightLookup_->getErrors(), "the right lookup join is invalid:");
+	if (errors_->hasError())
+		return;
+
+	setRowType(leftLookup_->getResultRowType());
+
+	// connect everything together
+	try {
+		leftFromLabel_->chain(leftLookup_->getInputLabel());
+		rightFromLabel_->chain(rightLookup_->getInputLabel());
+		leftLookup_->getOutputLabel()->chain(label_);
+		rightLookup_->getOutputLabel()->chain(label_);
+	} catch (Exception e) {
+		errors_.fAppend(e.getErrors(), "failed to connect the labels:");
+		return;
+	}
+
+	// no need to keep the references to the source labels any more
+	leftFromLabel_ = NULL;
+	rightFromLabel_ = NULL;
+
+	if (!errors_->hasError() && errors_->isEmpty())
+		errors_ = NULL;
+}
+
+FnReturn *JoinTwo::fnReturn() const
+{
+	if (fnReturn_.isNull()) {
+		if (!initialized_ || label_.isNull())
+			throw Exception::fTrace("JoinTwo '%s' was not successfully initialized", name_.c_str());
+		fnReturn_ = FnReturn::make(unit_, name_ + ".fret")
+			->addFromLabel("out", label_)
+		;
+		try {
+			initializeOrThrow(fnReturn_);
+		} catch (Exception e) {
+			throw Exception::f(e, "Failed to create an FnReturn on JoinTwo '%s':", name_.c_str());
+		}
+	}
+	return fnReturn_;
+}
+
+}; // TRICEPS_NS
@@ -0,0 +1,269 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A join of two tables.
+
+#ifndef __Triceps_JoinTwo_h__
+#define __Triceps_JoinTwo_h__
+
+#include <table/LookupJoin.h>
+
+namespace TRICEPS_NS {
+
+// The JoinTwo maintains a join of two tables. It reacts to the changes
+// in each table and looks up the matching rows in the other one, producing
+// the correct stream of updates for the join result, including the
+// DELETE-INSERT pairs for the transitions between the rows with and
+// without the missing side in the outer joins.
+//
+// It's the C++ version of the Perl Triceps::JoinTwo, with the field
+// selection patterns already resolved into the explicit lists of fields.
+// Internally it's built of two LookupJoins, named "name.leftLookup" and
+// "name.rightLookup", and both send their results to the output label
+// of the JoinTwo.
+//
+// The typical construction is done as a chain:
+// join = initializeOrThrow(JoinTwo::make(unit, "join", tLeft, tRight,
+//         tLeft->getType()->findSubIndex("byKey"),
+//         tRight->getType()->findSubIndex("byKey"))
+//     ->setType(JoinTwo::JT_OUTER)
+// );
+//
+// The joined rows are sent with the EM_CALL mode.
+class JoinTwo : public Gadget
+{
+public:
+	// The type of the join.
+	enum JoinType {
+		JT_INNER,
+		JT_LEFT,
+		JT_RIGHT,
+		JT_OUTER,
+	};
+
+	// The way to prevent the duplication of the key fields in the result
+	// (since by definition they have the same values on both sides).
+	enum UniqKey {
+		UK_NONE, // do nothing, don't even mirror the keys
+		UK_MANUAL, // the user takes care of it in the field lists
+		UK_LEFT, // pass the keys from the left side, drop from the right side
+		UK_RIGHT, // pass the keys from the right side, drop from the left side
+		UK_FIRST, // pass the keys from the side that goes first in the result
+	};
+
+	// Convert the join type constants between the strings and the values.
+	// @param val - value to convert
+	// @param def - default value to return if the value is unknown
+	// @return - the converted value, or def
+	static const char *joinTypeString(int val, const char *def = "???");
+	// @return - the value, or -1 if unknown
+	static int stringJoinType(const char *str);
+	// Same for the key uniqueness constants.
+	static const char *uniqKeyString(int val, const char *def = "???");
+	static int stringUniqKey(const char *str);
+
+	// @param unit - unit where the join belongs (must be the same as for
+	//        both tables)
+	// @param name - name of the join, the output label will be named "name.out"
+	// @param leftTable - the left-side table
+	// @param rightTable - the right-side table (may be the same as the left
+	//        one for a self-join)
+	// @param leftIdxType - index type in the left table used to look up
+	//        the left rows by the right rows, must have the keys in it
+	//        and all its parents
+	// @param rightIdxType - same for the right table
+	JoinTwo(Unit *unit, const string &name, Table *leftTable, Table *rightTable,
+		IndexType *leftIdxType, IndexType *rightIdxType);
+
+	// Constructor duplicated as make() for syntactically better usage.
+	static JoinTwo *make(Unit *unit, const string &name, Table *leftTable, Table *rightTable,
+		IndexType *leftIdxType, IndexType *rightIdxType)
+	{
+		return new JoinTwo(unit, name, leftTable, rightTable, leftIdxType, rightIdxType);
+	}
+
+	// All the methods that change the definition may be used only until
+	// initialized. Afterwards they will throw an Exception.
+
+	// Set the label from which to react to the rows on the left side
+	// (default: the left table's output label, or its pre-label for a
+	// self-join). It can be used to filter out some of the input.
+	// THIS IS DANGEROUS! To preserve consistency, always filter by the key
+	// field(s) only, and the same condition on the left and right.
+	// @param lb - the source label, its row type must match the left table's
+	// @return - this
+	JoinTwo *setLeftFromLabel(Label *lb);
+	// Same for the right side (default: the right table's output label).
+	JoinTwo *setRightFromLabel(Label *lb);
+
+	// Add a pair of the key fields. If never called, the keys of the
+	// indexes are paired in order. If called, the pairs must contain
+	// exactly the keys of the indexes, in any order.
+	// @param leftFld - name of the field in the left row type
+	// @param rightFld - name of the matching field in the right row type
+	// @return - this
+	JoinTwo *addBy(const string &leftFld, const string &rightFld);
+
+	// Define the fields passing through from the left side to the result.
+	// If never called, all the fields pass through with their original names.
+	// @param fields - names of the left fields, in the order they go into
+	//        the result
+	// @param resNames - names of these fields in the result, must have
+	//        the same size as fields; NULL means "same as original"
+	// @return - this
+	JoinTwo *setLeftFields(Onceref<NameSet> fields, Onceref<NameSet> resNames = (NameSet *)NULL);
+	// Same for the right side.
+	JoinTwo *setRightFields(Onceref<NameSet> fields, Onceref<NameSet> resNames = (NameSet *)NULL);
+
+	// Flag: in the result put the fields from the left side first
+	// (default: true).
+	JoinTwo *setFieldsLeftFirst(bool on);
+	// The key uniqueness mode (default: UK_FIRST).
+	JoinTwo *setFieldsUniqKey(UniqKey uk);
+	// The join type (default: JT_INNER).
+	JoinTwo *setType(JoinType jt);
+	// Flag: do not try to create the correct DELETE-INSERT sequences
+	// for the updates, just produce the rows with the same opcode as
+	// the incoming ones. The result is outright garbage, it's here only
+	// to show why it's garbage (default: false).
+	JoinTwo *setOverrideSimpleMinded(bool on);
+
+	// Check the definition, create the lookup joins and connect them.
+	// The errors are returned by getErrors().
+	// May be called repeatedly with no ill effects.
+	void initialize();
+
+	bool isInitialized() const
+	{
+		return initialized_;
+	}
+
+	// Get the errors collected during initialization.
+	Erref getErrors() const
+	{
+		return errors_;
+	}
+
+	// Get back the name (overrides the gadget method, because that
+	// name has ".out" added to it).
+	const string &getName() const
+	{
+		return name_;
+	}
+
+	// Get the output label. It's the same as the gadget's label but
+	// doesn't exist until initialized.
+	Label *getOutputLabel() const
+	{
+		return label_.get();
+	}
+
+	// Get the result row type. Not available until initialized.
+	const RowType *getResultRowType() const
+	{
+		return type_.get();
+	}
+
+	Table *getLeftTable() const
+	{
+		return leftTable_;
+	}
+	Table *getRightTable() const
+	{
+		return rightTable_;
+	}
+	IndexType *getLeftIdxType() const
+	{
+		return leftIdxType_;
+	}
+	IndexType *getRightIdxType() const
+	{
+		return rightIdxType_;
+	}
+	JoinType getType() const
+	{
+		return joinType_;
+	}
+	UniqKey getFieldsUniqKey() const
+	{
+		return uniqKey_;
+	}
+	bool getFieldsLeftFirst() const
+	{
+		return fieldsLeftFirst_;
+	}
+	bool getOverrideSimpleMinded() const
+	{
+		return simpleMinded_;
+	}
+
+	// Get the internal lookup joins. Not available until initialized.
+	LookupJoin *getLeftLookup() const
+	{
+		return leftLookup_;
+	}
+	LookupJoin *getRightLookup() const
+	{
+		return rightLookup_;
+	}
+
+	// Get the FnReturn for this join. It gets created on the first
+	// call and contains one label "out". Throws an Exception if the
+	// join is not initialized yet.
+	FnReturn *fnReturn() const;
+
+protected:
+	// Throw an Exception if already initialized.
+	void checkNotInitialized() const;
+
+	// Collect the keys of an index type and its parents, from the top down.
+	// @param ixt - the index type
+	// @param side - name of the side, for error messages
+	// @param keys - the set to add the keys to
+	// @return - true on success, false if some index has no key
+	bool collectKeys(IndexType *ixt, const char *side, NameSet &keys);
+
+	// Remove the key fields from a field list, for the key uniqueness.
+	// @param rt - row type of that side
+	// @param keys - the key fields to remove
+	// @param fields - the field list, NULL means "all fields", will be
+	//        replaced with a new list
+	// @param resNames - the result names matching the fields, may be NULL,
+	//        will be replaced with a new list
+	static void dropKeys(const RowType *rt, const NameSet &keys,
+		Autoref<NameSet> &fields, Autoref<NameSet> &resNames);
+
+	Autoref<Table> leftTable_;
+	Autoref<Table> rightTable_;
+	Autoref<IndexType> leftIdxType_;
+	Autoref<IndexType> rightIdxType_;
+	Autoref<Label> leftFromLabel_; // may be NULL
+	Autoref<Label> rightFromLabel_; // may be NULL
+	Autoref<NameSet> leftFields_; // may be NULL
+	Autoref<NameSet> leftResNames_; // may be NULL
+	Autoref<NameSet> rightFields_; // may be NULL
+	Autoref<NameSet> rightResNames_; // may be NULL
+	NameSet byLeft_; // the left side of the key pairs
+	NameSet byRight_; // the right side of the key pairs
+	Autoref<LookupJoin> leftLookup_; // reacts to the left table, looks up in the right one
+	Autoref<LookupJoin> rightLookup_; // reacts to the right table, looks up in the left one
+	mutable Autoref<FnReturn> fnReturn_; // created on demand
+	Erref errors_;
+	string name_; // base name of the join
+	JoinType joinType_;
+	UniqKey uniqKey_;
+	bool fieldsLeftFirst_;
+	bool simpleMinded_;
+	bool initialized_;
+
+private:
+	JoinTwo(const JoinTwo &);
+	void operator=(const JoinTwo &);
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_JoinTwo_h__
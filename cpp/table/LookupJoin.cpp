@@ -0,0 +1,382 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A join by performing a look-up in a table (like "stream-to-window" in CCL).
+
+#include <table/LookupJoin.h>
+#include <mem/Rhref.h>
+#include <common/Exception.h>
+
+namespace TRICEPS_NS {
+
+////////////////////////////////////// LookupJoin::InputLabel ////////////////////////////////////
+
+LookupJoin::InputLabel::InputLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, LookupJoin *join) :
+	Label(unit, rtype, name),
+	join_(join)
+{ }
+
+void LookupJoin::InputLabel::execute(Rowop *arg) const
+{
+	join_->lookup(arg->getOpcode(), arg->getRow());
+}
+
+void LookupJoin::InputLabel::clearSubclass()
+{
+	join_ = NULL;
+}
+
+////////////////////////////////////// LookupJoin ////////////////////////////////////
+
+LookupJoin::LookupJoin(Unit *unit, const string &name, const RowType *leftRowType,
+		Table *rightTable, IndexType *rightIdxType) :
+	Gadget(unit, Gadget::EM_CALL, name + ".out"),
+	inputLabel_(new InputLabel(unit, leftRowType, name + ".in", this)),
+	leftRowType_(leftRowType),
+	rightTable_(rightTable),
+	rightIdxType_(rightIdxType),
+	name_(name),
+	fieldsLeftFirst_(true),
+	fieldsMirrorKey_(false),
+	fieldsDropRightKey_(false),
+	isLeft_(true),
+	limitOne_(false),
+	oppositeOuter_(false),
+	groupFromPre_(false),
+	initialized_(false)
+{ }
+
+void LookupJoin::checkNotInitialized() const
+{
+	if (initialized_)
+		throw Exception::fTrace("Attempted to change the definition of an initialized LookupJoin '%s'", name_.c_str());
+}
+
+LookupJoin *LookupJoin::addBy(const string &leftFld, const string &rightFld)
+{
+	checkNotInitialized();
+	byLeft_.push_back(leftFld);
+	byRight_.push_back(rightFld);
+	return this;
+}
+
+LookupJoin *LookupJoin::setLeftFields(Onceref<NameSet> fields, Onceref<NameSet> resNames)
+{
+	checkNotInitialized();
+	leftFields_ = fields;
+	leftResNames_ = resNames;
+	return this;
+}
+
+LookupJoin *LookupJoin::setRightFields(Onceref<NameSet> fields, Onceref<NameSet> resNames)
+{
+	checkNotInitialized();
+	rightFields_ = fields;
+	rightResNames_ = resNames;
+	return this;
+}
+
+LookupJoin *LookupJoin::setFieldsLeftFirst(bool on)
+{
+	checkNotInitialized();
+	fieldsLeftFirst_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setFieldsMirrorKey(bool on)
+{
+	checkNotInitialized();
+	fieldsMirrorKey_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setFieldsDropRightKey(bool on)
+{
+	checkNotInitialized();
+	fieldsDropRightKey_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setIsLeft(bool on)
+{
+	checkNotInitialized();
+	isLeft_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setLimitOne(bool on)
+{
+	checkNotInitialized();
+	limitOne_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setOppositeOuter(bool on)
+{
+	checkNotInitialized();
+	oppositeOuter_ = on;
+	return this;
+}
+
+LookupJoin *LookupJoin::setGroupSizeIdx(Table *leftTable, IndexType *leftIdxType, bool fromPre)
+{
+	checkNotInitialized();
+	groupTable_ = leftTable;
+	groupIdxType_ = leftIdxType;
+	groupFromPre_ = fromPre;
+	return this;
+}
+
+void LookupJoin::addResultFields(bool left, const NameSet *fields, const NameSet *resNames,
+	RowType::FieldVec &resdef)
+{
+	const char *side = (left? "left" : "right");
+	const RowType *rt = (left? leftRowType_.get() : rightTable_->getRowType());
+	const RowType::FieldVec &srcdef = rt->fields();
+
+	if (resNames != NULL && (fields == NULL || fields->size() != resNames->size())) {
+		errors_.f("the %s result names must match the %s fields one-to-one", side, side);
+		return;
+	}
+
+	size_t n = (fields == NULL? srcdef.size() : fields->size());
+	for (size_t i = 0; i < n; i++) {
+		int idx;
+		if (fields == NULL) {
+			idx = i;
+		} else {
+			idx = rt->findIdx((*fields)[i]);
+			if (idx < 0) {
+				errors_.f("the %s field '%s' is not in the %s row type", side, (*fields)[i].c_str(), side);
+				continue;
+			}
+		}
+
+		ResultField rf(left, idx);
+		int k;
+		for (k = 0; k < (int)keys_.size(); k++)
+			if ((left? keys_[k].left_ : keys_[k].right_) == idx)
+				break;
+		if (k < (int)keys_.size()) {
+			if (!left && fieldsDropRightKey_)
+				continue;
+			if (fieldsMirrorKey_)
+				rf.mirror_ = keys_[k].left_;
+		}
+
+		result_.push_back(rf);
+		resdef.push_back(srcdef[idx]);
+		if (resNames != NULL)
+			resdef.back().name_ = (*resNames)[i];
+	}
+}
+
+void LookupJoin::initialize()
+{
+	if (initialized_)
+		return;
+	initialized_ = true;
+
+	errors_ = new Errors;
+
+	const RowType *rightRowType = rightTable_->getRowType();
+
+	if (rightIdxType_->getTabtype() != rightTable_->getType()) {
+		errors_.f("the right index type must belong to the right table's type");
+		return;
+	}
+
+	// collect the keys of the index and its parents
+	NameSet idxkeys;
+	for (IndexType *ixt = rightIdxType_; ixt != NULL && ixt->getIndexId() != IndexType::IT_ROOT;
+			ixt = ixt->getParent()) {
+		const NameSet *key = ixt->getKey();
+		if (key == NULL || key->empty()) {
+			errors_.f("the right index type and its parents must have the keys");
+			return;
+		}
+		idxkeys.insert(idxkeys.end(), key->begin(), key->end());
+	}
+
+	if (byLeft_.empty())
+		errors_.f("the join condition must contain at least one pair of fields");
+
+	for (size_t i = 0; i < byLeft_.size(); i++) {
+		int li = leftRowType_->findIdx(byLeft_[i]);
+		if (li < 0) {
+			errors_.f("the join condition contains an unknown left-side field '%s'", byLeft_[i].c_str());
+			continue;
+		}
+		int ri = rightRowType->findIdx(byRight_[i]);
+		if (ri < 0) {
+			errors_.f("the join condition contains an unknown right-side field '%s'", byRight_[i].c_str());
+			continue;
+		}
+		const RowType::Field &lf = leftRowType_->fields()[li];
+		const RowType::Field &rf = rightRowType->fields()[ri];
+		if (!lf.type_->equals(rf.type_) || lf.arsz_ != rf.arsz_) {
+			errors_.f("the join condition fields '%s'='%s' have different types",
+				byLeft_[i].c_str(), byRight_[i].c_str());
+			continue;
+		}
+		size_t j;
+		for (j = 0; j < keys_.size(); j++) {
+			if (keys_[j].right_ == ri) {
+				errors_.f("the join condition contains the right-side field '%s' more than once", byRight_[i].c_str());
+				break;
+			}
+		}
+		if (j < keys_.size())
+			continue;
+		keys_.push_back(KeyPair(li, ri));
+	}
+
+	// the right side of the condition must match the index keys exactly
+	for (size_t i = 0; i < idxkeys.size(); i++) {
+		size_t j;
+		for (j = 0; j < byRight_.size(); j++)
+			if (byRight_[j] == idxkeys[i])
+				break;
+		if (j == byRight_.size())
+			errors_.f("the index key field '%s' is missing from the join condition", idxkeys[i].c_str());
+	}
+	for (size_t i = 0; i < byRight_.size(); i++) {
+		size_t j;
+		for (j = 0; j < idxkeys.size(); j++)
+			if (byRight_[i] == idxkeys[j])
+				break;
+		if (j == idxkeys.size())
+			errors_.f("the join condition contains a right-side field '%s' that is not in the index key", byRight_[i].c_str());
+	}
+
+	if (!groupTable_.isNull()) {
+		if (!oppositeOuter_)
+			errors_.f("the group size index may be used only with oppositeOuter");
+		if (!groupTable_->getRowType()->match(leftRowType_))
+			errors_.f("the group size table's row type does not match the left row type");
+		if (groupIdxType_->getTabtype() != groupTable_->getType())
+			errors_.f("the group size index type must belong to the group size table's type");
+	}
+
+	if (rightIdxType_->isLeaf())
+		limitOne_ = true;
+	else
+		iterIdxType_ = rightIdxType_->getSubIndexes()[0].index_;
+
+	RowType::FieldVec resdef;
+	if (fieldsLeftFirst_) {
+		addResultFields(true, leftFields_, leftResNames_, resdef);
+		addResultFields(false, rightFields_, rightResNames_, resdef);
+	} else {
+		addResultFields(false, rightFields_, rightResNames_, resdef);
+		addResultFields(true, leftFields_, leftResNames_, resdef);
+	}
+
+	if (errors_->hasError())
+		return;
+
+	Autoref<RowType> rt = leftRowType_->newSameFormat(resdef);
+	if (rt->getErrors()->hasError()) {
+		errors_.fAppend(rt->getErrors(), "the result row type is invalid:");
+		return;
+	}
+	setRowType(rt);
+
+	if (!errors_->hasError() && errors_->isEmpty())
+		errors_ = NULL;
+}
+
+void LookupJoin::sendResult(Rowop::Opcode opcode, const Row *leftRow, const Row *rightRow, Tray *dest,
+	bool noLeft) const
+{
+	const RowType *rightRowType = rightTable_->getRowType();
+	size_t n = result_.size();
+	FdataVec fields(n);
+
+	for (size_t i = 0; i < n; i++) {
+		const ResultField &rf = result_[i];
+		if (rf.left_) {
+			if (!noLeft)
+				fields[i].setFrom(leftRowType_, leftRow, rf.idx_);
+			else if (rf.mirror_ >= 0)
+				fields[i].setFrom(leftRowType_, leftRow, rf.mirror_);
+		} else if (rightRow != NULL)
+			fields[i].setFrom(rightRowType, rightRow, rf.idx_);
+		else if (rf.mirror_ >= 0)
+			fields[i].setFrom(leftRowType_, leftRow, rf.mirror_);
+		// else leave it NULL
+	}
+
+	Rowref res(type_, type_->makeRow(fields));
+	if (dest == NULL)
+		send(res, opcode);
+	else
+		sendDelayed(dest, res, opcode);
+}
+
+void LookupJoin::sendFound(Rowop::Opcode opcode, const Row *leftRow, const Row *rightRow, Tray *dest,
+	bool sendOpp) const
+{
+	if (!oppositeOuter_) {
+		sendResult(opcode, leftRow, rightRow, dest);
+	} else if (Rowop::isInsert(opcode)) {
+		if (sendOpp)
+			sendResult(Rowop::OP_DELETE, leftRow, rightRow, dest, true);
+		sendResult(opcode, leftRow, rightRow, dest);
+	} else if (Rowop::isDelete(opcode)) {
+		sendResult(opcode, leftRow, rightRow, dest);
+		if (sendOpp)
+			sendResult(Rowop::OP_INSERT, leftRow, rightRow, dest, true);
+	}
+}
+
+void LookupJoin::lookup(Rowop::Opcode opcode, const Row *leftRow, Tray *dest) const
+{
+	if (!initialized_ || label_.isNull())
+		throw Exception::fTrace("LookupJoin '%s' was not successfully initialized", name_.c_str());
+
+	Table *t = rightTable_;
+
+	// build the pattern row from the key fields
+	FdataVec pattern(t->getRowType()->fieldCount());
+	for (size_t i = 0; i < keys_.size(); i++)
+		pattern[keys_[i].right_].setFrom(leftRowType_, leftRow, keys_[i].left_);
+	Rhref what(t, pattern);
+
+	// The found rows are held in Rhrefs, in case if the processing of
+	// the results modifies the table.
+	Rhref rh(t, t->findIdx(rightIdxType_, what));
+
+	if (rh.isNull()) {
+		if (isLeft_)
+			sendResult(opcode, leftRow, NULL, dest);
+		return;
+	}
+
+	// The opposite rowops get sent only on the insertion of the first
+	// or deletion of the last row in the left group.
+	bool sendOpp = true;
+	if (oppositeOuter_ && !groupTable_.isNull()) {
+		int gsz = (int)groupTable_->groupSizeRowIdx(groupIdxType_, leftRow);
+		if (groupFromPre_)
+			gsz += (Rowop::isInsert(opcode)? 1 : -1);
+		if (Rowop::isInsert(opcode))
+			sendOpp = (gsz == 1);
+		else
+			sendOpp = (gsz == 0);
+	}
+
+	if (limitOne_) {
+		sendFound(opcode, leftRow, rh->getRow(), dest, sendOpp);
+		return;
+	}
+
+	Rhref endrh(t, t->nextGroupIdx(iterIdxType_, rh));
+	for (; !rh.isNull() && rh.get() != endrh.get(); rh = t->nextIdx(rightIdxType_, rh))
+		sendFound(opcode, leftRow, rh->getRow(), dest, sendOpp);
+}
+
+}; // TRICEPS_NS
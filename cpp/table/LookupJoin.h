@@ -0,0 +1,305 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// A join by performing a look-up in a table (like "stream-to-window" in CCL).
+
+#ifndef __Triceps_LookupJoin_h__
+#define __Triceps_LookupJoin_h__
+
+#include <table/Table.h>
+#include <type/NameSet.h>
+
+namespace TRICEPS_NS {
+
+// The LookupJoin receives the rows on its input label, looks up the
+// matching rows in the right-side table, and sends the joined rows
+// through its output label, with the same opcode as the incoming rowop.
+// It's the C++ version of the Perl Triceps::LookupJoin, with the field
+// selection patterns already resolved into the explicit lists of fields.
+//
+// The typical construction is done as a chain:
+// join = initializeOrThrow(LookupJoin::make(unit, "join", rtLeft, rightTable,
+//         rightTable->getType()->findSubIndex("byKey"))
+//     ->addBy("k", "key")
+//     ->setIsLeft(false)
+// );
+//
+// The joined rows are sent with the EM_CALL mode.
+//
+// Unlike the Table, the input label holds a reference to the join, so the
+// join stays alive for as long as its input label is not cleared. This
+// creates a reference cycle that gets broken when the unit clears its labels.
+class LookupJoin : public Gadget
+{
+public:
+	// @param unit - unit where the join belongs
+	// @param name - name of the join, the input label will be named "name.in"
+	//        and the output label "name.out"
+	// @param leftRowType - type of the rows coming into the join
+	// @param rightTable - table where the look-ups are done
+	// @param rightIdxType - index type (from the right table's type) used
+	//        for the look-ups, the keys of it and all its parents must be
+	//        fully specified by addBy()
+	LookupJoin(Unit *unit, const string &name, const RowType *leftRowType,
+		Table *rightTable, IndexType *rightIdxType);
+
+	// Constructor duplicated as make() for syntactically better usage.
+	static LookupJoin *make(Unit *unit, const string &name, const RowType *leftRowType,
+		Table *rightTable, IndexType *rightIdxType)
+	{
+		return new LookupJoin(unit, name, leftRowType, rightTable, rightIdxType);
+	}
+
+	// All the methods that change the definition may be used only until
+	// initialized. Afterwards they will throw an Exception.
+
+	// Add a pair of the key fields for the look-up. The right-side
+	// fields must match the key of the index exactly, and the types
+	// on both sides must be the same. The order of pairs is not important.
+	// @param leftFld - name of the field in the left row type
+	// @param rightFld - name of the matching field in the right row type
+	// @return - this
+	LookupJoin *addBy(const string &leftFld, const string &rightFld);
+
+	// Define the fields passing through from the left side to the result.
+	// If never called, all the fields pass through with their original names.
+	// @param fields - names of the left fields, in the order they go into
+	//        the result
+	// @param resNames - names of these fields in the result, must have
+	//        the same size as fields; NULL means "same as original"
+	// @return - this
+	LookupJoin *setLeftFields(Onceref<NameSet> fields, Onceref<NameSet> resNames = (NameSet *)NULL);
+	// Same for the right side.
+	LookupJoin *setRightFields(Onceref<NameSet> fields, Onceref<NameSet> resNames = (NameSet *)NULL);
+
+	// Flag: in the result put the fields from the left side first
+	// (default: true).
+	LookupJoin *setFieldsLeftFirst(bool on);
+	// Flag: if the row on the right is not found, the right-side key
+	// fields in the result get the values of the matching left-side
+	// fields (default: false).
+	LookupJoin *setFieldsMirrorKey(bool on);
+	// Flag: exclude the right-side key fields from the result, since
+	// they are duplicates of the left-side ones anyway (default: false).
+	LookupJoin *setFieldsDropRightKey(bool on);
+	// Flag: true for the left outer join, false for the inner join
+	// (default: true).
+	LookupJoin *setIsLeft(bool on);
+	// Flag: produce no more than one result row per input row
+	// (default: false). Gets forced to true if the right index is a leaf.
+	LookupJoin *setLimitOne(bool on);
+	// Flag: this is a half of a JoinTwo, and the other half performs an
+	// outer join (from its standpoint, left). For this side it means that
+	// it's a right outer join, and a successful look-up must generate a
+	// DELETE-INSERT pair, replacing the result row with a missing left
+	// side by the full result row, or the other way around (default: false).
+	// The rowops with the opcodes other than INSERT or DELETE produce
+	// no result when a match is found.
+	LookupJoin *setOppositeOuter(bool on);
+	// Used only with oppositeOuter, when the index on this join's left
+	// side is not a leaf, so multiple left rows may match each right row.
+	// Then the DELETE-INSERT pair for the opposite side needs to be generated
+	// only on the insertion of the first or deletion of the last
+	// row in the left side's group. Without this setting, the pair is always
+	// generated.
+	// @param leftTable - the table where the left rows come from, its
+	//        row type must match the left row type
+	// @param leftIdxType - index type in the left table, that defines the
+	//        groups
+	// @param fromPre - flag: the left rows come from the table's pre-label,
+	//        so the group size needs to be adjusted for the change that is
+	//        about to happen
+	// @return - this
+	LookupJoin *setGroupSizeIdx(Table *leftTable, IndexType *leftIdxType, bool fromPre);
+
+	// Check the definition and build the result row type.
+	// The errors are returned by getErrors().
+	// May be called repeatedly with no ill effects.
+	void initialize();
+
+	bool isInitialized() const
+	{
+		return initialized_;
+	}
+
+	// Get the errors collected during initialization.
+	Erref getErrors() const
+	{
+		return errors_;
+	}
+
+	// Get back the name (overrides the gadget method, because that
+	// name has ".out" added to it).
+	const string &getName() const
+	{
+		return name_;
+	}
+
+	// Get the label for sending the rowops into the join.
+	Label *getInputLabel() const
+	{
+		return inputLabel_.get();
+	}
+
+	// Get the output label. It's the same as the gadget's label but
+	// doesn't exist until initialized.
+	Label *getOutputLabel() const
+	{
+		return label_.get();
+	}
+
+	// Get the result row type. Not available until initialized.
+	const RowType *getResultRowType() const
+	{
+		return type_.get();
+	}
+
+	const RowType *getLeftRowType() const
+	{
+		return leftRowType_;
+	}
+	Table *getRightTable() const
+	{
+		return rightTable_;
+	}
+	IndexType *getRightIdxType() const
+	{
+		return rightIdxType_;
+	}
+	bool getIsLeft() const
+	{
+		return isLeft_;
+	}
+	// After initialization reflects the forced setting for a leaf index.
+	bool getLimitOne() const
+	{
+		return limitOne_;
+	}
+	bool getOppositeOuter() const
+	{
+		return oppositeOuter_;
+	}
+
+	// Perform the look-up and produce the result.
+	// Throws an Exception if not initialized yet.
+	// @param opcode - opcode for the result rowops
+	// @param leftRow - the row to look up
+	// @param dest - if not NULL, the result rowops get collected on this tray
+	//        instead of being called
+	void lookup(Rowop::Opcode opcode, const Row *leftRow, Tray *dest = NULL) const;
+
+protected:
+	class InputLabel: public Label
+	{
+		friend class LookupJoin;
+	public:
+		InputLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name, LookupJoin *join);
+
+	protected:
+		// from Label
+		virtual void execute(Rowop *arg) const;
+		// from Label
+		// Drops the reference to the join, breaking the cycle.
+		virtual void clearSubclass();
+
+		Autoref<LookupJoin> join_;
+	};
+
+	// Description of how to build a result field.
+	struct ResultField
+	{
+		ResultField(bool left, int idx) :
+			left_(left),
+			idx_(idx),
+			mirror_(-1)
+		{ }
+
+		bool left_; // the field comes from the left row
+		int idx_; // index of the field in the source row type
+		int mirror_; // for a key field with fieldsMirrorKey, the
+			// index of the left field to use if the row of this side is
+			// missing, or -1
+	};
+	typedef vector<ResultField> ResultFieldVec;
+
+	// A pair of key fields, by index.
+	struct KeyPair
+	{
+		KeyPair(int left, int right) :
+			left_(left),
+			right_(right)
+		{ }
+
+		int left_; // index of the field in the left row type
+		int right_; // index of the field in the right row type
+	};
+	typedef vector<KeyPair> KeyPairVec;
+
+	// Throw an Exception if already initialized.
+	void checkNotInitialized() const;
+
+	// Add the fields of one side to the result definition.
+	// @param left - flag: this is the left side
+	// @param fields - selection of the fields, may be NULL
+	// @param resNames - names of the fields in the result, may be NULL
+	// @param resdef - result row type definition to add to
+	void addResultFields(bool left, const NameSet *fields, const NameSet *resNames,
+		RowType::FieldVec &resdef);
+
+	// Build and send (or collect) one result row.
+	// @param opcode - opcode for the result rowop
+	// @param leftRow - the left row
+	// @param rightRow - the right row, or NULL if not found
+	// @param dest - tray to collect the rowop, or NULL to call it
+	// @param noLeft - flag: build the row as if the left row were missing
+	//        (for the opposite outer join), only the mirrored key fields
+	//        are taken from it
+	void sendResult(Rowop::Opcode opcode, const Row *leftRow, const Row *rightRow, Tray *dest,
+		bool noLeft = false) const;
+
+	// Send the result for one found right row. Handles the oppositeOuter logic.
+	// @param opcode - opcode for the result rowop
+	// @param leftRow - the left row
+	// @param rightRow - the right row
+	// @param dest - tray to collect the rowop, or NULL to call it
+	// @param sendOpp - flag: send the opposite rowop for oppositeOuter
+	void sendFound(Rowop::Opcode opcode, const Row *leftRow, const Row *rightRow, Tray *dest,
+		bool sendOpp) const;
+
+	Autoref<InputLabel> inputLabel_;
+	Autoref<const RowType> leftRowType_;
+	Autoref<Table> rightTable_;
+	Autoref<IndexType> rightIdxType_;
+	Autoref<IndexType> iterIdxType_; // the first sub-index of rightIdxType_, used to find the end of the group
+	Autoref<Table> groupTable_; // for oppositeOuter, the table on the left side, may be NULL
+	Autoref<IndexType> groupIdxType_; // for oppositeOuter, the group index in groupTable_
+	Autoref<NameSet> leftFields_; // may be NULL
+	Autoref<NameSet> leftResNames_; // may be NULL
+	Autoref<NameSet> rightFields_; // may be NULL
+	Autoref<NameSet> rightResNames_; // may be NULL
+	NameSet byLeft_; // the left side of the key pairs
+	NameSet byRight_; // the right side of the key pairs
+	KeyPairVec keys_; // the key pairs, by index, computed on initialization
+	ResultFieldVec result_; // how to build the result, computed on initialization
+	Erref errors_;
+	string name_; // base name of the join
+	bool fieldsLeftFirst_;
+	bool fieldsMirrorKey_;
+	bool fieldsDropRightKey_;
+	bool isLeft_;
+	bool limitOne_;
+	bool oppositeOuter_;
+	bool groupFromPre_; // the group size is computed before the modification
+	bool initialized_;
+
+private:
+	LookupJoin(const LookupJoin &);
+	void operator=(const LookupJoin &);
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_LookupJoin_h__
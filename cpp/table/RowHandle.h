@@ -12,6 +12,7 @@
 #include <common/Common.h>
 #include <mem/Starget.h>
 #include <mem/Row.h>
+#include <mem/SlabAlloc.h>
 
 namespace TRICEPS_NS {
 
@@ -48,16 +49,18 @@ public:
 	typedef double AlignType;
 
 	// Allocation initializes the memory to 0.
+	// The handles come from the slab allocator, since they get created
+	// and destroyed for every row going through a table.
 	// @param basic - provided by C++ compiler, size of the basic structure
 	// @param variable - actual size in bytes for data_[]
 	static void *operator new(size_t basic, intptr_t variable)
 	{
 		// GCC 4.1 doesn't like sizeof(data_) here
-		return calloc(1, (intptr_t)basic + variable - sizeof(AlignType)); 
+		return SlabAlloc::allocZero((intptr_t)basic + variable - sizeof(AlignType)); 
 	}
 	static void operator delete(void *ptr)
 	{
-		free(ptr);
+		SlabAlloc::release(ptr);
 	}
 
 	// here offsets are relative to &data_!
@@ -0,0 +1,296 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Aggregator with the SQL-like functions computed in C++.
+
+#include <table/SimpleAggregator.h>
+#include <table/Index.h>
+#include <sched/AggregatorGadget.h>
+
+namespace TRICEPS_NS {
+
+SimpleAggregator::SimpleAggregator(const SimpleAggregatorType *type) :
+	type_(type),
+	state_(type->fields_.size())
+{ }
+
+void SimpleAggregator::addRow(const RowHandle *rh)
+{
+	const RowType *rt = type_->argType_;
+	const Row *row = rh->getRow();
+	size_t n = state_.size();
+	for (size_t i = 0; i < n; i++) {
+		const FieldDef &fd = type_->fields_[i];
+		if (fd.argIdx_ < 0 || rt->isFieldNull(row, fd.argIdx_))
+			continue;
+		State &st = state_[i];
+
+		switch (fd.func_) {
+		case SimpleAggregatorType::FN_COUNT:
+			st.count_++;
+			break;
+		case SimpleAggregatorType::FN_SUM:
+		case SimpleAggregatorType::FN_AVG:
+			st.count_++;
+			if (fd.argFloat_)
+				st.fsum_ += rt->getFloat64(row, fd.argIdx_);
+			else if (rt->fields()[fd.argIdx_].type_->getTypeId() == Type::TT_UINT8)
+				st.isum_ += rt->getUint8(row, fd.argIdx_);
+			else if (rt->fields()[fd.argIdx_].type_->getTypeId() == Type::TT_INT32)
+				st.isum_ += rt->getInt32(row, fd.argIdx_);
+			else
+				st.isum_ += rt->getInt64(row, fd.argIdx_);
+			break;
+		case SimpleAggregatorType::FN_MIN:
+		case SimpleAggregatorType::FN_MAX:
+			if (fd.ordPos_ >= 0 || st.dirty_)
+				break; // will be found later
+			if (st.ext_ == NULL || better(fd, row, st.ext_->getRow()))
+				st.ext_ = const_cast<RowHandle *>(rh);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void SimpleAggregator::removeRow(const RowHandle *rh)
+{
+	const RowType *rt = type_->argType_;
+	const Row *row = rh->getRow();
+	size_t n = state_.size();
+	for (size_t i = 0; i < n; i++) {
+		const FieldDef &fd = type_->fields_[i];
+		if (fd.argIdx_ < 0 || rt->isFieldNull(row, fd.argIdx_))
+			continue;
+		State &st = state_[i];
+
+		switch (fd.func_) {
+		case SimpleAggregatorType::FN_COUNT:
+			st.count_--;
+			break;
+		case SimpleAggregatorType::FN_SUM:
+		case SimpleAggregatorType::FN_AVG:
+			st.count_--;
+			if (fd.argFloat_)
+				st.fsum_ -= rt->getFloat64(row, fd.argIdx_);
+			else if (rt->fields()[fd.argIdx_].type_->getTypeId() == Type::TT_UINT8)
+				st.isum_ -= rt->getUint8(row, fd.argIdx_);
+			else if (rt->fields()[fd.argIdx_].type_->getTypeId() == Type::TT_INT32)
+				st.isum_ -= rt->getInt32(row, fd.argIdx_);
+			else
+				st.isum_ -= rt->getInt64(row, fd.argIdx_);
+			if (st.count_ == 0) // get rid of the accumulated rounding errors
+				st.fsum_ = 0.;
+			break;
+		case SimpleAggregatorType::FN_MIN:
+		case SimpleAggregatorType::FN_MAX:
+			if (st.ext_ == rh) {
+				st.ext_ = NULL;
+				st.dirty_ = true;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool SimpleAggregator::better(const FieldDef &fd, const Row *r1, const Row *r2) const
+{
+	const RowType *rt = type_->argType_;
+	const char *v1, *v2;
+	intptr_t len1, len2;
+	rt->getField(r1, fd.argIdx_, v1, len1);
+	rt->getField(r2, fd.argIdx_, v2, len2);
+	int cmp = rt->fields()[fd.argIdx_].type_->cmpValue(v1, len1, v2, len2);
+	if (fd.func_ == SimpleAggregatorType::FN_MIN)
+		return cmp < 0;
+	else
+		return cmp > 0;
+}
+
+const RowHandle *SimpleAggregator::findExtreme(const FieldDef &fd, State &st, Index *index,
+	const IndexType *parentIndexType, GroupHandle *gh)
+{
+	const RowType *rt = type_->argType_;
+	RowHandle *rh;
+
+	if (fd.ordPos_ >= 0) {
+		// The Ordered index places the NULLs before the other values in the
+		// ascending order and after them in the descending order.
+		Index *ordidx = parentIndexType->groupToIndex(gh, fd.ordPos_);
+		if ((fd.func_ == SimpleAggregatorType::FN_MAX) == fd.ordAsc_) {
+			rh = ordidx->last();
+			if (rh == NULL || !rt->isFieldNull(rh->getRow(), fd.argIdx_))
+				return rh;
+			// only the descending index can get here, when it has
+			// NULLs at the end; the last non-NULL value has to be found
+			// by iteration
+			const RowHandle *found = NULL;
+			for (rh = ordidx->begin(); rh != NULL; rh = ordidx->next(rh)) {
+				if (rt->isFieldNull(rh->getRow(), fd.argIdx_))
+					break;
+				found = rh;
+			}
+			return found;
+		} else {
+			for (rh = ordidx->begin(); rh != NULL; rh = ordidx->next(rh)) {
+				if (!rt->isFieldNull(rh->getRow(), fd.argIdx_))
+					return rh;
+			}
+			return NULL;
+		}
+	}
+
+	if (st.dirty_) {
+		st.ext_ = NULL;
+		for (rh = index->begin(); rh != NULL; rh = index->next(rh)) {
+			const Row *row = rh->getRow();
+			if (rt->isFieldNull(row, fd.argIdx_))
+				continue;
+			if (st.ext_ == NULL || better(fd, row, st.ext_->getRow()))
+				st.ext_ = rh;
+		}
+		st.dirty_ = false;
+	}
+	return st.ext_;
+}
+
+// A buffer for the numeric result values.
+union NumBuf {
+	uint8_t u8_;
+	int32_t i32_;
+	int64_t i64_;
+	double f64_;
+};
+
+// Set a numeric result field, converting the value to its type.
+// @param fld - definition of the result field
+// @param fd - field data to set
+// @param buf - buffer for the value
+// @param ival - the integer value (used if isFloat is false)
+// @param fval - the floating-point value (used if isFloat is true)
+// @param isFloat - flag: the value is in fval
+static void setNumber(const RowType::Field &fld, Fdata &fd, NumBuf &buf,
+	int64_t ival, double fval, bool isFloat)
+{
+	switch (fld.type_->getTypeId()) {
+	case Type::TT_UINT8:
+		buf.u8_ = (uint8_t)(isFloat? (int64_t)fval : ival);
+		fd.setPtr(true, &buf.u8_, sizeof(buf.u8_));
+		break;
+	case Type::TT_INT32:
+		buf.i32_ = (int32_t)(isFloat? (int64_t)fval : ival);
+		fd.setPtr(true, &buf.i32_, sizeof(buf.i32_));
+		break;
+	case Type::TT_INT64:
+		buf.i64_ = (isFloat? (int64_t)fval : ival);
+		fd.setPtr(true, &buf.i64_, sizeof(buf.i64_));
+		break;
+	case Type::TT_FLOAT64:
+		buf.f64_ = (isFloat? fval : (double)ival);
+		fd.setPtr(true, &buf.f64_, sizeof(buf.f64_));
+		break;
+	default:
+		fd.setNull();
+		break;
+	}
+}
+
+void SimpleAggregator::handle(Table *table, AggregatorGadget *gadget, Index *index,
+	const IndexType *parentIndexType, GroupHandle *gh, Tray *dest,
+	AggOp aggop, Rowop::Opcode opcode, RowHandle *rh)
+{
+	if (aggop == AO_AFTER_INSERT)
+		addRow(rh);
+	else if (aggop == AO_AFTER_DELETE)
+		removeRow(rh);
+
+	// like the Perl SimpleAggregator, send nothing on the empty groups
+	if (Rowop::isNop(opcode) || parentIndexType->groupSize(gh) == 0)
+		return;
+
+	const RowType *rt = type_->argType_;
+	const RowType *resrt = type_->getRowType();
+	const RowType::FieldVec &resfld = resrt->fields();
+	size_t n = state_.size();
+	FdataVec fields(n);
+	vector<NumBuf> buf(n);
+
+	for (size_t i = 0; i < n; i++) {
+		const FieldDef &fd = type_->fields_[i];
+		State &st = state_[i];
+		Fdata &f = fields[fd.resIdx_];
+		const RowHandle *src = NULL;
+
+		switch (fd.func_) {
+		case SimpleAggregatorType::FN_FIRST:
+			src = index->begin();
+			break;
+		case SimpleAggregatorType::FN_LAST:
+			src = index->last();
+			break;
+		case SimpleAggregatorType::FN_MIN:
+		case SimpleAggregatorType::FN_MAX:
+			src = findExtreme(fd, st, index, parentIndexType, gh);
+			if (src == NULL) {
+				f.setNull();
+				continue;
+			}
+			break;
+		case SimpleAggregatorType::FN_COUNT_STAR:
+			setNumber(resfld[fd.resIdx_], f, buf[i], (int64_t)parentIndexType->groupSize(gh), 0., false);
+			continue;
+		case SimpleAggregatorType::FN_COUNT:
+			setNumber(resfld[fd.resIdx_], f, buf[i], st.count_, 0., false);
+			continue;
+		case SimpleAggregatorType::FN_SUM:
+			setNumber(resfld[fd.resIdx_], f, buf[i], st.isum_, st.fsum_, fd.argFloat_);
+			continue;
+		case SimpleAggregatorType::FN_AVG:
+			if (st.count_ == 0)
+				f.setNull();
+			else
+				setNumber(resfld[fd.resIdx_], f, buf[i], 0,
+					(fd.argFloat_? st.fsum_ : (double)st.isum_) / (double)st.count_, true);
+			continue;
+		default:
+			f.setNull();
+			continue;
+		}
+
+		// the value comes from the argument field of a row
+		if (src == NULL) {
+			f.setNull();
+		} else if (fd.copy_) {
+			f.setFrom(rt, src->getRow(), fd.argIdx_);
+		} else if (rt->isFieldNull(src->getRow(), fd.argIdx_)) {
+			f.setNull();
+		} else if (fd.argFloat_) {
+			setNumber(resfld[fd.resIdx_], f, buf[i], 0,
+				rt->getFloat64(src->getRow(), fd.argIdx_), true);
+		} else {
+			int64_t v;
+			switch (rt->fields()[fd.argIdx_].type_->getTypeId()) {
+			case Type::TT_UINT8:
+				v = rt->getUint8(src->getRow(), fd.argIdx_);
+				break;
+			case Type::TT_INT32:
+				v = rt->getInt32(src->getRow(), fd.argIdx_);
+				break;
+			default:
+				v = rt->getInt64(src->getRow(), fd.argIdx_);
+				break;
+			}
+			setNumber(resfld[fd.resIdx_], f, buf[i], v, 0., false);
+		}
+	}
+
+	gadget->sendDelayed(dest, fields, opcode);
+}
+
+}; // TRICEPS_NS
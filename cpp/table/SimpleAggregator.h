@@ -0,0 +1,87 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Aggregator with the SQL-like functions computed in C++.
+
+#ifndef __Triceps_SimpleAggregator_h__
+#define __Triceps_SimpleAggregator_h__
+
+#include <table/Aggregator.h>
+#include <type/SimpleAggregatorType.h>
+
+namespace TRICEPS_NS {
+
+class AggregatorGadget;
+class Table;
+
+class SimpleAggregator : public Aggregator
+{
+public:
+	// @param type - type of this aggregator
+	SimpleAggregator(const SimpleAggregatorType *type);
+
+	// from Aggregator
+	virtual void handle(Table *table, AggregatorGadget *gadget, Index *index,
+		const IndexType *parentIndexType, GroupHandle *gh, Tray *dest,
+		AggOp aggop, Rowop::Opcode opcode, RowHandle *rh);
+
+protected:
+	typedef SimpleAggregatorType::FieldDef FieldDef;
+
+	// The running state of one result field.
+	struct State
+	{
+		State() :
+			count_(0),
+			isum_(0),
+			fsum_(0.),
+			ext_(NULL),
+			dirty_(false)
+		{ }
+
+		int64_t count_; // number of non-NULL values
+		int64_t isum_; // sum of the integer values
+		double fsum_; // sum of the floating-point values
+		// For min and max without an Ordered index: the row with the
+		// current extreme value, or NULL if all values are NULL.
+		// The pointer is only compared, never dereferenced after the row
+		// gets deleted, since the deletion immediately makes it dirty.
+		RowHandle *ext_;
+		bool dirty_; // the row with the extreme value got deleted, re-scan on use
+	};
+	typedef vector<State> StateVec;
+
+	// Update the state with a row inserted into the group.
+	// @param rh - the inserted row
+	void addRow(const RowHandle *rh);
+	// Update the state with a row deleted from the group.
+	// @param rh - the deleted row
+	void removeRow(const RowHandle *rh);
+
+	// Check whether the value of argument field in one row is "better"
+	// (less for min, greater for max) than in another row.
+	// @param fd - definition of the field
+	// @param r1 - the first row
+	// @param r2 - the second row
+	bool better(const FieldDef &fd, const Row *r1, const Row *r2) const;
+
+	// Find the row with the extreme value (min or max) of the argument field.
+	// @param fd - definition of the field
+	// @param st - state of the field
+	// @param index - the index of this aggregator
+	// @param parentIndexType - type of the parent index
+	// @param gh - group where the index belongs
+	// @return - the row, or NULL if all the values are NULL
+	const RowHandle *findExtreme(const FieldDef &fd, State &st, Index *index,
+		const IndexType *parentIndexType, GroupHandle *gh);
+
+	const SimpleAggregatorType *type_; // not a reference, the table keeps the type anyway
+	StateVec state_; // in the same order as the field definitions
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_SimpleAggregator_h__
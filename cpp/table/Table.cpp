@@ -10,6 +10,7 @@
 #include <type/TableType.h>
 #include <type/AggregatorType.h>
 #include <type/RootIndexType.h>
+#include <type/TimeWindowIndexType.h>
 #include <sched/AggregatorGadget.h>
 #include <mem/Rhref.h>
 #include <common/Exception.h>
@@ -59,6 +60,8 @@ Table::Table(Unit *unit, const string &name,
 	for (size_t i = 0; i < n; i++) {
 		aggs_.push_back(tt->aggs_[i].agg_->makeGadget(this, tt->aggs_[i].index_));
 	}
+	if (n != 0)
+		aggTray_ = new Tray;
 }
 
 Table::~Table()
@@ -171,14 +174,15 @@ bool Table::insert(RowHandle *newrh)
 	BusyMark bm(busy_); // will auto-clean on exit
 
 	bool noAggs = aggs_.empty();
-	Autoref<Tray> aggTray; // delayed records from aggregation
+	Tray *aggTray = aggTray_; // delayed records from aggregation, NULL if no aggregators
 	if (!noAggs)
-		aggTray = new Tray;
+		aggTray->clear(); // in case if an exception had left something in it
 
+	// The sets are small enough to not allocate any memory in the common case.
 	Index::RhSet emptyRhSet; // always empty here
 	Index::RhSet replace;
 	Index::RhSet changed;
-	vector<RowHandle *> deref; // row handles that need to be dereferenced
+	size_t nderef = 0; // the count of handles from replace that need to be dereferenced
 
 	try {
 		if (!root_->replacementPolicy(newrh, replace)) {
@@ -208,7 +212,7 @@ bool Table::insert(RowHandle *newrh)
 			}
 			root_->remove(rh);
 			rh->flags_ &= ~RowHandle::F_INTABLE;
-			deref.push_back(rh);
+			++nderef;
 			send(rh->getRow(), Rowop::OP_DELETE); // may throw
 		}
 
@@ -242,6 +246,150 @@ bool Table::insert(RowHandle *newrh)
 			aggTray->clear();
 		}
 
+		// and then the removed rows get unreferenced by the table
+		derefRemoved(replace, nderef);
+	} catch (Exception e) {
+		// the removed rows must get unreferenced by the table
+		derefRemoved(replace, nderef);
+		// XXX this leaves the empty groups uncollapsed
+		throw;
+	}
+	checkStickyErrorAfter();
+	
+	return true;
+}
+
+void Table::derefRemoved(const Index::RhSet &rows, size_t n) const
+{
+	Index::RhSet::iterator rsit = rows.begin();
+	for (size_t i = 0; i < n; i++, ++rsit) {
+		RowHandle *rh = *rsit;
+		if (rh->decref() <= 0)
+			destroyRowHandle(rh);
+	}
+}
+
+size_t Table::insertRows(const vector<const Row *> &rows)
+{
+	vector<Rhref> rhv;
+	rhv.reserve(rows.size());
+	for (vector<const Row *>::const_iterator it = rows.begin(); it != rows.end(); ++it) {
+		if (*it != NULL)
+			rhv.push_back(Rhref(this, makeRowHandle(*it)));
+	}
+	return insertHandles(rhv); // may throw
+}
+
+size_t Table::insertBatch(const Tray *tray)
+{
+	vector<Rhref> rhv;
+	rhv.reserve(tray->size());
+	for (Tray::const_iterator it = tray->begin(); it != tray->end(); ++it) {
+		const Rowop *rop = *it;
+		if (rop->isInsert() && rop->getRow() != NULL)
+			rhv.push_back(Rhref(this, makeRowHandle(rop->getRow())));
+	}
+	return insertHandles(rhv); // may throw
+}
+
+size_t Table::insertHandles(const vector<Rhref> &rhv)
+{
+	checkStickyError();
+
+	if (busy_)
+		throw Exception::fTrace("Detected a recursive modification of the table '%s'.", getName().c_str());
+
+	BusyMark bm(busy_); // will auto-clean on exit
+
+	bool noAggs = aggs_.empty();
+	Tray *aggTray = aggTray_; // delayed records from aggregation, NULL if no aggregators
+	if (!noAggs)
+		aggTray->clear(); // in case if an exception had left something in it
+
+	// The sets accumulate the changes until the end of the batch,
+	// to notify the aggregators only once per group.
+	Index::RhSet inserted; // the new rows that are still in the table
+	Index::RhSet removed; // the old rows that got replaced
+	Index::RhSet touched; // the rows for which aggregateBefore() has been called
+	Index::RhSet collapsible; // the rows whose groups may need collapsing
+	vector<RowHandle *> deref; // row handles that need to be dereferenced
+	size_t count = 0;
+
+	try {
+		for (vector<Rhref>::const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+			RowHandle *newrh = it->get();
+			if (newrh == NULL || newrh->isInTable())
+				continue;
+
+			Index::RhSet replace;
+			if (!root_->replacementPolicy(newrh, replace)) {
+				// the groups created for it will be collapsed at the end
+				collapsible.insert(newrh);
+				continue;
+			}
+
+			// If a row from the same batch gets replaced, the aggregators must
+			// see it inserted first, so finish the part of the batch collected
+			// so far. The collapsing may destroy the groups just found for the
+			// new row, so the replacement policy has to be run again.
+			bool again = false;
+			for (Index::RhSet::iterator rsit = replace.begin(); rsit != replace.end(); ++rsit) {
+				if (inserted.find(*rsit) != inserted.end()) {
+					again = true;
+					break;
+				}
+			}
+			if (again) {
+				flushBatch(aggTray, inserted, removed, touched, collapsible); // may throw
+				replace.clear();
+				root_->replacementPolicy(newrh, replace); // the same result as before
+			}
+
+			if (!noAggs) {
+				root_->aggregateBefore(aggTray, replace, touched);
+				touched.insert(replace.begin(), replace.end());
+				Index::RhSet changed;
+				changed.insert(newrh); // OK to add, since the iterators in newrh got populated by replacementPolicy()
+				root_->aggregateBefore(aggTray, changed, touched);
+				touched.insert(newrh);
+				if (!aggTray->empty()) {
+					unit_->enqueueDelayedTray(aggTray); // may throw
+					aggTray->clear();
+				}
+			}
+
+			// delete the rows that are pushed out but don't collapse the groups yet
+			for (Index::RhSet::iterator rsit = replace.begin(); rsit != replace.end(); ++rsit) {
+				RowHandle *rh = *rsit;
+				if (preLabel_->hasChained()) {
+					Autoref<Rowop> rop = new Rowop(preLabel_, Rowop::OP_DELETE, rh->getRow());
+					unit_->call(rop); // may throw
+				}
+				root_->remove(rh);
+				rh->flags_ &= ~RowHandle::F_INTABLE;
+				deref.push_back(rh);
+				removed.insert(rh);
+				collapsible.insert(rh);
+				send(rh->getRow(), Rowop::OP_DELETE); // may throw
+			}
+
+			if (preLabel_->hasChained()) {
+				Autoref<Rowop> rop = new Rowop(preLabel_, Rowop::OP_INSERT, newrh->getRow());
+				unit_->call(rop); // may throw
+			}
+
+			// now keep the table-wide reference to that new handle
+			newrh->incref();
+			newrh->flags_ |= RowHandle::F_INTABLE;
+
+			root_->insert(newrh);
+			inserted.insert(newrh);
+			++count;
+			send(newrh->getRow(), Rowop::OP_INSERT); // may throw
+		}
+
+		flushBatch(aggTray, inserted, removed, touched, collapsible); // may throw
+
 		// and then the removed rows get unreferenced by the table
 		for (vector<RowHandle *>::iterator rsit = deref.begin(); rsit != deref.end(); ++rsit) {
 			RowHandle *rh = *rsit;
@@ -259,8 +407,39 @@ bool Table::insert(RowHandle *newrh)
 		throw;
 	}
 	checkStickyErrorAfter();
-	
-	return true;
+
+	return count;
+}
+
+void Table::flushBatch(Tray *aggTray, Index::RhSet &inserted, Index::RhSet &removed,
+	Index::RhSet &touched, Index::RhSet &collapsible)
+{
+	Index::RhSet emptyRhSet; // always empty here
+
+	if (aggTray != NULL) {
+		root_->aggregateAfter(aggTray, Aggregator::AO_AFTER_DELETE, removed, inserted);
+		root_->aggregateAfter(aggTray, Aggregator::AO_AFTER_INSERT, inserted, emptyRhSet);
+		// Aggregator "after" changes go after table changes. If there are multiple aggregators,
+		// between themselves they go sort of in parallel.
+		if (!aggTray->empty()) {
+			unit_->enqueueDelayedTray(aggTray); // may throw
+			aggTray->clear();
+		}
+	}
+
+	// finally, collapse the groups of the replaced records
+	root_->collapse(aggTray, collapsible);
+
+	if (aggTray != NULL && !aggTray->empty()) {
+		// The aggregators may have produced more output on collapse.
+		unit_->enqueueDelayedTray(aggTray); // may throw
+		aggTray->clear();
+	}
+
+	inserted.clear();
+	removed.clear();
+	touched.clear();
+	collapsible.clear();
 }
 
 void Table::remove(RowHandle *rh)
@@ -276,9 +455,9 @@ void Table::remove(RowHandle *rh)
 	BusyMark bm(busy_); // will auto-clean on exit
 
 	bool noAggs = aggs_.empty();
-	Autoref<Tray> aggTray; // delayed records from aggregation
+	Tray *aggTray = aggTray_; // delayed records from aggregation, NULL if no aggregators
 	if (!noAggs)
-		aggTray = new Tray;
+		aggTray->clear(); // in case if an exception had left something in it
 
 	Index::RhSet emptyRhSet; // always empty here
 	Index::RhSet replace;
@@ -346,6 +525,142 @@ bool Table::deleteRow(const Row *row)
 	return false;
 }
 
+size_t Table::removeHandles(const vector<Rhref> &rhv)
+{
+	checkStickyError();
+
+	if (busy_)
+		throw Exception::fTrace("Detected a recursive modification of the table '%s'.", getName().c_str());
+
+	BusyMark bm(busy_); // will auto-clean on exit
+
+	Index::RhSet emptyRhSet; // always empty here
+	Index::RhSet removed;
+	for (vector<Rhref>::const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+		RowHandle *rh = it->get();
+		if (rh != NULL && rh->isInTable())
+			removed.insert(rh);
+	}
+	if (removed.empty())
+		return 0;
+
+	bool noAggs = aggs_.empty();
+	Tray *aggTray = aggTray_; // delayed records from aggregation, NULL if no aggregators
+	if (!noAggs)
+		aggTray->clear(); // in case if an exception had left something in it
+
+	vector<RowHandle *> deref; // row handles that need to be dereferenced
+	deref.reserve(removed.size());
+
+	try {
+		if (!noAggs) {
+			root_->aggregateBefore(aggTray, removed, emptyRhSet);
+			// Aggregator "before" changes go before table changes. If there are multiple aggregators,
+			// between themselves they go sort of in parallel.
+			unit_->enqueueDelayedTray(aggTray); // may throw
+			aggTray->clear();
+		}
+
+		// the handles may repeat in the vector, they are removed on the first occurrence
+		for (vector<Rhref>::const_iterator it = rhv.begin(); it != rhv.end(); ++it) {
+			RowHandle *rh = it->get();
+			if (rh == NULL || !rh->isInTable())
+				continue;
+			if (preLabel_->hasChained()) {
+				Autoref<Rowop> rop = new Rowop(preLabel_, Rowop::OP_DELETE, rh->getRow());
+				unit_->call(rop); // may throw
+			}
+			root_->remove(rh);
+			rh->flags_ &= ~RowHandle::F_INTABLE;
+			deref.push_back(rh);
+			send(rh->getRow(), Rowop::OP_DELETE); // may throw
+		}
+
+		if (!noAggs) {
+			root_->aggregateAfter(aggTray, Aggregator::AO_AFTER_DELETE, removed, emptyRhSet);
+			// Aggregator "after" changes go after table changes. If there are multiple aggregators,
+			// between themselves they go sort of in parallel.
+			unit_->enqueueDelayedTray(aggTray); // may throw
+			aggTray->clear();
+		}
+
+		root_->collapse(aggTray, removed);
+		
+		if (!noAggs && !aggTray->empty()) {
+			// The aggregators may have produced more output on collapse.
+			unit_->enqueueDelayedTray(aggTray); // may throw
+			aggTray->clear();
+		}
+
+		// and then the removed rows get unreferenced by the table
+		for (vector<RowHandle *>::iterator rsit = deref.begin(); rsit != deref.end(); ++rsit) {
+			RowHandle *rh = *rsit;
+			if (rh->decref() <= 0)
+				destroyRowHandle(rh);
+		}
+	} catch (Exception e) {
+		// the removed rows must get unreferenced by the table
+		for (vector<RowHandle *>::iterator rsit = deref.begin(); rsit != deref.end(); ++rsit) {
+			RowHandle *rh = *rsit;
+			if (rh->decref() <= 0)
+				destroyRowHandle(rh);
+		}
+		// XXX this leaves the empty groups uncollapsed
+		throw;
+	}
+	checkStickyErrorAfter();
+
+	return deref.size();
+}
+
+size_t Table::expireBefore(IndexType *ixt, int64_t ts)
+{
+	checkStickyError();
+
+	if (ixt == NULL || ixt->getTabtype() != type_ || ixt->getIndexId() != IndexType::IT_TIMEWINDOW)
+		throw Exception::fTrace("Table '%s' can expire the rows only by a TimeWindow index type from its own table type.",
+			getName().c_str());
+	const TimeWindowIndexType *twt = static_cast<const TimeWindowIndexType *>(ixt);
+
+	// Collect the expired rows first: in each group they are at the front,
+	// and after the first unexpired row the rest of the group can be skipped.
+	vector<Rhref> rhv;
+	RowHandle *rh = ixt->beginIterationIdx(this);
+	while (rh != NULL) {
+		if (twt->getTimestamp(rh) < ts) {
+			rhv.push_back(Rhref(this, rh));
+			rh = ixt->nextIterationIdx(this, rh);
+		} else {
+			rh = ixt->nextGroupIdx(this, rh);
+		}
+	}
+
+	return removeHandles(rhv); // may throw
+}
+
+// Find the first TimeWindow index type, depth-first.
+static IndexType *findTimeWindow(const IndexTypeVec &ixv)
+{
+	for (IndexTypeVec::const_iterator it = ixv.begin(); it != ixv.end(); ++it) {
+		IndexType *ixt = it->index_;
+		if (ixt->getIndexId() == IndexType::IT_TIMEWINDOW)
+			return ixt;
+		ixt = findTimeWindow(ixt->getSubIndexes());
+		if (ixt != NULL)
+			return ixt;
+	}
+	return NULL;
+}
+
+size_t Table::expireBefore(int64_t ts)
+{
+	IndexType *ixt = findTimeWindow(type_->getSubIndexes());
+	if (ixt == NULL)
+		throw Exception::fTrace("Table '%s' has no TimeWindow index to expire the rows by.",
+			getName().c_str());
+	return expireBefore(ixt, ts); // may throw
+}
+
 RowHandle *Table::begin() const
 {
 	checkStickyError();
@@ -448,6 +763,88 @@ RowHandle *Table::findRowIdx(IndexType *ixt, const Row *row) const
 	return res;
 }
 
+RowHandle *Table::lowerBoundIdx(IndexType *ixt, const RowHandle *what) const
+{
+	checkStickyError();
+
+	if (ixt == NULL || ixt->getTabtype() != type_)
+		return NULL;
+	if (!ixt->isOrdered())
+		throw Exception::fTrace("Table '%s': the range search requires an ordered index, got %s.",
+			getName().c_str(), IndexType::indexIdString(ixt->getIndexId()));
+
+	RowHandle *res = ixt->lowerBoundIdx(this, what);
+	checkStickyErrorAfter();
+	return res;
+}
+
+RowHandle *Table::lowerBoundRowIdx(IndexType *ixt, const Row *row) const
+{
+	if (row == NULL)
+		return NULL;
+
+	RowHandle *rh = makeRowHandle(row);
+	rh->incref();
+
+	RowHandle *res;
+
+	try {
+		res = lowerBoundIdx(ixt, rh);
+	} catch (Exception e) {
+		if (rh->decref() <= 0)
+			destroyRowHandle(rh);
+		throw;
+	}
+
+	if (rh->decref() <= 0)
+		destroyRowHandle(rh);
+	return res;
+}
+
+RowHandle *Table::upperBoundIdx(IndexType *ixt, const RowHandle *what) const
+{
+	checkStickyError();
+
+	if (ixt == NULL || ixt->getTabtype() != type_)
+		return NULL;
+	if (!ixt->isOrdered())
+		throw Exception::fTrace("Table '%s': the range search requires an ordered index, got %s.",
+			getName().c_str(), IndexType::indexIdString(ixt->getIndexId()));
+
+	RowHandle *res = ixt->upperBoundIdx(this, what);
+	checkStickyErrorAfter();
+	return res;
+}
+
+RowHandle *Table::upperBoundRowIdx(IndexType *ixt, const Row *row) const
+{
+	if (row == NULL)
+		return NULL;
+
+	RowHandle *rh = makeRowHandle(row);
+	rh->incref();
+
+	RowHandle *res;
+
+	try {
+		res = upperBoundIdx(ixt, rh);
+	} catch (Exception e) {
+		if (rh->decref() <= 0)
+			destroyRowHandle(rh);
+		throw;
+	}
+
+	if (rh->decref() <= 0)
+		destroyRowHandle(rh);
+	return res;
+}
+
+void Table::equalRangeIdx(IndexType *ixt, const RowHandle *what, RowHandle *&first, RowHandle *&end) const
+{
+	first = lowerBoundIdx(ixt, what);
+	end = upperBoundIdx(ixt, what);
+}
+
 size_t Table::groupSizeIdx(IndexType *ixt, const RowHandle *what) const
 {
 	checkStickyError();
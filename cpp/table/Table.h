@@ -20,6 +20,7 @@ class RowType;
 class RowHandleType;
 class TableType;
 class Row;
+class Rhref;
 
 class Table : public Gadget
 {
@@ -116,6 +117,33 @@ public:
 	// @return - true on success, false on failure (if the index policies don't allow it)
 	bool insert(RowHandle *rh);
 
+	// Insert a batch of rows. The result is the same as inserting them
+	// one by one, except for the aggregators: they get notified once per
+	// group for the whole batch (or for each part of the batch, if a row
+	// in it replaces another row from the same batch), instead of once
+	// per row. This makes the loading of the big tables much faster.
+	// The rows sorted in the order of the ordered indexes get
+	// inserted faster too.
+	// May throw an Exception.
+	// @param rows - the rows to insert, the NULL pointers get skipped
+	// @return - the number of rows inserted (that would have returned true
+	//     from insertRow())
+	size_t insertRows(const vector<const Row *> &rows);
+	// Insert a batch of rows from the rowops in a tray, otherwise the
+	// same as insertRows(). The rowops with the opcodes other
+	// than INSERT get skipped, and so do their labels.
+	// May throw an Exception.
+	// @param tray - the rowops with the rows to insert
+	// @return - the number of rows inserted
+	size_t insertBatch(const Tray *tray);
+	// Insert a batch of pre-initialized row handles, otherwise the
+	// same as insertRows(). The handles that are already in the table
+	// get skipped.
+	// May throw an Exception.
+	// @param rhv - the row handles to insert
+	// @return - the number of rows inserted
+	size_t insertHandles(const vector<Rhref> &rhv);
+
 	// XXX also add a version working on RhSet, for better efficiency?
 	// Remove a row handle from the table. If the row is already not in table, do nothing.
 	// May throw an Exception.
@@ -129,6 +157,32 @@ public:
 	// @return - true if found and removed, false if not found
 	bool deleteRow(const Row *row);
 
+	// Remove a batch of row handles. The result is the same as removing
+	// them one by one, except for the aggregators: they get notified once
+	// per group for the whole batch instead of once per row. The DELETE
+	// rowops are sent in the order of the handles in the batch.
+	// The handles that are not in the table get skipped.
+	// May throw an Exception.
+	// @param rhv - the row handles to remove
+	// @return - the number of rows removed
+	size_t removeHandles(const vector<Rhref> &rhv);
+
+	// Expire all the rows with the timestamp older than the watermark
+	// in a TimeWindow index. The rows get removed as a batch, as in
+	// removeHandles(), in the order of the index. If the TimeWindow
+	// index is nested, the rows get expired in every group.
+	// Throws an Exception if the index type is not a TimeWindow
+	// index from this table's type.
+	// @param ixt - the TimeWindow index type from this table's type
+	// @param ts - the watermark, the rows with the timestamps less than
+	//        it get removed
+	// @return - the number of rows removed
+	size_t expireBefore(IndexType *ixt, int64_t ts);
+	// The same, using the first TimeWindow index found in the table
+	// type (looking through all the levels of the nested indexes).
+	// Throws an Exception if the table type has no TimeWindow indexes.
+	size_t expireBefore(int64_t ts);
+
 	// Get the handle of the first record in this table.
 	// A random index will be used for iteration. Usually this will be
 	// the first index, but the table may decide to pick a more efficient one
@@ -223,6 +277,58 @@ public:
 		return findRowIdx(firstLeaf_, what);
 	}
 
+	// Find the first row with the key not less than in the pattern,
+	// according to an ordered (sorted) index. This is the lower boundary
+	// of a range search. Together with upperBoundIdx() it allows to iterate
+	// over a range of keys:
+	//
+	//   RowHandle *end = t->upperBoundIdx(ixt, hi);
+	//   for (RowHandle *rh = t->lowerBoundIdx(ixt, lo); rh != end; rh = t->nextIdx(ixt, rh))
+	//
+	// The result is always a valid position in the iteration by
+	// nextIdx() with the same index type.
+	// If the index type is nested in a non-leaf index, the search is
+	// done within the same group of the parent index as where the pattern
+	// row belongs, and if the pattern is past the end of the group,
+	// the first row of the next non-empty group is returned (i.e. the next
+	// row in the iteration order). If the group doesn't exist at all, returns NULL.
+	// If the index is non-leaf, the search goes by its groups, and the 
+	// first row of the found group is returned.
+	//
+	// Throws an Exception if the index type is not ordered (such as Hashed
+	// or Fifo), or if the table has a sticky error.
+	//
+	// @param ixt - index type from this table's type
+	// @param what - the pattern row
+	// @return - the found row, or NULL if there are no rows past
+	//     the boundary; also NULL if ixt is not from this table
+	RowHandle *lowerBoundIdx(IndexType *ixt, const RowHandle *what) const;
+	// The same but creates RowHandle from a Row internally.
+	RowHandle *lowerBoundRowIdx(IndexType *ixt, const Row *what) const;
+
+	// Find the first row with the key greater than in the pattern,
+	// according to an ordered (sorted) index. This is the upper boundary
+	// of a range search. Everything else works the same as in lowerBoundIdx().
+	//
+	// @param ixt - index type from this table's type
+	// @param what - the pattern row
+	// @return - the found row, or NULL if there are no rows past
+	//     the boundary; also NULL if ixt is not from this table
+	RowHandle *upperBoundIdx(IndexType *ixt, const RowHandle *what) const;
+	// The same but creates RowHandle from a Row internally.
+	RowHandle *upperBoundRowIdx(IndexType *ixt, const Row *what) const;
+
+	// Find the range of rows with the key equal to the pattern (i.e.
+	// the combination of lowerBoundIdx() and upperBoundIdx()). The
+	// range includes first and excludes end. If there are no
+	// matching rows, first and end are equal.
+	//
+	// @param ixt - index type from this table's type
+	// @param what - the pattern row
+	// @param first - place to return the first row of the range
+	// @param end - place to return the row past the end of the range
+	void equalRangeIdx(IndexType *ixt, const RowHandle *what, RowHandle *&first, RowHandle *&end) const;
+
 	// Get the size of the group where the row belongs
 	// (similarly to what can be done in an aggregator).
 	// The group measured is a group under the specified index type
@@ -319,6 +425,25 @@ protected:
 	Table(Unit *unit, const string &name, 
 		const TableType *tt, const RowType *rowt, const RowHandleType *handt);
 
+protected:
+	// The part of the batch insert that finishes the rows collected so far:
+	// sends the "after" notifications to the aggregators and collapses
+	// the groups that became empty. The sets get cleared after that.
+	// May throw an Exception.
+	// @param aggTray - tray for the aggregator results, NULL if there are no aggregators
+	// @param inserted - the new rows that are in the table
+	// @param removed - the old rows that got replaced
+	// @param touched - the rows for which aggregateBefore() has been called
+	// @param collapsible - the rows whose groups may need collapsing
+	void flushBatch(Tray *aggTray, Index::RhSet &inserted, Index::RhSet &removed,
+		Index::RhSet &touched, Index::RhSet &collapsible);
+
+	// Unreference the first rows in the set, that have been removed
+	// from the table.
+	// @param rows - the set of the removed rows
+	// @param n - the number of rows to unreference from the start of the set
+	void derefRemoved(const Index::RhSet &rows, size_t n) const;
+
 protected:
 	friend class Rhref;
 
@@ -373,6 +498,7 @@ protected:
 	Autoref<DummyLabel> dumpLabel_; // the iteration data
 	mutable Autoref<FnReturn> fnReturn_; // the FnReturn object for table results
 	AggGadgetVec aggs_; // gadgets for all aggregators, matching the order in TableType
+	Autoref<Tray> aggTray_; // reused for the delayed records from aggregation, NULL if no aggregators
 	string name_; // base name of the table
 	Erref stickyErr_; // errors from the indexes, that make the table dead
 	bool busy_; // flag: an operation is in progress on the table
@@ -0,0 +1,155 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An index that keeps the rows in the order of a timestamp, for the time windows.
+
+#include <table/TimeWindowIndex.h>
+#include <type/TableType.h>
+
+namespace TRICEPS_NS {
+
+TimeWindowIndex::TimeWindowIndex(const TableType *tabtype, Table *table, const TimeWindowIndexType *mytype) :
+	Index(tabtype, table),
+	type_(mytype),
+	first_(NULL),
+	last_(NULL)
+{ }
+
+TimeWindowIndex::~TimeWindowIndex()
+{
+	// the Table will take care of the records
+}
+
+void TimeWindowIndex::clearData()
+{
+	first_ = last_ = NULL;
+}
+
+const IndexType *TimeWindowIndex::getType() const
+{
+	return type_;
+}
+
+RowHandle *TimeWindowIndex::begin() const
+{
+	return first_;
+}
+
+RowHandle *TimeWindowIndex::next(const RowHandle *cur) const
+{
+	if (cur == NULL || !cur->isInTable())
+		return NULL;
+
+	return getSection(cur)->next_;
+}
+
+RowHandle *TimeWindowIndex::last() const
+{
+	return last_;
+}
+
+const GroupHandle *TimeWindowIndex::nextGroup(const GroupHandle *cur) const
+{
+	return NULL;
+}
+
+const GroupHandle *TimeWindowIndex::beginGroup() const
+{
+	return NULL;
+}
+
+const GroupHandle *TimeWindowIndex::toGroup(const RowHandle *cur) const
+{
+	return NULL;
+}
+
+RowHandle *TimeWindowIndex::find(const RowHandle *what) const
+{
+	// The rows with the same timestamp are next to each other,
+	// and the recent ones are the more likely to be looked for.
+	int64_t ts = getSection(what)->ts_;
+	const Row *rwhat = what->getRow();
+	const RowType *rt = type_->getTabtype()->rowType();
+
+	RowHandle *curh = last_;
+	while(curh != NULL) {
+		RhSection *rs = getSection(curh);
+		if (rs->ts_ < ts)
+			break;
+		if (rs->ts_ == ts && rt->equalRows(rwhat, curh->getRow()))
+			return curh;
+		curh = rs->prev_;
+	}
+	return NULL; // not found
+}
+
+Index *TimeWindowIndex::findNested(const RowHandle *what, int nestPos) const
+{
+	return NULL;
+}
+
+bool TimeWindowIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
+{
+	return true; // the rows leave only on expiration
+}
+
+void TimeWindowIndex::insert(RowHandle *rh)
+{
+	RhSection *rs = getSection(rh);
+
+	// find the newest row that is not newer than this one
+	RowHandle *prevh = last_;
+	while (prevh != NULL && getSection(prevh)->ts_ > rs->ts_)
+		prevh = getSection(prevh)->prev_;
+
+	rs->prev_ = prevh;
+	if (prevh == NULL) {
+		rs->next_ = first_;
+		first_ = rh;
+	} else {
+		RhSection *prevrs = getSection(prevh);
+		rs->next_ = prevrs->next_;
+		prevrs->next_ = rh;
+	}
+	if (rs->next_ == NULL)
+		last_ = rh;
+	else
+		getSection(rs->next_)->prev_ = rh;
+}
+
+void TimeWindowIndex::remove(RowHandle *rh)
+{
+	RhSection *rs = getSection(rh);
+
+	if (rs->prev_ == NULL)
+		first_ = rs->next_;
+	else
+		getSection(rs->prev_)->next_ = rs->next_;
+
+	if (rs->next_ == NULL)
+		last_ = rs->prev_;
+	else
+		getSection(rs->next_)->prev_ = rs->prev_;
+
+	rs->prev_ = rs->next_ = NULL;
+}
+
+void TimeWindowIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already)
+{ 
+	// nothing to do
+}
+
+void TimeWindowIndex::aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future)
+{ 
+	// nothing to do
+}
+
+bool TimeWindowIndex::collapse(Tray *dest, const RhSet &replaced)
+{
+	return true;
+}
+
+}; // TRICEPS_NS
@@ -0,0 +1,61 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An index that keeps the rows in the order of a timestamp, for the time windows.
+
+#ifndef __Triceps_TimeWindowIndex_h__
+#define __Triceps_TimeWindowIndex_h__
+
+#include <table/Index.h>
+#include <type/TimeWindowIndexType.h>
+
+namespace TRICEPS_NS {
+
+class TimeWindowIndex: public Index
+{
+	friend class TimeWindowIndexType;
+public:
+	// @param tabtype - type of table where this index belongs
+	// @param table - the actual table where this index belongs
+	// @param mytype - type that created this index
+	TimeWindowIndex(const TableType *tabtype, Table *table, const TimeWindowIndexType *mytype);
+	~TimeWindowIndex();
+
+	// from Index
+	virtual void clearData();
+	virtual const IndexType *getType() const;
+	virtual RowHandle *begin() const;
+	virtual RowHandle *next(const RowHandle *cur) const;
+	virtual RowHandle *last() const;
+	virtual const GroupHandle *nextGroup(const GroupHandle *cur) const;
+	virtual const GroupHandle *beginGroup() const;
+	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
+	virtual RowHandle *find(const RowHandle *what) const;
+	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
+	virtual void insert(RowHandle *rh);
+	virtual void remove(RowHandle *rh);
+	virtual void aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already);
+	virtual void aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future);
+	virtual bool collapse(Tray *dest, const RhSet &replaced);
+	virtual Index *findNested(const RowHandle *what, int nestPos) const;
+
+protected:
+	typedef TimeWindowIndexType::RhSection RhSection;
+
+	// Get the section in the row handle
+	RhSection *getSection(const RowHandle *rh) const
+	{
+		return type_->getSection(rh);
+	}
+
+	Autoref<const TimeWindowIndexType> type_; // type of this index
+	RowHandle *first_; // the oldest row
+	RowHandle *last_; // the newest row
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_TimeWindowIndex_h__
@@ -0,0 +1,48 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An ordered index that keeps only a limited number of the top rows.
+
+#include <table/TopIndex.h>
+
+namespace TRICEPS_NS {
+
+TopIndex::TopIndex(const TableType *tabtype, Table *table, const TopIndexType *mytype, Less *lessop) :
+	TreeIndex(tabtype, table, mytype, lessop),
+	limit_(mytype->getLimit())
+{ }
+
+bool TopIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
+{
+	// the row with the same key gets replaced as usual
+	TreeIndex::replacementPolicy(rh, replaced);
+
+	// Check if there are any rows already marked for replacement and present in this index,
+	// then they will make the space. The keys in this index are unique, so finding
+	// the same handle by its key proves that it belongs here.
+	size_t subtract = 0;
+	for (RhSet::iterator it = replaced.begin(); it != replaced.end(); ++it) {
+		Set::iterator si = data_.find(*it);
+		if (si != data_.end() && *si == *it)
+			++subtract;
+	}
+
+	if (data_.size() - subtract < limit_)
+		return true;
+
+	// The group is full, so the last row must go. Since the row with the same
+	// key would have been counted in subtract, the last row is not it.
+	RowHandle *lastrh = *data_.rbegin();
+	if (!(*less_)(rh, lastrh)) {
+		// the new row would be the last one itself, so it doesn't make the cut
+		appendRh_ = NULL;
+		return false;
+	}
+	replaced.insert(lastrh);
+	return true;
+}
+
+}; // TRICEPS_NS
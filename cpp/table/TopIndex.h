@@ -0,0 +1,35 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An ordered index that keeps only a limited number of the top rows.
+
+#ifndef __Triceps_TopIndex_h__
+#define __Triceps_TopIndex_h__
+
+#include <table/TreeIndex.h>
+#include <type/TopIndexType.h>
+
+namespace TRICEPS_NS {
+
+class TopIndex: public TreeIndex
+{
+public:
+	// @param tabtype - type of table where this index belongs
+	// @param table - the actual table where this index belongs
+	// @param mytype - type that created this index
+	// @param lessop - less functor class for the key, this index will keep a reference
+	TopIndex(const TableType *tabtype, Table *table, const TopIndexType *mytype, Less *lessop);
+
+	// from Index
+	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
+
+protected:
+	size_t limit_; // copied from the type
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_TopIndex_h__
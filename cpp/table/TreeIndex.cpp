@@ -18,7 +18,8 @@ TreeIndex::TreeIndex(const TableType *tabtype, Table *table, const TreeIndexType
 	Index(tabtype, table),
 	data_(*lessop),
 	type_(mytype),
-	less_(lessop)
+	less_(lessop),
+	appendRh_(NULL)
 { }
 
 TreeIndex::~TreeIndex()
@@ -29,6 +30,7 @@ TreeIndex::~TreeIndex()
 void TreeIndex::clearData()
 {
 	data_.clear();
+	appendRh_ = NULL;
 }
 
 const IndexType *TreeIndex::getType() const
@@ -100,6 +102,24 @@ RowHandle *TreeIndex::find(const RowHandle *what) const
 		return (*it);
 }
 
+RowHandle *TreeIndex::lowerBound(const RowHandle *what) const
+{
+	Set::iterator it = data_.lower_bound(const_cast<RowHandle *>(what));
+	if (it == data_.end())
+		return NULL;
+	else
+		return (*it);
+}
+
+RowHandle *TreeIndex::upperBound(const RowHandle *what) const
+{
+	Set::iterator it = data_.upper_bound(const_cast<RowHandle *>(what));
+	if (it == data_.end())
+		return NULL;
+	else
+		return (*it);
+}
+
 Index *TreeIndex::findNested(const RowHandle *what, int nestPos) const
 {
 	return NULL;
@@ -107,6 +127,13 @@ Index *TreeIndex::findNested(const RowHandle *what, int nestPos) const
 
 bool TreeIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
 {
+	// a row past the last one can't replace anything
+	if (!data_.empty() && (*less_)(*data_.rbegin(), rh)) {
+		appendRh_ = rh;
+		return true;
+	}
+	appendRh_ = NULL;
+
 	Set::iterator old = data_.find(rh);
 	// XXX for now just silently replace the old value with the same key
 	if (old != data_.end())
@@ -116,6 +143,12 @@ bool TreeIndex::replacementPolicy(RowHandle *rh, RhSet &replaced)
 
 void TreeIndex::insert(RowHandle *rh)
 {
+	if (appendRh_ == rh) {
+		// the end hint makes the insertion O(1)
+		type_->setIter(rh, data_.insert(data_.end(), rh));
+		appendRh_ = NULL;
+		return;
+	}
 	pair<Set::iterator, bool> res = data_.insert(const_cast<RowHandle *>(rh));
 	assert(res.second); // must always succeed
 	type_->setIter(rh, res.first);
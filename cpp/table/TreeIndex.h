@@ -43,6 +43,8 @@ public:
 	virtual const GroupHandle *beginGroup() const;
 	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
 	virtual RowHandle *find(const RowHandle *what) const;
+	virtual RowHandle *lowerBound(const RowHandle *what) const;
+	virtual RowHandle *upperBound(const RowHandle *what) const;
 	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
 	virtual void insert(RowHandle *rh);
 	virtual void remove(RowHandle *rh);
@@ -55,6 +57,10 @@ protected:
 	Set data_; // the data store
 	Autoref<const TreeIndexType> type_; // type of this index
 	Autoref<Less> less_; // the comparator object, index's own copy
+	// Set by replacementPolicy() if the row goes past the end of the index,
+	// then insert() appends it without searching. This makes the insertion
+	// of the rows coming in the sorted order faster.
+	RowHandle *appendRh_;
 };
 
 }; // TRICEPS_NS
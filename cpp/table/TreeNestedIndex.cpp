@@ -150,6 +150,25 @@ RowHandle *TreeNestedIndex::find(const RowHandle *what) const
 	return NULL; // no records directly here
 }
 
+RowHandle *TreeNestedIndex::lowerBound(const RowHandle *what) const
+{
+	return firstFrom(data_.lower_bound(const_cast<RowHandle *>(what)));
+}
+
+RowHandle *TreeNestedIndex::upperBound(const RowHandle *what) const
+{
+	return firstFrom(data_.upper_bound(const_cast<RowHandle *>(what)));
+}
+
+RowHandle *TreeNestedIndex::firstFrom(Set::iterator it) const
+{
+	RowHandle *rh = NULL;
+	// skip over the empty groups, same as in begin()
+	for (; rh == NULL && it != data_.end(); ++it)
+		rh = type_->beginIteration(static_cast<GroupHandle *>(*it));
+	return rh;
+}
+
 Index *TreeNestedIndex::findNested(const RowHandle *what, int nestPos) const
 {
 	// fprintf(stderr, "DEBUG TreeNestedIndex::findNested(this=%p, what=%p, nestPos=%d)\n", this, what, nestPos);
@@ -216,8 +235,29 @@ void TreeNestedIndex::splitRhSet(const RhSet &rows, SplitMap &dest)
 	}
 }
 
+GroupHandle *TreeNestedIndex::singleGroup(const RhSet &rows) const
+{
+	GroupHandle *gh = NULL;
+	for(RhSet::iterator rsi = rows.begin(); rsi != rows.end(); ++rsi) {
+		Set::iterator si = type_->getIter(*rsi); // row is known to still be in the set
+		GroupHandle *cur = static_cast<GroupHandle *>(*si);
+		if (gh == NULL)
+			gh = cur;
+		else if (gh != cur)
+			return NULL;
+	}
+	return gh;
+}
+
 void TreeNestedIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet &already)
 {
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(rows);
+	if (single != NULL && (already.empty() || singleGroup(already) == single)) {
+		type_->groupAggregateBefore(dest, table_, single, rows, already);
+		return;
+	}
+
 	SplitMap splitRows, splitAlready;
 	splitRhSet(rows, splitRows);
 	if (!already.empty())
@@ -236,6 +276,13 @@ void TreeNestedIndex::aggregateBefore(Tray *dest, const RhSet &rows, const RhSet
 
 void TreeNestedIndex::aggregateAfter(Tray *dest, Aggregator::AggOp aggop, const RhSet &rows, const RhSet &future)
 {
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(rows);
+	if (single != NULL && (future.empty() || singleGroup(future) == single)) {
+		type_->groupAggregateAfter(dest, aggop, table_, single, rows, future);
+		return;
+	}
+
 	SplitMap splitRows, splitFuture;
 	splitRhSet(rows, splitRows);
 	if (!future.empty())
@@ -256,6 +303,14 @@ bool TreeNestedIndex::collapse(Tray *dest, const RhSet &replaced)
 {
 	// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p, rhset size=%d)\n", this, (int)replaced.size());
 	
+	if (replaced.empty())
+		return true;
+
+	// the common case of all the rows in one group needs no splitting
+	GroupHandle *single = singleGroup(replaced);
+	if (single != NULL)
+		return collapseGroup(dest, single, replaced);
+
 	// split the set into subsets by iterator
 	SplitMap split;
 	splitRhSet(replaced, split);
@@ -264,27 +319,32 @@ bool TreeNestedIndex::collapse(Tray *dest, const RhSet &replaced)
 
 	// handle each subset's group
 	for(SplitMap::iterator smi = split.begin(); smi != split.end(); ++smi) {
-		GroupHandle *gh = smi->first;
-		// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p\n", this, gh);
-		if (type_->groupCollapse(dest, gh, smi->second)) {
-			// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p destroying\n", this, gh);
-			// call the aggregators to process collapse
-			if (!type_->groupAggs_.empty()) {
-				type_->aggregateCollapse(dest, table_, gh);
-			}
-			// destroy the group
-			data_.erase(type_->getIter(gh)); // after this the iterator in gh is not valid any more
-			if (gh->decref() <= 0)
-				type_->destroyGroupHandle(gh);
-		} else {
-			// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p not collapsing\n", this, gh);
-			// a group objects to being collapsed
-			res = false;
-		}
+		res = (collapseGroup(dest, smi->first, smi->second) && res);
 	}
 
 	return res;
 }
 
+bool TreeNestedIndex::collapseGroup(Tray *dest, GroupHandle *gh, const RhSet &replaced)
+{
+	// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p\n", this, gh);
+	if (type_->groupCollapse(dest, gh, replaced)) {
+		// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p destroying\n", this, gh);
+		// call the aggregators to process collapse
+		if (!type_->groupAggs_.empty()) {
+			type_->aggregateCollapse(dest, table_, gh);
+		}
+		// destroy the group
+		data_.erase(type_->getIter(gh)); // after this the iterator in gh is not valid any more
+		if (gh->decref() <= 0)
+			type_->destroyGroupHandle(gh);
+		return true;
+	} else {
+		// fprintf(stderr, "DEBUG TreeNestedIndex::collapse(this=%p) gh=%p not collapsing\n", this, gh);
+		// a group objects to being collapsed
+		return false;
+	}
+}
+
 
 }; // TRICEPS_NS
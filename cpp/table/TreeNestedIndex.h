@@ -43,6 +43,8 @@ public:
 	virtual const GroupHandle *beginGroup() const;
 	virtual const GroupHandle *toGroup(const RowHandle *cur) const;
 	virtual RowHandle *find(const RowHandle *what) const;
+	virtual RowHandle *lowerBound(const RowHandle *what) const;
+	virtual RowHandle *upperBound(const RowHandle *what) const;
 	virtual bool replacementPolicy(RowHandle *rh, RhSet &replaced);
 	virtual void insert(RowHandle *rh);
 	virtual void remove(RowHandle *rh);
@@ -58,6 +60,25 @@ protected:
 	//        (if not empty then added to)
 	void splitRhSet(const RhSet &rows, SplitMap &dest);
 
+	// Find the group that all the rows in the set belong to.
+	// @param rows - set to check
+	// @return - the common group, or NULL if the rows belong to
+	//        multiple groups or the set is empty
+	GroupHandle *singleGroup(const RhSet &rows) const;
+
+	// Collapse one group if it agrees to be collapsed.
+	// @param dest - destination to send the delayed aggregation changes
+	// @param gh - the group to collapse
+	// @param replaced - the rows from this group that have been replaced
+	// @return - true if the group has been collapsed
+	bool collapseGroup(Tray *dest, GroupHandle *gh, const RhSet &replaced);
+
+	// Find the first row of the first non-empty group, starting from
+	// the iterator.
+	// @param it - iterator of the group to start from
+	// @return - the first row, or NULL if all the groups are empty
+	RowHandle *firstFrom(Set::iterator it) const;
+
 	Set data_; // the data store
 	Autoref<const TreeIndexType> type_; // type of this index
 	Autoref<Less> less_; // the comparator object, index's own copy
@@ -0,0 +1,19 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase collapse;
+	driver.addcase(collapse, "collapse");
+
+	extern Utest::Testcase flushOn;
+	driver.addcase(flushOn, "flushOn");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
@@ -0,0 +1,25 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase innerJoin;
+	driver.addcase(innerJoin, "innerJoin");
+
+	extern Utest::Testcase outerJoin;
+	driver.addcase(outerJoin, "outerJoin");
+
+	extern Utest::Testcase fields;
+	driver.addcase(fields, "fields");
+
+	extern Utest::Testcase selfJoin;
+	driver.addcase(selfJoin, "selfJoin");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
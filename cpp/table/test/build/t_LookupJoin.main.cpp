@@ -0,0 +1,22 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase leftJoin;
+	driver.addcase(leftJoin, "leftJoin");
+
+	extern Utest::Testcase innerJoin;
+	driver.addcase(innerJoin, "innerJoin");
+
+	extern Utest::Testcase mirrorKey;
+	driver.addcase(mirrorKey, "mirrorKey");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
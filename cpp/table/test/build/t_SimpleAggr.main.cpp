@@ -0,0 +1,16 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase functions;
+	driver.addcase(functions, "functions");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
@@ -0,0 +1,19 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase timeWindow;
+	driver.addcase(timeWindow, "timeWindow");
+
+	extern Utest::Testcase timeWindowNested;
+	driver.addcase(timeWindowNested, "timeWindowNested");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
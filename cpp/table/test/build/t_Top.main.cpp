@@ -0,0 +1,19 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase topIndex;
+	driver.addcase(topIndex, "topIndex");
+
+	extern Utest::Testcase topNested;
+	driver.addcase(topNested, "topNested");
+
+	extern Utest::Testcase errors;
+	driver.addcase(errors, "errors");
+
+	return driver.run();
+}
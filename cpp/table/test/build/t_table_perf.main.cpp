@@ -0,0 +1,25 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase hashed;
+	driver.addcase(hashed, "hashed");
+
+	extern Utest::Testcase fifo;
+	driver.addcase(fifo, "fifo");
+
+	extern Utest::Testcase ordered;
+	driver.addcase(ordered, "ordered");
+
+	extern Utest::Testcase nested;
+	driver.addcase(nested, "nested");
+
+	extern Utest::Testcase aggregated;
+	driver.addcase(aggregated, "aggregated");
+
+	return driver.run();
+}
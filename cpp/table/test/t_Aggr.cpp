@@ -695,24 +695,24 @@ UTESTCASE aggLast(Utest *utest)
 		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
 		"t.onFifo ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
 		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
-		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
+		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=B b=1234\n"
 		"t.onFifo ao=AO_AFTER_INSERT op=OP_INSERT e=B b=1234\n"
-		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
-		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
+		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=B b=1234\n"
+		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=B b=1234\n"
 		"t.onFifo ao=AO_BEFORE_MOD op=OP_DELETE e=B b=1234\n"
-		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
-		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
+		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=B b=1234\n"
+		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=B b=1234\n"
 		"t.onFifo ao=AO_AFTER_INSERT op=OP_INSERT e=C b=1234\n"
-		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
-		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
+		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=B b=1234\n"
+		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=B b=1234\n"
 		"t.onFifo ao=AO_BEFORE_MOD op=OP_DELETE e=C b=1234\n"
-		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
-		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
+		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=B b=1234\n"
+		"t.onHashed ao=AO_AFTER_INSERT op=OP_INSERT e=D b=1234\n"
 		"t.onFifo ao=AO_AFTER_INSERT op=OP_INSERT e=D b=1234\n"
-		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=A b=1234\n"
-		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
+		"t.onHashedNested ao=AO_AFTER_INSERT op=OP_INSERT e=D b=1234\n"
+		"t.onHashed ao=AO_BEFORE_MOD op=OP_DELETE e=D b=1234\n"
 		"t.onFifo ao=AO_BEFORE_MOD op=OP_DELETE e=D b=1234\n"
-		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=A b=1234\n"
+		"t.onHashedNested ao=AO_BEFORE_MOD op=OP_DELETE e=D b=1234\n"
 		"t.onHashed ao=AO_AFTER_DELETE op=OP_INSERT e=D b=1234\n"
 		"t.onFifo ao=AO_AFTER_DELETE op=OP_INSERT e=D b=1234\n"
 		"t.onHashedNested ao=AO_AFTER_DELETE op=OP_INSERT e=D b=1234\n"
@@ -860,6 +860,107 @@ UTESTCASE aggBasicSum(Utest *utest)
 	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
 }
 
+// the batch insert notifies the aggregators once per group
+UTESTCASE aggBatch(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printEC);
+	unit->setTracer(trace);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("primary", HashedIndexType::make(
+				(new NameSet())->add("b")
+			)
+		)->addSubIndex("Hashed", HashedIndexType::make(
+				(new NameSet())->add("e")
+			)->addSubIndex("Fifo", FifoIndexType::make()
+				->setAggregator(new BasicAggregatorType("aggr", rt1, sumC))
+			)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	FdataVec dv;
+	mkfdata(dv);
+
+	int64_t ival = 1; // a nicer value for "c"
+	dv[2].setPtr(true, &ival, sizeof(ival));
+	int32_t bval = 0; // the primary key
+	dv[1].setPtr(true, &bval, sizeof(bval));
+	char sval[2] = "A"; // one-character string for "e"
+	dv[4].setPtr(true, &sval, sizeof(sval));
+
+	Rowref r11(rt1, rt1->makeRow(dv));
+	UT_ASSERT(t->insertRow(r11));
+
+	// the rows in the batch go into the same group
+	vector<Rowref> rows;
+	vector<const Row *> batch;
+	for (bval = 1; bval <= 3; bval++) {
+		rows.push_back(Rowref(rt1, rt1->makeRow(dv)));
+		batch.push_back(rows.back());
+	}
+	batch.push_back(NULL); // gets skipped
+	UT_IS(t->insertRows(batch), 3);
+	UT_IS(t->size(), 4);
+
+	string expect = 
+		"unit 'u' before label 't.out' op OP_INSERT e=A c=1\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=A c=1\n"
+		"unit 'u' before label 't.aggr' op OP_DELETE e=A c=1\n"
+		"unit 'u' before label 't.out' op OP_INSERT e=A c=1\n"
+		"unit 'u' before label 't.out' op OP_INSERT e=A c=1\n"
+		"unit 'u' before label 't.out' op OP_INSERT e=A c=1\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=A c=4\n"
+		;
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	trace->clearBuffer();
+
+	// A row that replaces a row from the same batch splits the batch,
+	// the replaced rows from before the batch get handled in one go.
+	Autoref<Tray> tray = new Tray;
+	bval = 5;
+	sval[0] = 'B';
+	tray->push_back(new Rowop(t->getInputLabel(), Rowop::OP_INSERT, rt1->makeRow(dv)));
+	bval = 1;
+	tray->push_back(new Rowop(t->getInputLabel(), Rowop::OP_INSERT, rt1->makeRow(dv)));
+	tray->push_back(new Rowop(t->getInputLabel(), Rowop::OP_DELETE, rt1->makeRow(dv))); // skipped
+	bval = 5;
+	sval[0] = 'C';
+	tray->push_back(new Rowop(t->getInputLabel(), Rowop::OP_INSERT, rt1->makeRow(dv)));
+	UT_IS(t->insertBatch(tray), 3);
+	UT_IS(t->size(), 5);
+
+	expect = 
+		"unit 'u' before label 't.out' op OP_INSERT e=B c=1\n"
+		"unit 'u' before label 't.aggr' op OP_DELETE e=A c=4\n"
+		"unit 'u' before label 't.out' op OP_DELETE e=A c=1\n"
+		"unit 'u' before label 't.out' op OP_INSERT e=B c=1\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=A c=3\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=B c=2\n"
+		"unit 'u' before label 't.aggr' op OP_DELETE e=B c=2\n"
+		"unit 'u' before label 't.out' op OP_DELETE e=B c=1\n"
+		"unit 'u' before label 't.out' op OP_INSERT e=C c=1\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=B c=1\n"
+		"unit 'u' before label 't.aggr' op OP_INSERT e=C c=1\n"
+		;
+	tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+}
+
 // aggregator class that computes the sum of field
 // follows the outline of the Perl aggregators shown in xAgg.t
 class MySumAggregator: public Aggregator
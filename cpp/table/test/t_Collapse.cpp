@@ -0,0 +1,268 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the Collapse.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <common/Initialize.h>
+#include <table/Collapse.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT64:
+			res.append(strprintf("%lld", (long long)rt->getInt64(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+// same as in the Perl example: local_ip, remote_ip, bytes
+Onceref<RowType> mkType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("local_ip", Type::r_string));
+	fld.push_back(RowType::Field("remote_ip", Type::r_string));
+	fld.push_back(RowType::Field("bytes", Type::r_int64));
+	return new CompactRowType(fld);
+}
+
+Row *mkrow(const RowType *rt, const char *local, const char *remote, int64_t bytes)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, local, strlen(local)+1));
+	dv.push_back(Fdata(true, remote, strlen(remote)+1));
+	dv.push_back(Fdata(true, &bytes, sizeof(bytes)));
+	return rt->makeRow(dv);
+}
+
+Onceref<NameSet> mkKey()
+{
+	return NameSet::make()->add("local_ip")->add("remote_ip");
+}
+
+UTESTCASE collapse(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt = mkType();
+
+	Autoref<Collapse> collapse = initializeOrThrow(Collapse::make(unit, "collapse", "idata", rt, mkKey()));
+	UT_IS(collapse->getName(), "collapse");
+	UT_IS(collapse->getDatasetName(), "idata");
+	UT_IS(collapse->getInputLabel()->getName(), "collapse.idata.in");
+	UT_IS(collapse->getOutputLabel()->getName(), "collapse.idata.out");
+	UT_ASSERT(collapse->getRowType() == rt);
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Label *in = collapse->getInputLabel();
+
+	// the first round: only the inserts
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 10)));
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "c", 20)));
+	// an insert cancelled by a delete
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "d", 30)));
+	unit->call(new Rowop(in, Rowop::OP_DELETE, mkrow(rt, "a", "d", 30)));
+	// an insert replacing an insert
+	unit->call(new Rowop(in, Rowop::OP_DELETE, mkrow(rt, "a", "b", 10)));
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 11)));
+	collapse->flush();
+
+	string expect =
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=d bytes=30\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=d bytes=30\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_DELETE local_ip=a remote_ip=d bytes=30\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=d bytes=30\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_DELETE local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_INSERT local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_INSERT local_ip=a remote_ip=c bytes=20\n"
+		;
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+	trace->clearBuffer();
+
+	// the second round: the updates of the previously sent rows
+	unit->call(new Rowop(in, Rowop::OP_DELETE, mkrow(rt, "a", "b", 11)));
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 12)));
+	unit->call(new Rowop(in, Rowop::OP_DELETE, mkrow(rt, "a", "b", 12)));
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 13)));
+	unit->call(new Rowop(in, Rowop::OP_DELETE, mkrow(rt, "a", "c", 20)));
+	collapse->flush();
+	// nothing to send
+	collapse->flush();
+
+	expect =
+		"unit 'u' before label 'collapse.idata.in' op OP_DELETE local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.tbDelete.out' op OP_INSERT local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=12\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=12\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_DELETE local_ip=a remote_ip=b bytes=12\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=12\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=13\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=13\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_DELETE local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.tbDelete.out' op OP_INSERT local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.tbDelete.out' op OP_DELETE local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_DELETE local_ip=a remote_ip=b bytes=11\n"
+		"unit 'u' before label 'collapse.idata.tbDelete.out' op OP_DELETE local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_DELETE local_ip=a remote_ip=c bytes=20\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=13\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_INSERT local_ip=a remote_ip=b bytes=13\n"
+		;
+	tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	// the FnReturn
+	FnReturn *fret = collapse->fnReturn();
+	UT_IS(fret->getName(), "collapse.fret");
+	UT_IS(fret->size(), 1);
+	UT_ASSERT(fret->getLabel("idata")->getType()->match(rt));
+	UT_ASSERT(collapse->fnReturn() == fret);
+}
+
+UTESTCASE flushOn(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt = mkType();
+
+	RowType::FieldVec fld;
+	Autoref<RowType> rtEmpty = new CompactRowType(fld);
+	Autoref<Label> lbEnd = new DummyLabel(unit, rtEmpty, "_END_");
+	FdataVec dvEmpty;
+
+	Autoref<Collapse> collapse = initializeOrThrow(Collapse::make(unit, "collapse", "idata", rt, mkKey()));
+	Label *flab = collapse->flushOn(lbEnd);
+	UT_IS(flab->getName(), "collapse.idata.flush");
+	UT_ASSERT(lbEnd->hasChained());
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Label *in = collapse->getInputLabel();
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 10)));
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "b", 20)));
+	unit->call(new Rowop(lbEnd, Rowop::OP_INSERT, rtEmpty->makeRow(dvEmpty)));
+
+	string expect =
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=b bytes=20\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=10\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=b bytes=20\n"
+		"unit 'u' before label '_END_' op OP_INSERT\n"
+		"unit 'u' before label 'collapse.idata.flush' (chain '_END_') op OP_INSERT\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=b bytes=20\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_INSERT local_ip=a remote_ip=b bytes=20\n"
+		;
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	// The flush label keeps the collapse alive even after the other
+	// references are dropped, until the labels are cleared.
+	Autoref<Label> out = collapse->getOutputLabel();
+	collapse = NULL;
+	trace->clearBuffer();
+	unit->call(new Rowop(in, Rowop::OP_INSERT, mkrow(rt, "a", "c", 30)));
+	unit->call(new Rowop(lbEnd, Rowop::OP_INSERT, rtEmpty->makeRow(dvEmpty)));
+	expect =
+		"unit 'u' before label 'collapse.idata.in' op OP_INSERT local_ip=a remote_ip=c bytes=30\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_INSERT local_ip=a remote_ip=c bytes=30\n"
+		"unit 'u' before label '_END_' op OP_INSERT\n"
+		"unit 'u' before label 'collapse.idata.flush' (chain '_END_') op OP_INSERT\n"
+		"unit 'u' before label 'collapse.idata.tbInsert.out' op OP_DELETE local_ip=a remote_ip=c bytes=30\n"
+		"unit 'u' before label 'collapse.idata.out' op OP_INSERT local_ip=a remote_ip=c bytes=30\n"
+		;
+	tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	unit->clearLabels();
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Unit> unit2 = new Unit("u2");
+	Autoref<RowType> rt = mkType();
+
+	{
+		Autoref<Collapse> collapse = initialize(Collapse::make(unit, "collapse", "idata", rt, NameSet::make()));
+		UT_IS(collapse->getErrors()->print(),
+			"the key must not be empty\n"
+		);
+	}
+	{
+		Autoref<Collapse> collapse = initialize(Collapse::make(unit, "collapse", "idata", rt,
+			NameSet::make()->add("zz")));
+		UT_IS(collapse->getErrors()->print(),
+			"the collapse table type is invalid:\n"
+			"  index error:\n"
+			"    nested index 1 'primary':\n"
+			"      can not find the key field 'zz'\n"
+		);
+
+		Exception::abort_ = false; // make them catchable
+		Exception::enableBacktrace_ = false; // make the error messages predictable
+
+		string msg;
+		try {
+			collapse->flush();
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Collapse 'collapse' was not successfully initialized\n");
+
+		msg = "";
+		try {
+			collapse->fnReturn();
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Collapse 'collapse' was not successfully initialized\n");
+
+		msg = "";
+		try {
+			Autoref<Label> lb = new DummyLabel(unit2, rt, "lb");
+			collapse->flushOn(lb);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Collapse 'collapse' can not flush on the label 'lb' from a different unit\n");
+
+		Exception::abort_ = true; // restore back
+		Exception::enableBacktrace_ = true; // restore back
+	}
+	unit->clearLabels();
+}
@@ -727,15 +727,18 @@ UTESTCASE deepNested(Utest *utest)
 	iter = t->beginIdx(level3);
 	UT_IS(iter, NULL);
 
-	// basic insertion
-	UT_ASSERT(t->insert(rh11));
+	// basic insertion;
+	// XXX the level1 checks below depend on the order of the records in
+	// the hash: firstOfGroupIdx(level1) goes through parallel2, so the
+	// insertion order must match the order of "c" in level2
 	UT_ASSERT(t->insert(rh12));
-	UT_ASSERT(t->insert(rh21));
+	UT_ASSERT(t->insert(rh11));
 	UT_ASSERT(t->insert(rh22));
-	UT_ASSERT(t->insert(rh11copy));
+	UT_ASSERT(t->insert(rh21));
 	UT_ASSERT(t->insert(rh12copy));
-	UT_ASSERT(t->insert(rh21copy));
+	UT_ASSERT(t->insert(rh11copy));
 	UT_ASSERT(t->insert(rh22copy));
+	UT_ASSERT(t->insert(rh21copy));
 
 	string seq; // this is purely for entertainment, see the resulting order
 	int bitmap = 0;
@@ -787,8 +790,8 @@ UTESTCASE deepNested(Utest *utest)
 		}
 		{
 			iter2 = t->firstOfGroupIdx(parallel1, iter);
-			if (UT_ASSERT(iter2 == rh11)) {
-				printf("    firstOfGroupIdx(parallel1, iter[%d])=%p expect=%p\n", i, iter2, rh11.get());
+			if (UT_ASSERT(iter2 == rh12)) {
+				printf("    firstOfGroupIdx(parallel1, iter[%d])=%p expect=%p\n", i, iter2, rh12.get());
 				fflush(stdout);
 			}
 		}
@@ -847,8 +850,8 @@ UTESTCASE deepNested(Utest *utest)
 		}
 		{
 			iter2 = t->lastOfGroupIdx(parallel1, iter);
-			if (UT_ASSERT(iter2 == rh22copy)) {
-				printf("    lastOfGroupIdx(parallel1, iter[%d])=%p expect=%p\n", i, iter2, rh11.get());
+			if (UT_ASSERT(iter2 == rh21copy)) {
+				printf("    lastOfGroupIdx(parallel1, iter[%d])=%p expect=%p\n", i, iter2, rh21copy.get());
 				fflush(stdout);
 			}
 		}
@@ -942,3 +945,132 @@ UTESTCASE deepNested(Utest *utest)
 	UT_IS(i, 8);
 	printf("    iteration order: %s\n", seq.c_str()); fflush(stdout);
 }
+
+// Print the values of the field "b" in the order of an index.
+string listFifo(Table *t, IndexType *ixt)
+{
+	string res;
+	for (RowHandle *iter = t->beginIdx(ixt); iter != NULL; iter = t->nextIdx(ixt, iter)) {
+		res.append(strprintf("%d ", (int)t->getRowType()->getInt32(iter->getRow(), 1)));
+	}
+	return res;
+}
+
+// The limited index is kept in a ring buffer, check the wrap-around,
+// growing and deletion from the middle.
+UTESTCASE fifoIndexRing(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("fifo", FifoIndexType::make()
+			->setLimit(20)
+		)->addSubIndex("reverse", FifoIndexType::make()
+			->setLimit(30)->setReverse(true)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	IndexType *fwd = tt->findSubIndex("fifo");
+	IndexType *rev = tt->findSubIndex("reverse");
+
+	FdataVec dv;
+	mkfdata(dv);
+	int32_t val;
+	dv[1].data_ = (char *)&val;
+
+	for (val = 0; val < 30; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+
+	UT_IS(t->size(), 20);
+	UT_IS(listFifo(t, fwd), "10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 ");
+	UT_IS(listFifo(t, rev), "29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 ");
+
+	// deletion close to the front and close to the back
+	val = 12;
+	UT_ASSERT(t->deleteRow(rt1->makeRow(dv)));
+	val = 27;
+	UT_ASSERT(t->deleteRow(rt1->makeRow(dv)));
+	UT_IS(t->size(), 18);
+	UT_IS(listFifo(t, fwd), "10 11 13 14 15 16 17 18 19 20 21 22 23 24 25 26 28 29 ");
+	UT_IS(listFifo(t, rev), "29 28 26 25 24 23 22 21 20 19 18 17 16 15 14 13 11 10 ");
+
+	// the first and the last
+	val = 10;
+	UT_ASSERT(t->deleteRow(rt1->makeRow(dv)));
+	val = 29;
+	UT_ASSERT(t->deleteRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fwd), "11 13 14 15 16 17 18 19 20 21 22 23 24 25 26 28 ");
+
+	// fill up again, and push out the oldest rows
+	for (val = 30; val < 36; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(t->size(), 20);
+	UT_IS(listFifo(t, fwd), "14 15 16 17 18 19 20 21 22 23 24 25 26 28 30 31 32 33 34 35 ");
+	UT_IS(listFifo(t, rev), "35 34 33 32 31 30 28 26 25 24 23 22 21 20 19 18 17 16 15 14 ");
+
+	// the deletion of everything one by one, from the front
+	t->clear();
+	UT_IS(t->size(), 0);
+	UT_IS(t->begin(), NULL);
+	UT_IS(t->beginIdx(rev), NULL);
+
+	// the table is usable after being emptied
+	for (val = 0; val < 3; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fwd), "0 1 2 ");
+}
+
+// The ring with a small limit, in the jumping mode.
+UTESTCASE fifoIndexRingJumping(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("fifo", FifoIndexType::make(3, true, true));
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	IndexType *fifo = tt->findSubIndex("fifo");
+
+	FdataVec dv;
+	mkfdata(dv);
+	int32_t val;
+	dv[1].data_ = (char *)&val;
+
+	for (val = 0; val < 3; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fifo), "2 1 0 ");
+
+	UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fifo), "3 ");
+
+	for (val = 4; val < 6; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fifo), "5 4 3 ");
+
+	for (val = 6; val < 8; val++)
+		UT_ASSERT(t->insertRow(rt1->makeRow(dv)));
+	UT_IS(listFifo(t, fifo), "7 6 ");
+	UT_IS(t->size(), 2);
+}
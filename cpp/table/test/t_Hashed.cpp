@@ -254,4 +254,96 @@ UTESTCASE tableops(Utest *utest)
 	UT_ASSERT(!t->deleteRow(r3)); // already removed, not found any more
 }
 
+// enough rows to make the hash table grow and shrink incrementally
+UTESTCASE manyrows(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = (new TableType(rt1))
+		->addSubIndex("primary", new HashedIndexType(
+			(new NameSet())->add("b"))
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	IndexType *prim = tt->findSubIndex("primary");
+	UT_ASSERT(prim != NULL);
+
+	const int32_t n = 20000;
+	FdataVec dv;
+	mkfdata(dv);
+	int32_t b;
+	dv[1].setPtr(true, &b, sizeof(b));
+
+	vector<char> seen(n);
+	RowHandle *iter;
+
+	for (b = 0; b < n; b++) {
+		Rowref r(rt1,  rt1->makeRow(dv));
+		UT_ASSERT(t->insertRow(r));
+	}
+	UT_IS(t->size(), (size_t)n);
+
+	// all the rows must be found
+	for (b = 0; b < n; b++) {
+		Rowref r(rt1,  rt1->makeRow(dv));
+		iter = t->findRowIdx(prim, r);
+		UT_ASSERT(iter != NULL);
+		if (iter == NULL)
+			break;
+		UT_IS(rt1->getInt32(iter->getRow(), 1), b);
+	}
+
+	// the iteration must visit every row once
+	int count = 0;
+	for (iter = t->begin(); iter != NULL; iter = t->next(iter)) {
+		int32_t v = rt1->getInt32(iter->getRow(), 1);
+		UT_ASSERT(v >= 0 && v < n);
+		UT_ASSERT(!seen[v]);
+		seen[v] = 1;
+		++count;
+	}
+	UT_IS(count, n);
+
+	// remove the odd rows, then check what is left
+	for (b = 1; b < n; b += 2) {
+		Rowref r(rt1,  rt1->makeRow(dv));
+		UT_ASSERT(t->deleteRow(r));
+	}
+	UT_IS(t->size(), (size_t)n/2);
+
+	for (b = 0; b < n; b++) {
+		Rowref r(rt1,  rt1->makeRow(dv));
+		iter = t->findRowIdx(prim, r);
+		UT_IS(iter == NULL, (b & 1) != 0);
+	}
+
+	count = 0;
+	for (iter = t->begin(); iter != NULL; iter = t->next(iter)) {
+		int32_t v = rt1->getInt32(iter->getRow(), 1);
+		UT_ASSERT((v & 1) == 0);
+		++count;
+	}
+	UT_IS(count, n/2);
+
+	// remove the rest, interleaving with the iteration
+	for (iter = t->begin(); iter != NULL; ) {
+		RowHandle *cur = iter;
+		iter = t->next(iter);
+		t->remove(cur);
+	}
+	UT_IS(t->size(), (size_t)0);
+	UT_IS(t->begin(), NULL);
+}
+
 // queuing is tested in t_HashedNested
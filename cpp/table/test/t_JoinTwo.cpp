@@ -0,0 +1,392 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the JoinTwo.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <common/Initialize.h>
+#include <table/Table.h>
+#include <table/JoinTwo.h>
+#include <mem/Rhref.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT32:
+			res.append(strprintf("%d", (int)rt->getInt32(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+// collects the printout of the rowops
+class CollectLabel : public Label
+{
+public:
+	CollectLabel(Unit *unit, const_Onceref<RowType> rtype, const string &name) :
+		Label(unit, rtype, name)
+	{ }
+
+	virtual void execute(Rowop *arg) const
+	{
+		res_.append(Rowop::opcodeString(arg->getOpcode()));
+		printAll(res_, getType(), arg->getRow());
+		res_.append("\n");
+	}
+
+	mutable string res_;
+};
+
+// the left side: id, key, string
+Onceref<RowType> mkLeftType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("id", Type::r_int32));
+	fld.push_back(RowType::Field("k", Type::r_int32));
+	fld.push_back(RowType::Field("s", Type::r_string));
+	return new CompactRowType(fld);
+}
+
+// the right side: key, value
+Onceref<RowType> mkRightType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("k", Type::r_int32));
+	fld.push_back(RowType::Field("v", Type::r_string));
+	return new CompactRowType(fld);
+}
+
+Rowref mkleft(const RowType *rt, int32_t id, int32_t k, const char *s)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &id, sizeof(id)));
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, s, strlen(s)+1));
+	return Rowref(rt, rt->makeRow(dv));
+}
+
+Rowref mkright(const RowType *rt, int32_t k, const char *v)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, v, strlen(v)+1));
+	return Rowref(rt, rt->makeRow(dv));
+}
+
+// the left table has a non-leaf index by the key
+Onceref<Table> mkLeftTable(Unit *unit, RowType *rt)
+{
+	Autoref<TableType> tt = initializeOrThrow(TableType::make(rt)
+		->addSubIndex("byId", HashedIndexType::make(
+				(new NameSet())->add("id")
+			)
+		)
+		->addSubIndex("byK", HashedIndexType::make(
+				(new NameSet())->add("k")
+			)->addSubIndex("fifo", FifoIndexType::make())
+		)
+	);
+	return tt->makeTable(unit, "tl");
+}
+
+// the right table has a leaf index by the key
+Onceref<Table> mkRightTable(Unit *unit, RowType *rt)
+{
+	Autoref<TableType> tt = initializeOrThrow(TableType::make(rt)
+		->addSubIndex("byK", HashedIndexType::make(
+				(new NameSet())->add("k")
+			)
+		)
+	);
+	return tt->makeTable(unit, "tr");
+}
+
+UTESTCASE innerJoin(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tl = mkLeftTable(unit, rtl);
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	Autoref<JoinTwo> join = initializeOrThrow(JoinTwo::make(unit, "join", tl, tr,
+		tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"))
+	);
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { int32 id, int32 k, string s, string v, }");
+	UT_IS(join->getOutputLabel()->getName(), "join.out");
+	UT_IS(join->getLeftLookup()->getName(), "join.leftLookup");
+	UT_IS(join->getRightLookup()->getName(), "join.rightLookup");
+
+	Autoref<CollectLabel> coll = new CollectLabel(unit, join->getResultRowType(), "coll");
+	join->getOutputLabel()->chain(coll);
+
+	tl->insertRow(mkleft(rtl, 1, 1, "a"));
+	tr->insertRow(mkright(rtr, 1, "x"));
+	tl->insertRow(mkleft(rtl, 2, 1, "b"));
+	tr->insertRow(mkright(rtr, 1, "y")); // replaces the old row
+	tl->deleteRow(mkleft(rtl, 1, 1, "a"));
+
+	UT_IS(coll->res_,
+		"OP_INSERT id=1 k=1 s=a v=x\n"
+		"OP_INSERT id=2 k=1 s=b v=x\n"
+		"OP_DELETE id=1 k=1 s=a v=x\n"
+		"OP_DELETE id=2 k=1 s=b v=x\n"
+		"OP_INSERT id=1 k=1 s=a v=y\n"
+		"OP_INSERT id=2 k=1 s=b v=y\n"
+		"OP_DELETE id=1 k=1 s=a v=y\n"
+	);
+
+	// the FnReturn gets created once
+	FnReturn *fret = join->fnReturn();
+	UT_ASSERT(fret != NULL);
+	UT_ASSERT(fret == join->fnReturn());
+	UT_IS(fret->getName(), "join.fret");
+	UT_IS(fret->findLabel("out"), 0);
+}
+
+UTESTCASE outerJoin(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tl = mkLeftTable(unit, rtl);
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	Autoref<JoinTwo> join = initializeOrThrow(JoinTwo::make(unit, "join", tl, tr,
+			tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"))
+		->setType(JoinTwo::JT_OUTER)
+	);
+	UT_IS(join->getType(), JoinTwo::JT_OUTER);
+	UT_ASSERT(join->getLeftLookup()->getOppositeOuter());
+	UT_ASSERT(join->getRightLookup()->getOppositeOuter());
+
+	Autoref<CollectLabel> coll = new CollectLabel(unit, join->getResultRowType(), "coll");
+	join->getOutputLabel()->chain(coll);
+
+	tl->insertRow(mkleft(rtl, 1, 1, "a"));
+	UT_IS(coll->res_,
+		"OP_INSERT id=1 k=1 s=a v=-\n"
+	);
+	coll->res_.clear();
+
+	// the right row replaces the row with a missing right side
+	tr->insertRow(mkright(rtr, 1, "x"));
+	UT_IS(coll->res_,
+		"OP_DELETE id=1 k=1 s=a v=-\n"
+		"OP_INSERT id=1 k=1 s=a v=x\n"
+	);
+	coll->res_.clear();
+
+	// the second row in the left group doesn't affect the right side
+	tl->insertRow(mkleft(rtl, 2, 1, "b"));
+	UT_IS(coll->res_,
+		"OP_INSERT id=2 k=1 s=b v=x\n"
+	);
+	coll->res_.clear();
+
+	tl->deleteRow(mkleft(rtl, 1, 1, "a"));
+	UT_IS(coll->res_,
+		"OP_DELETE id=1 k=1 s=a v=x\n"
+	);
+	coll->res_.clear();
+
+	// the last row in the left group brings back the right side alone
+	tl->deleteRow(mkleft(rtl, 2, 1, "b"));
+	UT_IS(coll->res_,
+		"OP_DELETE id=2 k=1 s=b v=x\n"
+		"OP_INSERT id=- k=1 s=- v=x\n"
+	);
+	coll->res_.clear();
+
+	tr->insertRow(mkright(rtr, 2, "y"));
+	UT_IS(coll->res_,
+		"OP_INSERT id=- k=2 s=- v=y\n"
+	);
+	coll->res_.clear();
+
+	tr->deleteRow(mkright(rtr, 1, "x"));
+	UT_IS(coll->res_,
+		"OP_DELETE id=- k=1 s=- v=x\n"
+	);
+	coll->res_.clear();
+}
+
+UTESTCASE fields(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tl = mkLeftTable(unit, rtl);
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	// the key goes from the right side that is first
+	Autoref<JoinTwo> join = initializeOrThrow(JoinTwo::make(unit, "join", tl, tr,
+			tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"))
+		->setType(JoinTwo::JT_LEFT)
+		->setFieldsLeftFirst(false)
+		->setLeftFields((new NameSet())->add("id")->add("k"), (new NameSet())->add("lid")->add("lk"))
+		->setRightFields((new NameSet())->add("k")->add("v"), (new NameSet())->add("rk")->add("rv"))
+	);
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { int32 rk, string rv, int32 lid, }");
+
+	// no uniqueness and no mirroring of the keys
+	Autoref<JoinTwo> join2 = initializeOrThrow(JoinTwo::make(unit, "join2", tl, tr,
+			tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"))
+		->setType(JoinTwo::JT_LEFT)
+		->setFieldsUniqKey(JoinTwo::UK_NONE)
+		->setRightFields((new NameSet())->add("k")->add("v"), (new NameSet())->add("rk")->add("rv"))
+	);
+	UT_IS(join2->getResultRowType()->print(NOINDENT),
+		"row { int32 id, int32 k, string s, int32 rk, string rv, }");
+
+	Autoref<CollectLabel> coll = new CollectLabel(unit, join->getResultRowType(), "coll");
+	join->getOutputLabel()->chain(coll);
+	Autoref<CollectLabel> coll2 = new CollectLabel(unit, join2->getResultRowType(), "coll2");
+	join2->getOutputLabel()->chain(coll2);
+
+	tl->insertRow(mkleft(rtl, 1, 1, "a"));
+	UT_IS(coll->res_,
+		"OP_INSERT rk=1 rv=- lid=1\n"
+	);
+	UT_IS(coll2->res_,
+		"OP_INSERT id=1 k=1 s=a rk=- rv=-\n"
+	);
+
+	UT_IS(JoinTwo::joinTypeString(JoinTwo::JT_RIGHT), string("right"));
+	UT_IS(JoinTwo::stringJoinType("outer"), JoinTwo::JT_OUTER);
+	UT_IS(JoinTwo::stringJoinType("xxx"), -1);
+	UT_IS(JoinTwo::uniqKeyString(JoinTwo::UK_MANUAL), string("manual"));
+	UT_IS(JoinTwo::stringUniqKey("first"), JoinTwo::UK_FIRST);
+}
+
+UTESTCASE selfJoin(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<Table> tl = mkLeftTable(unit, rtl);
+
+	// join the rows with the same key, in an outer way
+	Autoref<JoinTwo> join = initializeOrThrow(JoinTwo::make(unit, "join", tl, tl,
+			tl->getType()->findSubIndex("byK"), tl->getType()->findSubIndex("byK"))
+		->setType(JoinTwo::JT_OUTER)
+		->setLeftFields((new NameSet())->add("id"), (new NameSet())->add("lid"))
+		->setRightFields((new NameSet())->add("id"), (new NameSet())->add("rid"))
+		->setFieldsUniqKey(JoinTwo::UK_MANUAL)
+	);
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { int32 lid, int32 rid, }");
+
+	Autoref<CollectLabel> coll = new CollectLabel(unit, join->getResultRowType(), "coll");
+	join->getOutputLabel()->chain(coll);
+
+	// The left side reads from the pre-label, so it doesn't see the
+	// row being inserted yet, the right side sees it.
+	tl->insertRow(mkleft(rtl, 1, 1, "a"));
+	UT_IS(coll->res_,
+		"OP_INSERT lid=1 rid=-\n"
+		"OP_DELETE lid=1 rid=-\n"
+		"OP_INSERT lid=1 rid=1\n"
+	);
+	coll->res_.clear();
+
+	tl->insertRow(mkleft(rtl, 2, 1, "b"));
+	UT_IS(coll->res_,
+		"OP_INSERT lid=2 rid=1\n"
+		"OP_INSERT lid=1 rid=2\n"
+		"OP_INSERT lid=2 rid=2\n"
+	);
+	coll->res_.clear();
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tl = mkLeftTable(unit, rtl);
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	{
+		// an index without a key
+		Autoref<JoinTwo> join = JoinTwo::make(unit, "join", tl, tr,
+			tl->getType()->findSubIndex("byK")->findSubIndex("fifo"), tr->getType()->findSubIndex("byK"));
+		join->initialize();
+		UT_IS(join->getErrors()->print(), "the left index type and its parents must have the keys\n");
+	}
+	{
+		// the key types don't match
+		Autoref<JoinTwo> join = JoinTwo::make(unit, "join", tl, tr,
+				tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"))
+			->addBy("s", "k");
+		join->initialize();
+		UT_IS(join->getErrors()->print(),
+			"the left lookup join is invalid:\n"
+			"  the join condition fields 's'='k' have different types\n"
+			"the right lookup join is invalid:\n"
+			"  the join condition fields 'k'='s' have different types\n"
+			"  the index key field 'k' is missing from the join condition\n"
+			"  the join condition contains a right-side field 's' that is not in the index key\n");
+	}
+	{
+		// a table from a different unit
+		Autoref<Unit> unit2 = new Unit("u2");
+		Autoref<Table> tr2 = mkRightTable(unit2, rtr);
+		Autoref<JoinTwo> join = JoinTwo::make(unit, "join", tl, tr2,
+			tl->getType()->findSubIndex("byK"), tr2->getType()->findSubIndex("byK"));
+		join->initialize();
+		UT_IS(join->getErrors()->print(),
+			"both tables must have the same unit as the join, got 'u' and 'u2' vs 'u'\n");
+	}
+
+	Exception::abort_ = false; // make them catchable
+	Exception::enableBacktrace_ = false; // make the error messages predictable
+
+	{
+		Autoref<JoinTwo> join = JoinTwo::make(unit, "join", tl, tr,
+			tl->getType()->findSubIndex("byK"), tr->getType()->findSubIndex("byK"));
+		string msg;
+		try {
+			join->fnReturn();
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "JoinTwo 'join' was not successfully initialized\n");
+
+		join->initialize();
+		msg.clear();
+		try {
+			join->setType(JoinTwo::JT_LEFT);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Attempted to change the definition of an initialized JoinTwo 'join'\n");
+	}
+
+	Exception::abort_ = true; // restore back
+	Exception::enableBacktrace_ = true; // restore back
+}
@@ -0,0 +1,337 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the LookupJoin.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <common/Initialize.h>
+#include <table/Table.h>
+#include <table/LookupJoin.h>
+#include <mem/Rhref.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT32:
+			res.append(strprintf("%d", (int)rt->getInt32(row, i)));
+			break;
+		case Type::TT_INT64:
+			res.append(strprintf("%lld", (long long)rt->getInt64(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+// the left side: id, key, string
+Onceref<RowType> mkLeftType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("id", Type::r_int32));
+	fld.push_back(RowType::Field("k", Type::r_int32));
+	fld.push_back(RowType::Field("s", Type::r_string));
+	return new CompactRowType(fld);
+}
+
+// the right side: key, sub-key, string
+Onceref<RowType> mkRightType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("k", Type::r_int32));
+	fld.push_back(RowType::Field("x", Type::r_int64));
+	fld.push_back(RowType::Field("s", Type::r_string));
+	return new CompactRowType(fld);
+}
+
+Row *mkleft(const RowType *rt, int32_t id, int32_t k, const char *s)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &id, sizeof(id)));
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, s, strlen(s)+1));
+	return rt->makeRow(dv);
+}
+
+Row *mkright(const RowType *rt, int32_t k, int64_t x, const char *s)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, &x, sizeof(x)));
+	dv.push_back(Fdata(true, s, strlen(s)+1));
+	return rt->makeRow(dv);
+}
+
+// Make the right-side table and fill it with data.
+Onceref<Table> mkRightTable(Unit *unit, RowType *rtr)
+{
+	Autoref<TableType> tt = initializeOrThrow(TableType::make(rtr)
+		->addSubIndex("prim", HashedIndexType::make(
+				(new NameSet())->add("k")->add("x")
+			)
+		)
+		->addSubIndex("byk", HashedIndexType::make(
+				(new NameSet())->add("k")
+			)->addSubIndex("fifo", FifoIndexType::make())
+		)
+	);
+	Autoref<Table> t = tt->makeTable(unit, "tr");
+	t->insertRow(Rowref(rtr, mkright(rtr, 1, 10, "a")));
+	t->insertRow(Rowref(rtr, mkright(rtr, 1, 20, "b")));
+	t->insertRow(Rowref(rtr, mkright(rtr, 2, 30, "c")));
+	return t;
+}
+
+UTESTCASE leftJoin(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Autoref<LookupJoin> join = initializeOrThrow(LookupJoin::make(unit, "join", rtl, tr,
+			tr->getType()->findSubIndex("byk"))
+		->addBy("k", "k")
+		->setRightFields((new NameSet())->add("x")->add("s"), (new NameSet())->add("rx")->add("rs"))
+	);
+	UT_IS(join->getName(), "join");
+	UT_IS(join->getInputLabel()->getName(), "join.in");
+	UT_IS(join->getOutputLabel()->getName(), "join.out");
+	UT_ASSERT(!join->getLimitOne());
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { int32 id, int32 k, string s, int64 rx, string rs, }");
+
+	unit->call(new Rowop(join->getInputLabel(), Rowop::OP_INSERT, mkleft(rtl, 100, 1, "p")));
+	unit->call(new Rowop(join->getInputLabel(), Rowop::OP_DELETE, mkleft(rtl, 101, 3, "q")));
+
+	string expect =
+		"unit 'u' before label 'join.in' op OP_INSERT id=100 k=1 s=p\n"
+		"unit 'u' before label 'join.out' op OP_INSERT id=100 k=1 s=p rx=10 rs=a\n"
+		"unit 'u' before label 'join.out' op OP_INSERT id=100 k=1 s=p rx=20 rs=b\n"
+		"unit 'u' before label 'join.in' op OP_DELETE id=101 k=3 s=q\n"
+		"unit 'u' before label 'join.out' op OP_DELETE id=101 k=3 s=q rx=- rs=-\n"
+		;
+
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+}
+
+UTESTCASE innerJoin(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	// the leaf index forces limitOne; the left key field id
+	// looks up the right field x, of a different type
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("k", Type::r_int32));
+	fld.push_back(RowType::Field("x", Type::r_int64));
+	Autoref<RowType> rtl2 = new CompactRowType(fld);
+
+	Autoref<LookupJoin> join = initializeOrThrow(LookupJoin::make(unit, "join", rtl2, tr,
+			tr->getType()->findSubIndex("prim"))
+		->addBy("x", "x")
+		->addBy("k", "k")
+		->setIsLeft(false)
+		->setFieldsLeftFirst(false)
+		->setFieldsDropRightKey(true)
+	);
+	UT_ASSERT(join->getLimitOne());
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { string s, int32 k, int64 x, }");
+
+	int32_t k = 1;
+	int64_t x = 20;
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, &x, sizeof(x)));
+	unit->call(new Rowop(join->getInputLabel(), Rowop::OP_INSERT, rtl2->makeRow(dv)));
+	x = 30;
+	unit->call(new Rowop(join->getInputLabel(), Rowop::OP_INSERT, rtl2->makeRow(dv)));
+
+	string expect =
+		"unit 'u' before label 'join.in' op OP_INSERT k=1 x=20\n"
+		"unit 'u' before label 'join.out' op OP_INSERT s=b k=1 x=20\n"
+		"unit 'u' before label 'join.in' op OP_INSERT k=1 x=30\n"
+		;
+
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+}
+
+UTESTCASE mirrorKey(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	Autoref<LookupJoin> join = initializeOrThrow(LookupJoin::make(unit, "join", rtl, tr,
+			tr->getType()->findSubIndex("byk"))
+		->addBy("k", "k")
+		->setLeftFields((new NameSet())->add("id"))
+		->setRightFields((new NameSet())->add("k")->add("s"), (new NameSet())->add("rk")->add("rs"))
+		->setFieldsMirrorKey(true)
+		->setLimitOne(true)
+	);
+	UT_IS(join->getResultRowType()->print(NOINDENT),
+		"row { int32 id, int32 rk, string rs, }");
+
+	// the manual look-up collects the result on a tray
+	Autoref<Tray> tray = new Tray;
+	join->lookup(Rowop::OP_INSERT, Rowref(rtl, mkleft(rtl, 100, 1, "p")), tray);
+	join->lookup(Rowop::OP_DELETE, Rowref(rtl, mkleft(rtl, 101, 3, "q")), tray);
+	UT_IS(tray->size(), 2);
+
+	string res;
+	for (size_t i = 0; i < tray->size(); i++) {
+		Rowop *rop = (*tray)[i];
+		UT_ASSERT(rop->getLabel() == join->getOutputLabel());
+		res.append(Rowop::opcodeString(rop->getOpcode()));
+		printAll(res, join->getResultRowType(), rop->getRow());
+		res.append("\n");
+	}
+	string expect =
+		"OP_INSERT id=100 rk=1 rs=a\n"
+		"OP_DELETE id=101 rk=3 rs=-\n"
+		;
+	if (UT_IS(res, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	// the input label keeps the join alive until the labels get cleared
+	Autoref<Label> lb = join->getInputLabel();
+	join = NULL;
+
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	unit->call(new Rowop(lb, Rowop::OP_INSERT, mkleft(rtl, 100, 1, "p")));
+	UT_IS(trace->getBuffer()->print(),
+		"unit 'u' before label 'join.in' op OP_INSERT id=100 k=1 s=p\n"
+		"unit 'u' before label 'join.out' op OP_INSERT id=100 rk=1 rs=a\n"
+	);
+
+	unit->clearLabels();
+	UT_ASSERT(lb->isCleared());
+	trace->clearBuffer();
+	unit->call(new Rowop(lb, Rowop::OP_INSERT, mkleft(rtl, 100, 1, "p")));
+	UT_IS(trace->getBuffer()->print(), "");
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rtl = mkLeftType();
+	Autoref<RowType> rtr = mkRightType();
+	Autoref<Table> tr = mkRightTable(unit, rtr);
+
+	{
+		Autoref<LookupJoin> join = initialize(LookupJoin::make(unit, "join", rtl, tr,
+				tr->getType()->findSubIndex("prim"))
+			->addBy("k", "k")
+			->addBy("s", "x")
+			->addBy("zz", "k")
+			->addBy("id", "zz")
+			->addBy("id", "s")
+			->addBy("k", "k")
+		);
+		UT_ASSERT(join->getErrors()->hasError());
+		UT_IS(join->getErrors()->print(),
+			"the join condition fields 's'='x' have different types\n"
+			"the join condition contains an unknown left-side field 'zz'\n"
+			"the join condition contains an unknown right-side field 'zz'\n"
+			"the join condition fields 'id'='s' have different types\n"
+			"the join condition contains the right-side field 'k' more than once\n"
+			"the join condition contains a right-side field 'zz' that is not in the index key\n"
+			"the join condition contains a right-side field 's' that is not in the index key\n"
+		);
+	}
+	{
+		Autoref<LookupJoin> join = initialize(LookupJoin::make(unit, "join", rtl, tr,
+				tr->getType()->findSubIndex("byk"))
+			->setLeftFields((new NameSet())->add("id")->add("zz"))
+			->setRightFields((new NameSet())->add("s"), (new NameSet())->add("s")->add("y"))
+		);
+		UT_IS(join->getErrors()->print(),
+			"the join condition must contain at least one pair of fields\n"
+			"the index key field 'k' is missing from the join condition\n"
+			"the left field 'zz' is not in the left row type\n"
+			"the right result names must match the right fields one-to-one\n"
+		);
+	}
+	{
+		// a duplicate field in the result
+		Autoref<LookupJoin> join = initialize(LookupJoin::make(unit, "join", rtl, tr,
+				tr->getType()->findSubIndex("byk"))
+			->addBy("k", "k")
+		);
+		UT_IS(join->getErrors()->print(),
+			"the result row type is invalid:\n"
+			"  duplicate field name 'k' for fields 4 and 2\n"
+			"  duplicate field name 's' for fields 6 and 3\n"
+		);
+
+		Exception::abort_ = false; // make them catchable
+		Exception::enableBacktrace_ = false; // make the error messages predictable
+
+		// no look-ups in a failed join
+		string msg;
+		try {
+			join->lookup(Rowop::OP_INSERT, Rowref(rtl, mkleft(rtl, 100, 1, "p")));
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "LookupJoin 'join' was not successfully initialized\n");
+
+		// no changes after initialization
+		msg = "";
+		try {
+			join->setIsLeft(false);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Attempted to change the definition of an initialized LookupJoin 'join'\n");
+
+		Exception::abort_ = true; // restore back
+		Exception::enableBacktrace_ = true; // restore back
+	}
+	{
+		// an index from a different table type
+		Autoref<Table> tr2 = mkRightTable(unit, rtr);
+		Autoref<LookupJoin> join = initialize(LookupJoin::make(unit, "join", rtl, tr,
+				tr2->getType()->findSubIndex("byk"))
+			->addBy("k", "k")
+		);
+		UT_IS(join->getErrors()->print(),
+			"the right index type must belong to the right table's type\n"
+		);
+	}
+}
@@ -0,0 +1,267 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the SimpleAggregator.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <table/Table.h>
+#include <mem/Rhref.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT32:
+			res.append(strprintf("%d", (int)rt->getInt32(row, i)));
+			break;
+		case Type::TT_INT64:
+			res.append(strprintf("%lld", (long long)rt->getInt64(row, i)));
+			break;
+		case Type::TT_FLOAT64:
+			res.append(strprintf("%g", rt->getFloat64(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+void mkfields(RowType::FieldVec &fields)
+{
+	fields.clear();
+	fields.push_back(RowType::Field("k", Type::r_int32));
+	fields.push_back(RowType::Field("v", Type::r_int64));
+	fields.push_back(RowType::Field("f", Type::r_float64));
+	fields.push_back(RowType::Field("s", Type::r_string));
+}
+
+// make a row, with f NULL if fnull is true
+Row *mkrow(const RowType *rt, int32_t k, int64_t v, double f, bool fnull, const char *s)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, &v, sizeof(v)));
+	dv.push_back(Fdata(!fnull, &f, sizeof(f)));
+	dv.push_back(Fdata(true, s, strlen(s)+1));
+	return rt->makeRow(dv);
+}
+
+UTESTCASE functions(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	RowType::FieldVec afld;
+	afld.push_back(RowType::Field("k", Type::r_int32));
+	afld.push_back(RowType::Field("cnt", Type::r_int64));
+	afld.push_back(RowType::Field("nf", Type::r_int32));
+	afld.push_back(RowType::Field("sumv", Type::r_int64));
+	afld.push_back(RowType::Field("avgf", Type::r_float64));
+	afld.push_back(RowType::Field("minv", Type::r_int64));
+	afld.push_back(RowType::Field("maxv", Type::r_float64)); // converted
+	afld.push_back(RowType::Field("minf", Type::r_float64));
+	afld.push_back(RowType::Field("maxf", Type::r_float64));
+	afld.push_back(RowType::Field("firsts", Type::r_string));
+	afld.push_back(RowType::Field("lasts", Type::r_string));
+	Autoref<RowType> rta = new CompactRowType(afld);
+	UT_ASSERT(rta->getErrors().isNull());
+
+	RowType::FieldVec bfld;
+	bfld.push_back(RowType::Field("k", Type::r_int32));
+	bfld.push_back(RowType::Field("minf", Type::r_float64));
+	bfld.push_back(RowType::Field("maxf", Type::r_float64));
+	Autoref<RowType> rtb = new CompactRowType(bfld);
+	UT_ASSERT(rtb->getErrors().isNull());
+
+	Autoref<SimpleAggregatorType> agga = SimpleAggregatorType::make("agga", rta)
+		// out of order, to check the reordering
+		->addField("cnt", SimpleAggregatorType::FN_COUNT_STAR, "")
+		->addField("k", SimpleAggregatorType::FN_FIRST, "k")
+		->addField("nf", SimpleAggregatorType::FN_COUNT, "f")
+		->addField("sumv", SimpleAggregatorType::FN_SUM, "v")
+		->addField("avgf", SimpleAggregatorType::FN_AVG, "f")
+		->addField("minv", SimpleAggregatorType::FN_MIN, "v") // from Ordered index
+		->addField("maxv", SimpleAggregatorType::FN_MAX, "v") // from Ordered index
+		->addField("minf", SimpleAggregatorType::FN_MIN, "f") // running
+		->addField("maxf", SimpleAggregatorType::FN_MAX, "f") // running
+		->addField("firsts", SimpleAggregatorType::FN_FIRST, "s")
+		->addField("lasts", SimpleAggregatorType::FN_LAST, "s");
+	Autoref<SimpleAggregatorType> aggb = SimpleAggregatorType::make("aggb", rtb)
+		->addField("k", SimpleAggregatorType::FN_FIRST, "k")
+		->addField("minf", SimpleAggregatorType::FN_MIN, "f") // from descending Ordered index
+		->addField("maxf", SimpleAggregatorType::FN_MAX, "f"); // from descending Ordered index
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("byk", HashedIndexType::make(
+				(new NameSet())->add("k")
+			)->addSubIndex("fifo", FifoIndexType::make()
+				->setAggregator(agga)
+			)->addSubIndex("byv", OrderedIndexType::make(
+					(new NameSet())->add("v")->add("s")
+				)->setAggregator(aggb)
+			)->addSubIndex("byf", OrderedIndexType::make(
+					(new NameSet())->add("!f")->add("s")
+				)
+			)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	if (UT_ASSERT(tt->getErrors().isNull())) {
+		printf("errors: %s\n", tt->getErrors()->print().c_str());
+		return;
+	}
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	Rowref r1(rt1, mkrow(rt1, 1, 10, 1.5, false, "a"));
+	Rowref r2(rt1, mkrow(rt1, 1, 5, 0., true, "b"));
+	Rowref r3(rt1, mkrow(rt1, 1, 20, 0.5, false, "c"));
+	Rowref r4(rt1, mkrow(rt1, 2, 7, 2., false, "d"));
+
+	UT_ASSERT(t->insertRow(r1));
+	UT_ASSERT(t->insertRow(r2));
+	UT_ASSERT(t->insertRow(r3));
+	UT_ASSERT(t->deleteRow(r3));
+	UT_ASSERT(t->insertRow(r4));
+	UT_ASSERT(t->deleteRow(r1));
+	UT_ASSERT(t->deleteRow(r4));
+
+	string expect =
+		"unit 'u' before label 't.out' op OP_INSERT k=1 v=10 f=1.5 s=a\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=1 cnt=1 nf=1 sumv=10 avgf=1.5 minv=10 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=a\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.agga' op OP_DELETE k=1 cnt=1 nf=1 sumv=10 avgf=1.5 minv=10 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=a\n"
+		"unit 'u' before label 't.aggb' op OP_DELETE k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=1 v=5 f=- s=b\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=1 cnt=2 nf=1 sumv=15 avgf=1.5 minv=5 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=b\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.agga' op OP_DELETE k=1 cnt=2 nf=1 sumv=15 avgf=1.5 minv=5 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=b\n"
+		"unit 'u' before label 't.aggb' op OP_DELETE k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=1 v=20 f=0.5 s=c\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=1 cnt=3 nf=2 sumv=35 avgf=1 minv=5 maxv=20 minf=0.5 maxf=1.5 firsts=a lasts=c\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=1 minf=0.5 maxf=1.5\n"
+		"unit 'u' before label 't.agga' op OP_DELETE k=1 cnt=3 nf=2 sumv=35 avgf=1 minv=5 maxv=20 minf=0.5 maxf=1.5 firsts=a lasts=c\n"
+		"unit 'u' before label 't.aggb' op OP_DELETE k=1 minf=0.5 maxf=1.5\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 v=20 f=0.5 s=c\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=1 cnt=2 nf=1 sumv=15 avgf=1.5 minv=5 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=b\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=2 v=7 f=2 s=d\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=2 cnt=1 nf=1 sumv=7 avgf=2 minv=7 maxv=7 minf=2 maxf=2 firsts=d lasts=d\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=2 minf=2 maxf=2\n"
+		"unit 'u' before label 't.agga' op OP_DELETE k=1 cnt=2 nf=1 sumv=15 avgf=1.5 minv=5 maxv=10 minf=1.5 maxf=1.5 firsts=a lasts=b\n"
+		"unit 'u' before label 't.aggb' op OP_DELETE k=1 minf=1.5 maxf=1.5\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 v=10 f=1.5 s=a\n"
+		"unit 'u' before label 't.agga' op OP_INSERT k=1 cnt=1 nf=0 sumv=5 avgf=- minv=5 maxv=5 minf=- maxf=- firsts=b lasts=b\n"
+		"unit 'u' before label 't.aggb' op OP_INSERT k=1 minf=- maxf=-\n"
+		"unit 'u' before label 't.agga' op OP_DELETE k=2 cnt=1 nf=1 sumv=7 avgf=2 minv=7 maxv=7 minf=2 maxf=2 firsts=d lasts=d\n"
+		"unit 'u' before label 't.aggb' op OP_DELETE k=2 minf=2 maxf=2\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=2 v=7 f=2 s=d\n"
+		;
+
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	RowType::FieldVec afld;
+	afld.push_back(RowType::Field("a", Type::r_int32));
+	afld.push_back(RowType::Field("b", Type::r_int64));
+	afld.push_back(RowType::Field("c", Type::r_string));
+	afld.push_back(RowType::Field("d", Type::r_int32));
+	afld.push_back(RowType::Field("e", Type::r_int32));
+	Autoref<RowType> rta = new CompactRowType(afld);
+	UT_ASSERT(rta->getErrors().isNull());
+
+	Autoref<SimpleAggregatorType> agg = SimpleAggregatorType::make("agg", rta)
+		->addField("a", SimpleAggregatorType::FN_COUNT_STAR, "k")
+		->addField("a", SimpleAggregatorType::FN_COUNT, "k")
+		->addField("b", SimpleAggregatorType::FN_SUM, "s")
+		->addField("c", SimpleAggregatorType::FN_SUM, "v")
+		->addField("d", SimpleAggregatorType::FN_MIN, "s")
+		->addField("x", SimpleAggregatorType::FN_MIN, "s")
+		->addField("e", SimpleAggregatorType::FN_MAX, "zz");
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("byk", HashedIndexType::make(
+				(new NameSet())->add("k")
+			)->addSubIndex("fifo", FifoIndexType::make()
+				->setAggregator(agg)
+			)
+		);
+
+	tt->initialize();
+	UT_ASSERT(!tt->getErrors().isNull());
+	string expect =
+		"index error:\n"
+		"  nested index 1 'byk':\n"
+		"    nested index 1 'fifo':\n"
+		"      aggregator 'agg':\n"
+		"        the result field 'a' is defined more than once\n"
+		"        the result field 'x' is not in the result row type\n"
+		"        the result field 'a' function 'count_star' requires no argument, got 'k'\n"
+		"        the result field 'b' function 'sum' requires a numeric scalar argument field, 's' is not\n"
+		"        the result field 'c' of function 'sum' must be a numeric scalar\n"
+		"        the result field 'd' of function 'min' must have the same type as the argument field 's'\n"
+		"        the result field 'e' function 'max' refers to an unknown argument field 'zz'\n"
+		;
+	UT_IS(tt->getErrors()->print(), expect);
+
+	// adding to an initialized type is an error (the table type
+	// has made a copy of the aggregator type, so initialize this one directly)
+	agg->initialize(tt, NULL);
+	UT_ASSERT(agg->isInitialized());
+	Exception::abort_ = false;
+	Exception::enableBacktrace_ = false;
+	{
+		string msg;
+		try {
+			agg->addField("y", SimpleAggregatorType::FN_COUNT_STAR, "");
+		} catch(Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Attempted to add a field to an initialized SimpleAggregatorType\n");
+	}
+	Exception::abort_ = true;
+	Exception::enableBacktrace_ = true;
+
+	// the conversion to and from the names
+	UT_IS(string(SimpleAggregatorType::functionString(SimpleAggregatorType::FN_COUNT_STAR)), "count_star");
+	UT_IS(SimpleAggregatorType::stringFunction("avg"), SimpleAggregatorType::FN_AVG);
+	UT_IS(SimpleAggregatorType::stringFunction("nth_simple"), -1);
+}
@@ -310,6 +310,193 @@ UTESTCASE tableops(Utest *utest)
 	UT_ASSERT(!t->deleteRow(r3)); // already removed, not found any more
 }
 
+// the rows coming in order get appended, the rest go through
+// the normal search, including the replacement of the duplicates
+UTESTCASE batch_sorted(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = (new TableType(rt1))
+		->addSubIndex("primary", new SortedIndexType(new MySortB())
+		);
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	FdataVec dv;
+	mkfdata(dv);
+	int32_t val;
+	dv[1].setPtr(true, &val, sizeof(val));
+
+	const int N = 1000;
+	vector<Rowref> rows;
+	vector<const Row *> batch;
+	for (val = 0; val < N; val += 2) {
+		rows.push_back(Rowref(rt1, rt1->makeRow(dv)));
+		batch.push_back(rows.back());
+	}
+	UT_IS(t->insertRows(batch), N/2);
+
+	// fill in the gaps, out of order, and replace some rows
+	batch.clear();
+	for (val = N-1; val >= 0; val -= 2) {
+		rows.push_back(Rowref(rt1, rt1->makeRow(dv)));
+		batch.push_back(rows.back());
+	}
+	for (val = 0; val < N; val += 100) {
+		rows.push_back(Rowref(rt1, rt1->makeRow(dv)));
+		batch.push_back(rows.back());
+	}
+	UT_IS(t->insertRows(batch), N/2 + N/100);
+	UT_IS(t->size(), N);
+
+	int i = 0;
+	for (RowHandle *iter = t->begin(); iter != NULL; iter = t->next(iter), i++) {
+		if (UT_IS(rt1->getInt32(iter->getRow(), 1), i))
+			break;
+	}
+	UT_IS(i, N);
+	// the first row got replaced by the one from the second batch
+	UT_IS(t->begin()->getRow(), rows[N].get());
+}
+
+UTESTCASE range_sorted(Utest *utest)
+{
+	make_catchable();
+
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = (new TableType(rt1))
+		->addSubIndex("primary", new SortedIndexType(new MySortB())
+		)
+		->addSubIndex("fifo", new FifoIndexType()
+		);
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	IndexType *prim = tt->findSubIndex("primary");
+	UT_ASSERT(prim != NULL);
+	IndexType *fifo = tt->findSubIndex("fifo");
+	UT_ASSERT(fifo != NULL);
+
+	UT_ASSERT(prim->isOrdered());
+	UT_ASSERT(!fifo->isOrdered());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	FdataVec dv;
+	mkfdata(dv);
+	int32_t val;
+	dv[1].setPtr(true, &val, sizeof(val));
+
+	// the patterns, with the odd values in between the rows
+	vector<Rowref> pat;
+	for (val = -1; val <= 20; val++)
+		pat.push_back(Rowref(rt1, rt1->makeRow(dv)));
+
+	// an empty table has no range
+	UT_IS(t->lowerBoundRowIdx(prim, pat[5]), NULL);
+	UT_IS(t->upperBoundRowIdx(prim, pat[5]), NULL);
+
+	// the rows with the even values 0..18
+	for (val = 0; val < 20; val += 2) {
+		Rowref r(rt1, rt1->makeRow(dv));
+		UT_ASSERT(t->insertRow(r));
+	}
+
+	RowHandle *rh;
+
+	rh = t->lowerBoundRowIdx(prim, pat[0]); // -1
+	UT_ASSERT(rh != NULL);
+	UT_IS(rt1->getInt32(rh->getRow(), 1), 0);
+	rh = t->lowerBoundRowIdx(prim, pat[6]); // 5
+	UT_ASSERT(rh != NULL);
+	UT_IS(rt1->getInt32(rh->getRow(), 1), 6);
+	rh = t->lowerBoundRowIdx(prim, pat[7]); // 6
+	UT_ASSERT(rh != NULL);
+	UT_IS(rt1->getInt32(rh->getRow(), 1), 6);
+	rh = t->upperBoundRowIdx(prim, pat[7]); // 6
+	UT_ASSERT(rh != NULL);
+	UT_IS(rt1->getInt32(rh->getRow(), 1), 8);
+	rh = t->lowerBoundRowIdx(prim, pat[19]); // 18
+	UT_ASSERT(rh != NULL);
+	UT_IS(rt1->getInt32(rh->getRow(), 1), 18);
+	UT_IS(t->upperBoundRowIdx(prim, pat[19]), NULL); // 18
+	UT_IS(t->lowerBoundRowIdx(prim, pat[20]), NULL); // 19
+
+	// iterate through the range [5, 11]
+	{
+		RowHandle *end = t->upperBoundRowIdx(prim, pat[12]);
+		int n = 0;
+		for (rh = t->lowerBoundRowIdx(prim, pat[6]); rh != end; rh = t->nextIdx(prim, rh), n++) {
+			if (UT_IS(rt1->getInt32(rh->getRow(), 1), 6 + 2*n))
+				break;
+		}
+		UT_IS(n, 3);
+	}
+
+	// the equal range
+	{
+		RowHandle *first, *end;
+		Rhref rh6(t, t->makeRowHandle(pat[7]));
+		t->equalRangeIdx(prim, rh6, first, end);
+		UT_ASSERT(first != NULL);
+		UT_IS(rt1->getInt32(first->getRow(), 1), 6);
+		UT_IS(t->nextIdx(prim, first), end);
+
+		Rhref rh7(t, t->makeRowHandle(pat[8]));
+		t->equalRangeIdx(prim, rh7, first, end);
+		UT_ASSERT(first != NULL);
+		UT_IS(first, end);
+	}
+
+	// the wrong table type is ignored
+	{
+		Autoref<TableType> tt2 = (new TableType(rt1))
+			->addSubIndex("primary", new SortedIndexType(new MySortB())
+			);
+		tt2->initialize();
+		UT_IS(t->lowerBoundRowIdx(tt2->findSubIndex("primary"), pat[7]), NULL);
+	}
+
+	// the unordered index is an error
+	{
+		string msg;
+		try {
+			t->lowerBoundRowIdx(fifo, pat[7]);
+		} catch(Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Table 't': the range search requires an ordered index, got IT_FIFO.\n");
+	}
+	{
+		string msg;
+		try {
+			t->upperBoundRowIdx(fifo, pat[7]);
+		} catch(Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Table 't': the range search requires an ordered index, got IT_FIFO.\n");
+	}
+
+	restore_uncatchable();
+}
+
 bool sortFail = true; // controls whether the sorter fails
 // set a sticky error on each call when sortFail is true, otherwise sort on "b"
 class MySortError : public SortedIndexCondition
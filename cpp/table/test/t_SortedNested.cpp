@@ -329,3 +329,93 @@ UTESTCASE tableops(Utest *utest)
 	UT_IS(iter, NULL);
 }
 
+
+// make a row with the specified values of fields "b" and "c"
+Row *mkrowbc(RowType *rt, int32_t b, int64_t c)
+{
+	FdataVec dv;
+	mkfdata(dv);
+	dv[1].setPtr(true, &b, sizeof(b));
+	dv[2].setPtr(true, &c, sizeof(c));
+	return rt->makeRow(dv);
+}
+
+UTESTCASE range(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = mktabtype(rt1);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	UT_ASSERT(tt->getErrors().isNull());
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	IndexType *prim = tt->findSubIndex("primary");
+	UT_ASSERT(prim != NULL);
+
+	IndexType *sec = prim->findSubIndex("level2");
+	UT_ASSERT(sec != NULL);
+
+	Rowref r11(rt1, mkrowbc(rt1, 1, 1));
+	Rowref r12(rt1, mkrowbc(rt1, 1, 2));
+	Rowref r21(rt1, mkrowbc(rt1, 2, 1));
+	Rowref r22(rt1, mkrowbc(rt1, 2, 2));
+	Rowref r41(rt1, mkrowbc(rt1, 4, 1));
+
+	UT_ASSERT(t->insertRow(r11));
+	UT_ASSERT(t->insertRow(r22));
+	UT_ASSERT(t->insertRow(r12));
+	UT_ASSERT(t->insertRow(r41));
+	UT_ASSERT(t->insertRow(r21));
+
+	RowHandle *rh;
+
+	// the leaf index searches within the group and then continues
+	// into the following groups
+	rh = t->lowerBoundRowIdx(sec, r12);
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r12.get());
+	rh = t->upperBoundRowIdx(sec, r12);
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r21.get());
+	rh = t->lowerBoundRowIdx(sec, Rowref(rt1, mkrowbc(rt1, 1, 0)));
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r11.get());
+	rh = t->lowerBoundRowIdx(sec, Rowref(rt1, mkrowbc(rt1, 1, 3)));
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r21.get());
+	// the last group
+	UT_IS(t->lowerBoundRowIdx(sec, Rowref(rt1, mkrowbc(rt1, 4, 5))), NULL);
+	// the group doesn't exist
+	UT_IS(t->lowerBoundRowIdx(sec, Rowref(rt1, mkrowbc(rt1, 3, 0))), NULL);
+	UT_IS(t->upperBoundRowIdx(sec, Rowref(rt1, mkrowbc(rt1, 3, 0))), NULL);
+
+	// the non-leaf index searches by the groups
+	rh = t->lowerBoundRowIdx(prim, Rowref(rt1, mkrowbc(rt1, 2, 5)));
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r21.get());
+	rh = t->upperBoundRowIdx(prim, Rowref(rt1, mkrowbc(rt1, 2, 0)));
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r41.get());
+	rh = t->lowerBoundRowIdx(prim, Rowref(rt1, mkrowbc(rt1, 3, 0)));
+	UT_ASSERT(rh != NULL);
+	UT_IS(rh->getRow(), r41.get());
+	UT_IS(t->upperBoundRowIdx(prim, r41), NULL);
+
+	// iterate through the groups [1, 2]
+	{
+		RowHandle *end = t->upperBoundRowIdx(prim, r21);
+		int n = 0;
+		for (rh = t->lowerBoundRowIdx(prim, r11); rh != end; rh = t->nextIdx(prim, rh))
+			n++;
+		UT_IS(n, 4);
+	}
+}
@@ -0,0 +1,329 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the TimeWindow index.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <common/Exception.h>
+#include <table/Table.h>
+#include <mem/Rhref.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT32:
+			res.append(strprintf("%d", (int)rt->getInt32(row, i)));
+			break;
+		case Type::TT_INT64:
+			res.append(strprintf("%lld", (long long)rt->getInt64(row, i)));
+			break;
+		case Type::TT_FLOAT64:
+			res.append(strprintf("%g", rt->getFloat64(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+void mkfields(RowType::FieldVec &fields)
+{
+	fields.clear();
+	fields.push_back(RowType::Field("k", Type::r_int32));
+	fields.push_back(RowType::Field("ts", Type::r_int64));
+	fields.push_back(RowType::Field("v", Type::r_int64));
+}
+
+Row *mkrow(RowType *rt, int32_t k, int64_t ts, int64_t v)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, &ts, sizeof(ts)));
+	dv.push_back(Fdata(true, &v, sizeof(v)));
+	return rt->makeRow(dv);
+}
+
+// Print the values of "ts" and "v" in the order of an index.
+string listIdx(Table *t, IndexType *ixt)
+{
+	string res;
+	for (RowHandle *iter = t->beginIdx(ixt); iter != NULL; iter = t->nextIdx(ixt, iter)) {
+		const RowType *rt = t->getRowType();
+		res.append(strprintf("%lld/%lld ", (long long)rt->getInt64(iter->getRow(), 1), 
+			(long long)rt->getInt64(iter->getRow(), 2)));
+	}
+	return res;
+}
+
+UTESTCASE timeWindow(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("window", TimeWindowIndexType::make("ts"));
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	if (UT_ASSERT(tt->getErrors().isNull())) {
+		printf("errors: %s\n", tt->getErrors()->print().c_str());
+		return;
+	}
+
+	UT_IS(tt->print(NOINDENT), "table ( row { int32 k, int64 ts, int64 v, } ) { index TimeWindowIndex(ts) window, }");
+
+	IndexType *twt = tt->findSubIndex("window");
+	UT_ASSERT(twt != NULL);
+	UT_IS(twt->getIndexId(), IndexType::IT_TIMEWINDOW);
+	UT_IS(twt->getKey(), NULL);
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	// the late rows get sorted in, the same timestamps keep the order of arrival
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 10, 1)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 20, 2)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 15, 3)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 20, 4)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 5, 5)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 15, 6)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 30, 7)));
+	UT_IS(t->size(), 7);
+	UT_IS(listIdx(t, twt), "5/5 10/1 15/3 15/6 20/2 20/4 30/7 ");
+
+	// the whole rows get found
+	Rhref what(t, t->makeRowHandle(mkrow(rt1, 1, 15, 6)));
+	RowHandle *found = t->find(what);
+	UT_ASSERT(found != NULL);
+	UT_IS(rt1->getInt64(found->getRow(), 2), 6);
+	Rhref what2(t, t->makeRowHandle(mkrow(rt1, 1, 15, 8)));
+	UT_IS(t->find(what2), NULL);
+
+	// the deletes in the middle
+	UT_ASSERT(t->deleteRow(mkrow(rt1, 1, 15, 3)));
+	UT_ASSERT(t->deleteRow(mkrow(rt1, 1, 30, 7))); // the last one
+	UT_IS(listIdx(t, twt), "5/5 10/1 15/6 20/2 20/4 ");
+
+	trace->clearBuffer();
+	UT_IS(t->expireBefore(twt, 5), 0);
+	UT_IS(t->expireBefore(20), 3);
+	UT_IS(t->size(), 2);
+	UT_IS(listIdx(t, twt), "20/2 20/4 ");
+
+	string expect =
+		"unit 'u' before label 't.out' op OP_DELETE k=1 ts=5 v=5\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 ts=10 v=1\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 ts=15 v=6\n"
+		;
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	UT_IS(t->expireBefore(100), 2);
+	UT_IS(t->size(), 0);
+	UT_IS(t->begin(), NULL);
+
+	// the table still works after having been emptied
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 40, 8)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 35, 9)));
+	UT_IS(listIdx(t, twt), "35/9 40/8 ");
+}
+
+UTESTCASE timeWindowNested(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	RowType::FieldVec afld;
+	afld.push_back(RowType::Field("k", Type::r_int32));
+	afld.push_back(RowType::Field("cnt", Type::r_int64));
+	afld.push_back(RowType::Field("sumv", Type::r_int64));
+	Autoref<RowType> rta = new CompactRowType(afld);
+	UT_ASSERT(rta->getErrors().isNull());
+
+	Autoref<SimpleAggregatorType> agg = SimpleAggregatorType::make("agg", rta)
+		->addField("k", SimpleAggregatorType::FN_FIRST, "k")
+		->addField("cnt", SimpleAggregatorType::FN_COUNT_STAR, "")
+		->addField("sumv", SimpleAggregatorType::FN_SUM, "v");
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("byk", HashedIndexType::make(
+				NameSet::make()->add("k")
+			)->addSubIndex("window", TimeWindowIndexType::make("ts")
+				->setAggregator(agg)
+			)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	if (UT_ASSERT(tt->getErrors().isNull())) {
+		printf("errors: %s\n", tt->getErrors()->print().c_str());
+		return;
+	}
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 10, 1)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 20, 2)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 30, 3)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 2, 10, 4)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 2, 15, 5)));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 3, 30, 6)));
+
+	// One aggregator update per group, the emptied group gets collapsed.
+	// The groups are expired in the order of the hashed index.
+	trace->clearBuffer();
+	UT_IS(t->expireBefore(25), 4);
+	UT_IS(t->size(), 2);
+
+	string expect =
+		"unit 'u' before label 't.agg' op OP_DELETE k=1 cnt=3 sumv=6\n"
+		"unit 'u' before label 't.agg' op OP_DELETE k=2 cnt=2 sumv=9\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=2 ts=10 v=4\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=2 ts=15 v=5\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 ts=10 v=1\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 ts=20 v=2\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=1 cnt=1 sumv=3\n"
+		;
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+
+	IndexType *byk = tt->findSubIndex("byk");
+	UT_IS(t->groupSizeRowIdx(byk, mkrow(rt1, 2, 0, 0)), 0);
+	UT_IS(t->groupSizeRowIdx(byk, mkrow(rt1, 1, 0, 0)), 1);
+	UT_IS(t->groupSizeRowIdx(byk, mkrow(rt1, 3, 0, 0)), 1);
+
+	// the explicit batch removal
+	vector<Rhref> rhv;
+	rhv.push_back(Rhref(t, t->begin()));
+	rhv.push_back(Rhref(t, t->begin())); // the duplicate gets skipped
+	rhv.push_back(Rhref(t, t->makeRowHandle(mkrow(rt1, 1, 1, 1)))); // not in the table
+	UT_IS(t->removeHandles(rhv), 1);
+	UT_IS(t->size(), 1);
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("window", TimeWindowIndexType::make());
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'window':\n    TimeWindowIndexType requires the timestamp field name\n");
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("window", TimeWindowIndexType::make("zz"));
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'window':\n    can not find the timestamp field 'zz'\n");
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("window", TimeWindowIndexType::make("k"));
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'window':\n    the timestamp field 'k' must be an int64 scalar\n");
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("window", TimeWindowIndexType::make("ts")
+				->addSubIndex("fifo", FifoIndexType::make())
+			);
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'window':\n    TimeWindowIndexType currently does not support further nested indexes\n");
+	}
+	{
+		Autoref<IndexType> it1 = TimeWindowIndexType::make("ts");
+		Autoref<IndexType> it2 = TimeWindowIndexType::make("v");
+		Autoref<IndexType> it3 = TimeWindowIndexType::make("ts");
+		UT_ASSERT(!it1->equals(it2));
+		UT_ASSERT(it1->equals(it3));
+		UT_ASSERT(it1->match(it3));
+		Autoref<IndexType> it4 = it2->copy();
+		UT_ASSERT(it2->equals(it4));
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("fifo", FifoIndexType::make());
+		tt->initialize();
+		UT_ASSERT(tt->getErrors().isNull());
+		Autoref<Table> t = tt->makeTable(unit, "t");
+
+		Autoref<TableType> tt2 = TableType::make(rt1)
+			->addSubIndex("window", TimeWindowIndexType::make("ts"));
+		tt2->initialize();
+		UT_ASSERT(tt2->getErrors().isNull());
+		TimeWindowIndexType *twt = static_cast<TimeWindowIndexType *>(tt2->findSubIndex("window"));
+
+		string msg;
+		Exception::abort_ = false; // make them catchable
+		Exception::enableBacktrace_ = false; // make the error messages predictable
+
+		msg.clear();
+		try {
+			t->expireBefore(10);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Table 't' has no TimeWindow index to expire the rows by.\n");
+
+		msg.clear();
+		try {
+			t->expireBefore(twt, 10);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Table 't' can expire the rows only by a TimeWindow index type from its own table type.\n");
+
+		msg.clear();
+		try {
+			twt->setField("v");
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "Attempted to set the timestamp field on an initialized TimeWindow index type\n");
+
+		Exception::abort_ = true;
+		Exception::enableBacktrace_ = true;
+	}
+}
@@ -0,0 +1,287 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the Top index.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+#include <common/Exception.h>
+#include <table/Table.h>
+#include <mem/Rhref.h>
+
+// print all the fields of any row
+void printAll(string &res, const RowType *rt, const Row *row)
+{
+	const RowType::FieldVec &fld = rt->fields();
+	for (size_t i = 0; i < fld.size(); i++) {
+		res.append(" ");
+		res.append(fld[i].name_);
+		res.append("=");
+		if (rt->isFieldNull(row, i)) {
+			res.append("-");
+			continue;
+		}
+		switch (fld[i].type_->getTypeId()) {
+		case Type::TT_INT32:
+			res.append(strprintf("%d", (int)rt->getInt32(row, i)));
+			break;
+		case Type::TT_INT64:
+			res.append(strprintf("%lld", (long long)rt->getInt64(row, i)));
+			break;
+		case Type::TT_FLOAT64:
+			res.append(strprintf("%g", rt->getFloat64(row, i)));
+			break;
+		case Type::TT_STRING:
+			res.append(rt->getString(row, i));
+			break;
+		default:
+			res.append("?");
+			break;
+		}
+	}
+}
+
+void mkfields(RowType::FieldVec &fields)
+{
+	fields.clear();
+	fields.push_back(RowType::Field("k", Type::r_int32));
+	fields.push_back(RowType::Field("id", Type::r_int32));
+	fields.push_back(RowType::Field("v", Type::r_int64));
+	fields.push_back(RowType::Field("s", Type::r_string));
+}
+
+Row *mkrow(RowType *rt, int32_t k, int32_t id, int64_t v, const char *s)
+{
+	FdataVec dv;
+	dv.push_back(Fdata(true, &k, sizeof(k)));
+	dv.push_back(Fdata(true, &id, sizeof(id)));
+	dv.push_back(Fdata(true, &v, sizeof(v)));
+	dv.push_back(Fdata(true, s, strlen(s)+1));
+	return rt->makeRow(dv);
+}
+
+// Print the values of "v" in the order of an index.
+string listIdx(Table *t, IndexType *ixt)
+{
+	string res;
+	for (RowHandle *iter = t->beginIdx(ixt); iter != NULL; iter = t->nextIdx(ixt, iter)) {
+		res.append(strprintf("%lld ", (long long)t->getRowType()->getInt64(iter->getRow(), 2, 0)));
+	}
+	return res;
+}
+
+UTESTCASE topIndex(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("primary", HashedIndexType::make(
+				NameSet::make()->add("id")
+			)
+		)->addSubIndex("top", TopIndexType::make(
+				NameSet::make()->add("!v"), 3
+			)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	if (UT_ASSERT(tt->getErrors().isNull())) {
+		printf("errors: %s\n", tt->getErrors()->print().c_str());
+		return;
+	}
+
+	UT_IS(tt->print(NOINDENT), "table ( row { int32 k, int32 id, int64 v, string s, } ) { index HashedIndex(id, ) primary, index TopIndex(!v, limit=3) top, }");
+
+	Autoref<IndexType> topt = tt->findSubIndex("top");
+	UT_ASSERT(topt);
+	UT_IS(topt->getIndexId(), IndexType::IT_TOP);
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	// fill the table to the limit
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 1, 10, "a")));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 2, 20, "b")));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 3, 30, "c")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "30 20 10 ");
+
+	// a row that doesn't make the cut gets rejected
+	UT_ASSERT(!t->insertRow(mkrow(rt1, 1, 4, 5, "d")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "30 20 10 ");
+
+	// a row at the top pushes out the last one
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 5, 40, "e")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "40 30 20 ");
+
+	// update by the primary key, made possible by the primary index going first
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 2, 25, "b")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "40 30 25 ");
+
+	// the same key in the Top index replaces the old row
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 6, 30, "f")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "40 30 25 ");
+	RowHandle *iter = t->nextIdx(topt, t->beginIdx(topt));
+	UT_IS(rt1->getInt32(iter->getRow(), 1, 0), 6);
+
+	// after a deletion there is space for one more
+	UT_ASSERT(t->deleteRow(mkrow(rt1, 1, 5, 40, "e")));
+	UT_IS(t->size(), 2);
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 7, 1, "g")));
+	UT_IS(t->size(), 3);
+	UT_IS(listIdx(t, topt), "30 25 1 ");
+}
+
+UTESTCASE topNested(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Unit::StringTracer> trace = new Unit::StringNameTracer(false, printAll);
+	unit->setTracer(trace);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	RowType::FieldVec afld;
+	afld.push_back(RowType::Field("k", Type::r_int32));
+	afld.push_back(RowType::Field("cnt", Type::r_int64));
+	afld.push_back(RowType::Field("maxv", Type::r_int64));
+	afld.push_back(RowType::Field("minv", Type::r_int64));
+	Autoref<RowType> rta = new CompactRowType(afld);
+	UT_ASSERT(rta->getErrors().isNull());
+
+	Autoref<SimpleAggregatorType> agg = SimpleAggregatorType::make("agg", rta)
+		->addField("k", SimpleAggregatorType::FN_FIRST, "k")
+		->addField("cnt", SimpleAggregatorType::FN_COUNT_STAR, "")
+		->addField("maxv", SimpleAggregatorType::FN_MAX, "v") // from the Top index
+		->addField("minv", SimpleAggregatorType::FN_MIN, "v"); // from the Top index
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("byk", HashedIndexType::make(
+				NameSet::make()->add("k")
+			)->addSubIndex("top", TopIndexType::make(
+					NameSet::make()->add("!v"), 2
+				)->setAggregator(agg)
+			)
+		);
+
+	UT_ASSERT(tt);
+	tt->initialize();
+	if (UT_ASSERT(tt->getErrors().isNull())) {
+		printf("errors: %s\n", tt->getErrors()->print().c_str());
+		return;
+	}
+
+	Autoref<Table> t = tt->makeTable(unit, "t");
+	UT_ASSERT(!t.isNull());
+
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 1, 10, "a")));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 2, 2, 20, "b")));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 3, 30, "c")));
+	UT_ASSERT(t->insertRow(mkrow(rt1, 1, 4, 40, "d"))); // pushes out 10
+	UT_ASSERT(!t->insertRow(mkrow(rt1, 1, 5, 5, "e"))); // rejected
+	UT_ASSERT(t->insertRow(mkrow(rt1, 2, 6, 5, "f"))); // the other group has space
+	UT_IS(t->size(), 4);
+
+	Autoref<IndexType> topt = tt->findSubIndex("byk")->findSubIndex("top");
+	UT_IS(listIdx(t, topt), "20 5 40 30 "); // the groups go in the hash order
+
+	string expect =
+		"unit 'u' before label 't.out' op OP_INSERT k=1 id=1 v=10 s=a\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=1 cnt=1 maxv=10 minv=10\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=2 id=2 v=20 s=b\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=2 cnt=1 maxv=20 minv=20\n"
+		"unit 'u' before label 't.agg' op OP_DELETE k=1 cnt=1 maxv=10 minv=10\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=1 id=3 v=30 s=c\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=1 cnt=2 maxv=30 minv=10\n"
+		"unit 'u' before label 't.agg' op OP_DELETE k=1 cnt=2 maxv=30 minv=10\n"
+		"unit 'u' before label 't.out' op OP_DELETE k=1 id=1 v=10 s=a\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=1 id=4 v=40 s=d\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=1 cnt=2 maxv=40 minv=30\n"
+		"unit 'u' before label 't.agg' op OP_DELETE k=2 cnt=1 maxv=20 minv=20\n"
+		"unit 'u' before label 't.out' op OP_INSERT k=2 id=6 v=5 s=f\n"
+		"unit 'u' before label 't.agg' op OP_INSERT k=2 cnt=2 maxv=20 minv=5\n"
+		;
+
+	string tlog = trace->getBuffer()->print();
+	if (UT_IS(tlog, expect)) printf("Expected: \"%s\"\n", expect.c_str());
+}
+
+UTESTCASE errors(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("top", TopIndexType::make(
+					NameSet::make()->add("v")
+				)
+			);
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'top':\n    TopIndexType requires a non-0 limit\n");
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("top", TopIndexType::make(
+					NameSet::make()->add("v"), 2
+				)->addSubIndex("fifo", FifoIndexType::make())
+			);
+		tt->initialize();
+		UT_IS(tt->getErrors()->print(), "index error:\n  nested index 1 'top':\n    TopIndexType currently does not support further nested indexes\n");
+	}
+	{
+		Autoref<TableType> tt = TableType::make(rt1)
+			->addSubIndex("top", TopIndexType::make(NameSet::make()->add("v"), 2));
+		tt->initialize();
+		UT_ASSERT(tt->getErrors().isNull());
+		TopIndexType *it = static_cast<TopIndexType *>(tt->findSubIndex("top"));
+		UT_IS(it->getLimit(), 2);
+
+		string msg;
+		Exception::abort_ = false; // make them catchable
+		Exception::enableBacktrace_ = false; // make the error messages predictable
+		try {
+			it->setLimit(3);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		Exception::abort_ = true;
+		Exception::enableBacktrace_ = true;
+		UT_IS(msg, "Attempted to set the limit value on an initialized Top index type\n");
+	}
+	{
+		// the limit is a part of the type
+		Autoref<IndexType> it1 = TopIndexType::make(NameSet::make()->add("v"), 2);
+		Autoref<IndexType> it2 = TopIndexType::make(NameSet::make()->add("v"), 3);
+		Autoref<IndexType> it3 = TopIndexType::make(NameSet::make()->add("v"), 2);
+		Autoref<IndexType> it4 = OrderedIndexType::make(NameSet::make()->add("v"));
+		UT_ASSERT(!it1->equals(it2));
+		UT_ASSERT(it1->equals(it3));
+		UT_ASSERT(!it1->equals(it4));
+		UT_ASSERT(!it1->match(it2));
+		UT_ASSERT(it1->match(it3));
+		Autoref<IndexType> it5 = it2->copy();
+		UT_ASSERT(it2->equals(it5));
+	}
+}
@@ -0,0 +1,225 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of the performance of the table inserts with the different index types,
+// also counting the memory allocations done by the inserts.
+// By default it's configured to run fast at the cost of precision. To increase
+// the precision increase the number of iterations by setting the environment
+// variable:
+//   TRICEPS_PERF_COUNT=0x1000000 t_table_perf
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <utest/Utest.h>
+
+#include <type/AllTypes.h>
+#include <type/BasicAggregatorType.h>
+#include <table/Table.h>
+#include <mem/Rhref.h>
+
+#define DEFAULT_COUNT 100000
+
+// Count all the memory allocations in the program.
+static int64_t allocCount = 0;
+
+void *operator new(size_t size)
+{
+	++allocCount;
+	void *p = malloc(size == 0? 1 : size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](size_t size)
+{
+	++allocCount;
+	void *p = malloc(size == 0? 1 : size);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+	free(p);
+}
+
+static double now()
+{
+	timespec tm;
+	clock_gettime(CLOCK_REALTIME, &tm);
+	return (double)tm.tv_sec + (double)tm.tv_nsec / 1000000000.;
+}
+
+int64_t findRunCount()
+{
+	char *v = getenv("TRICEPS_PERF_COUNT");
+	if (v != NULL) {
+		long long n;
+		if (sscanf(v, "%lli", &n) == 1) {
+			return n;
+		}
+	}
+	return DEFAULT_COUNT;
+}
+
+static Onceref<RowType> mkRowType()
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("k", Type::r_int64));
+	fld.push_back(RowType::Field("g", Type::r_int32));
+	return new CompactRowType(fld);
+}
+
+// an aggregator that does nothing, to measure the overhead of calling it
+void aggNothing(Table *table, AggregatorGadget *gadget, Index *index,
+        const IndexType *parentIndexType, GroupHandle *gh, Tray *dest,
+		Aggregator::AggOp aggop, Rowop::Opcode opcode, RowHandle *rh)
+{ }
+
+// Insert the rows into a table and print the rate.
+// The row handles are created before the measurement, so only the
+// allocations done by the insert itself get counted.
+// @param tt - table type to use, not initialized yet
+// @param name - name of the test for printing
+// @param keyMod - the keys go in the range [0, keyMod), so when
+//     there are fewer keys than rows, the rows get replaced
+// @return - the number of memory allocations per insert
+static double runInserts(Utest *utest, TableType *tt, const char *name, int64_t keyMod)
+{
+	Autoref<TableType> ttref = tt;
+	ttref->initialize();
+	if (UT_ASSERT(ttref->getErrors().isNull())) {
+		printf("%s", ttref->getErrors()->print().c_str());
+		return 1e9;
+	}
+	const RowType *rt = ttref->rowType();
+
+	Autoref<Unit> unit = new Unit("u");
+	Autoref<Table> t = ttref->makeTable(unit, "t");
+
+	int64_t n = findRunCount();
+	vector<Rhref> handles;
+	handles.reserve(n);
+	for (int64_t i = 0; i < n; i++) {
+		// a scrambled order of the keys
+		int64_t k = (i * 7919) % keyMod;
+		int32_t g = (int32_t)(k % 1000);
+		FdataVec dv;
+		dv.push_back(Fdata(true, &k, sizeof(k)));
+		dv.push_back(Fdata(true, &g, sizeof(g)));
+		Rowref r(rt, rt->makeRow(dv));
+		handles.push_back(Rhref(t, t->makeRowHandle(r)));
+	}
+
+	int64_t allocStart = allocCount;
+	double tstart = now();
+	for (int64_t i = 0; i < n; i++) {
+		t->insert(handles[i]);
+	}
+	double tend = now();
+	int64_t allocs = allocCount - allocStart;
+
+	printf("        %-16s %lld inserts, %f seconds, %f inserts per second, %f allocations per insert\n",
+		name, (long long)n, (tend-tstart), (double)n / (tend-tstart), (double)allocs / n);
+
+	UT_ASSERT(t->size() == (size_t)(n < keyMod? n : keyMod));
+	return (double)allocs / n;
+}
+
+UTESTCASE hashed(Utest *utest)
+{
+	Autoref<RowType> rt = mkRowType();
+	int64_t n = findRunCount();
+
+	double allocs = runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", HashedIndexType::make(
+			NameSet::make()->add("k")
+		)), "hashed", n);
+	// only the occasional growth of the hash table
+	UT_ASSERT(allocs < 0.01);
+
+	allocs = runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", HashedIndexType::make(
+			NameSet::make()->add("k")
+		)), "hashed replace", n / 16);
+	UT_ASSERT(allocs < 0.01);
+}
+
+UTESTCASE fifo(Utest *utest)
+{
+	Autoref<RowType> rt = mkRowType();
+	int64_t n = findRunCount();
+
+	double allocs = runInserts(utest, TableType::make(rt)
+		->addSubIndex("fifo", FifoIndexType::make()
+		), "fifo", n);
+	UT_ASSERT(allocs < 0.01);
+
+	allocs = runInserts(utest, TableType::make(rt)
+		->addSubIndex("fifo", FifoIndexType::make(100)
+		), "fifo limit", 100);
+	UT_ASSERT(allocs < 0.01);
+}
+
+UTESTCASE ordered(Utest *utest)
+{
+	Autoref<RowType> rt = mkRowType();
+	int64_t n = findRunCount();
+
+	// the tree allocates a node for each row
+	runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", OrderedIndexType::make(
+			NameSet::make()->add("k")
+		)), "ordered", n);
+	runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", OrderedIndexType::make(
+			NameSet::make()->add("k")
+		)), "ordered replace", n / 16);
+}
+
+UTESTCASE nested(Utest *utest)
+{
+	Autoref<RowType> rt = mkRowType();
+	int64_t n = findRunCount();
+
+	double allocs = runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", HashedIndexType::make(
+			NameSet::make()->add("k")
+		))
+		->addSubIndex("byGroup", HashedIndexType::make(
+				NameSet::make()->add("g")
+			)->addSubIndex("fifo", FifoIndexType::make()
+			)
+		), "nested", n / 16);
+	// the groups get created only on the first rows
+	UT_ASSERT(allocs < 0.05);
+}
+
+UTESTCASE aggregated(Utest *utest)
+{
+	Autoref<RowType> rt = mkRowType();
+	int64_t n = findRunCount();
+
+	runInserts(utest, TableType::make(rt)
+		->addSubIndex("primary", HashedIndexType::make(
+			NameSet::make()->add("k")
+		))
+		->addSubIndex("byGroup", HashedIndexType::make(
+				NameSet::make()->add("g")
+			)->addSubIndex("fifo", FifoIndexType::make()
+				->setAggregator(new BasicAggregatorType("agg", rt, aggNothing))
+			)
+		), "aggregated", n / 16);
+}
@@ -0,0 +1,254 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Row type that operates on AlignedRow internal representation.
+
+#include <string.h>
+#include <type/AlignedRowType.h>
+#include <common/StringUtil.h>
+
+namespace TRICEPS_NS {
+
+AlignedRowType::AlignedRowType(const FieldVec &fields) :
+	RowType(fields)
+{
+	computeLayout();
+}
+
+AlignedRowType::AlignedRowType(const RowType &proto) :
+	RowType(proto)
+{
+	computeLayout();
+}
+
+AlignedRowType::AlignedRowType(const RowType *proto) :
+	RowType(*proto)
+{
+	computeLayout();
+}
+
+AlignedRowType::~AlignedRowType()
+{ }
+
+void AlignedRowType::computeLayout()
+{
+	int n = (int)fields_.size();
+	FieldLayout var;
+	var.fixedLen_ = 0;
+	var.idx_ = 0;
+	layout_.assign(n, var);
+
+	// the fixed fields start after the null bitmap, at the 8-byte alignment
+	intptr_t off = AlignedRow::nullmapOffset() + (n + 7) / 8;
+	off = (off + 7) & ~(intptr_t)7;
+	fixedOff_ = off;
+
+	// the 8-byte fields go first, so that the 4-byte ones won't break their alignment
+	for (int sz = 8; sz >= 4; sz -= 4) {
+		for (int i = 0; i < n; i++) {
+			const Field &f = fields_[i];
+			if (f.arsz_ != Field::AR_SCALAR)
+				continue;
+			switch (f.type_->getTypeId()) {
+			case TT_INT32:
+			case TT_INT64:
+			case TT_FLOAT64:
+				if (f.type_->getSize() == sz) {
+					layout_[i].fixedLen_ = sz;
+					layout_[i].idx_ = (int32_t)off;
+					off += sz;
+				}
+				break;
+			default:
+				break;
+			}
+		}
+	}
+	varTableOff_ = off;
+
+	nvar_ = 0;
+	for (int i = 0; i < n; i++) {
+		if (layout_[i].fixedLen_ == 0)
+			layout_[i].idx_ = nvar_++;
+	}
+}
+
+RowType *AlignedRowType::newSameFormat(const FieldVec &fields) const
+{
+	return new AlignedRowType(fields);
+}
+
+bool AlignedRowType::isFieldNull(const Row *row, int nf) const
+{
+	return static_cast<const AlignedRow *>(row)->isFieldNull(nf);
+}
+
+bool AlignedRowType::getField(const Row *row, int nf, const char *&ptr, intptr_t &len) const
+{
+	const AlignedRow *ar = static_cast<const AlignedRow *>(row);
+	const FieldLayout &fl = layout_[nf];
+	if (fl.fixedLen_ > 0 && !ar->isIrregular()) {
+		ptr = ar->dataPtr(fl.idx_);
+		if (ar->isFieldNull(nf)) {
+			len = 0;
+			return false;
+		}
+		len = fl.fixedLen_;
+		return true;
+	} else {
+		int idx;
+		const int32_t *tab = varTable(ar, nf, idx);
+		ptr = ar->dataPtr(tab[idx]);
+		len = tab[idx+1] - tab[idx];
+		return ar->isFieldNotNull(nf);
+	}
+}
+
+intptr_t AlignedRowType::getFieldLen(const AlignedRow *row, int nf) const
+{
+	const FieldLayout &fl = layout_[nf];
+	if (fl.fixedLen_ > 0 && !row->isIrregular()) {
+		return row->isFieldNull(nf)? 0 : fl.fixedLen_;
+	} else {
+		int idx;
+		const int32_t *tab = varTable(row, nf, idx);
+		return tab[idx+1] - tab[idx];
+	}
+}
+
+Row *AlignedRowType::makeRow(FdataVec &data) const
+{
+	int i;
+	int n = (int)fields_.size();
+
+	if ((int)data.size() < n)
+		fillFdata(data, n);
+
+	// a value that doesn't fit into its fixed slot makes the row irregular
+	bool irregular = false;
+	for (i = 0; i < n; i++) {
+		if (layout_[i].fixedLen_ > 0 && data[i].notNull_
+		&& data[i].len_ != layout_[i].fixedLen_) {
+			irregular = true;
+			break;
+		}
+	}
+
+	intptr_t taboff;
+	int ntab;
+	if (irregular) {
+		taboff = fixedOff_;
+		ntab = n;
+	} else {
+		taboff = varTableOff_;
+		ntab = nvar_;
+	}
+
+	// calculate the length
+	intptr_t payoff = taboff + sizeof(int32_t) * (ntab + 1);
+	intptr_t paylen = 0;
+	for (i = 0; i < n; i++) {
+		if (data[i].notNull_ && (irregular || layout_[i].fixedLen_ == 0))
+			paylen += data[i].len_;
+	}
+	intptr_t total = payoff + paylen;
+	AlignedRow *row = new (AlignedRow::variableLen(total)) AlignedRow;
+
+	// the padding and the null fixed fields must be zeroed for equalRows()
+	memset(row->dataPtrW(0), 0, payoff);
+	row->hdr_.len_ = (uint32_t)total | (irregular? (uint32_t)AlignedRow::IRREGULAR : 0);
+
+	uint8_t *nullmap = (uint8_t *)row->dataPtrW(AlignedRow::nullmapOffset());
+	int32_t *tab = (int32_t *)row->dataPtrW(taboff);
+	intptr_t off = payoff;
+	for (i = 0; i < n; i++) {
+		const FieldLayout &fl = layout_[i];
+		bool fixed = (!irregular && fl.fixedLen_ > 0);
+		int idx = (irregular? i : fl.idx_);
+
+		if (!data[i].notNull_) {
+			nullmap[i >> 3] |= (1 << (i & 7));
+			if (!fixed)
+				tab[idx] = off;
+			continue;
+		}
+
+		char *to;
+		intptr_t len = data[i].len_;
+		if (fixed) {
+			to = row->dataPtrW(fl.idx_);
+		} else {
+			tab[idx] = off;
+			to = row->dataPtrW(off);
+			off += len;
+		}
+		const char *d = data[i].data_;
+		if (d == NULL) {
+			memset(to, 0, len);
+		} else {
+			memcpy(to, d, len);
+		}
+	}
+	tab[ntab] = off; // past last field
+
+	// fill the overrides
+	int nd = (int)data.size();
+	for (i = n; i < nd; i++) {
+		int f = data[i].nf_;
+		if (f >= n)
+			continue; // wrong field?
+		off = data[i].off_;
+		intptr_t len = data[i].len_;
+		const char *d = data[i].data_;
+		// NULL field will have a length of 0
+		if (off < 0 || len <= 0 || d == NULL || off + len > getFieldLen(row, f))
+			continue;
+		const char *ptr;
+		intptr_t flen;
+		getField(row, f, ptr, flen);
+		memcpy(const_cast<char *>(ptr) + off, d, len);
+	}
+
+	return row;
+}
+
+void AlignedRowType::destroyRow(Row *row) const
+{
+	delete static_cast<AlignedRow *>(row);
+}
+
+void AlignedRowType::hexdumpRow(string &dest, const Row *row, const string &indent) const
+{
+	const AlignedRow *ar = static_cast<const AlignedRow *>(row);
+	hexdump(dest, ar->dataPtr(0), ar->dataLen(), indent.c_str());
+}
+
+bool AlignedRowType::equalRows(const Row *row1, const Row *row2) const
+{
+	if (row1 == row2)
+		return true; // short-circuit
+
+	const AlignedRow *ar1 = static_cast<const AlignedRow *>(row1);
+	const AlignedRow *ar2 = static_cast<const AlignedRow *>(row2);
+	// the layout depends only on the contents, so the equal rows
+	// always have the same layout and the same bytes
+	if (ar1->hdr_.len_ != ar2->hdr_.len_)
+		return false;
+	return memcmp(ar1->dataPtr(0), ar2->dataPtr(0), ar1->dataLen()) == 0;
+}
+
+bool AlignedRowType::isRowEmpty(const Row *row) const
+{
+	const AlignedRow *ar = static_cast<const AlignedRow *>(row);
+	int n = (int)fields_.size();
+	for (int i = 0; i < n; i++) {
+		if (getFieldLen(ar, i) != 0)
+			return false;
+	}
+	return true;
+}
+
+}; // TRICEPS_NS
@@ -0,0 +1,90 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Row type that operates on AlignedRow internal representation.
+
+#ifndef __Triceps_AlignedRowType_h__
+#define __Triceps_AlignedRowType_h__
+
+#include <type/RowType.h>
+#include <mem/AlignedRow.h>
+
+namespace TRICEPS_NS {
+
+// The scalar numeric fields are placed at the fixed aligned offsets,
+// so they are accessible directly, without going through the offset table.
+// The rest of the fields go through the offset table like in CompactRow.
+// The rows are bigger than the compact ones, by the padding and by the
+// space reserved for the null fixed fields.
+class AlignedRowType : public RowType
+{
+public:
+	AlignedRowType(const FieldVec &fields);
+	AlignedRowType(const RowType &proto);
+	// a convenience, since we usually get pointers in Autoref
+	AlignedRowType(const RowType *proto);
+	virtual ~AlignedRowType();
+
+	// from RowType
+	virtual RowType *newSameFormat(const FieldVec &fields) const;
+	virtual bool isFieldNull(const Row *row, int nf) const;
+	virtual bool getField(const Row *row, int nf, const char *&ptr, intptr_t &len) const;
+	virtual Row *makeRow(FdataVec &data_) const;
+	virtual void destroyRow(Row *row) const;
+	virtual void hexdumpRow(string &dest, const Row *row, const string &indent="") const;
+	virtual bool equalRows(const Row *row1, const Row *row2) const;
+	virtual bool isRowEmpty(const Row *row) const;
+
+	// Check whether the field is placed at a fixed offset.
+	// @param nf - field number, starting from 0
+	bool isFieldFixed(int nf) const
+	{
+		return layout_[nf].fixedLen_ > 0;
+	}
+
+protected:
+	// Compute the layout of the fields, called from the constructors.
+	void computeLayout();
+
+	// Get the length of a field in the row.
+	// @param row - row to operate on
+	// @param nf - field number, starting from 0
+	intptr_t getFieldLen(const AlignedRow *row, int nf) const;
+
+	// Get the location of the offset table and the index in it, for a
+	// variable field (or for any field in an irregular row).
+	// @param row - row to operate on
+	// @param nf - field number, starting from 0
+	// @param idx - returns the index of the field in the table
+	// @return - the offset table
+	const int32_t *varTable(const AlignedRow *row, int nf, int &idx) const
+	{
+		if (row->isIrregular()) {
+			idx = nf;
+			return row->offTable(fixedOff_);
+		} else {
+			idx = layout_[nf].idx_;
+			return row->offTable(varTableOff_);
+		}
+	}
+
+	// The placement of a field in the row.
+	struct FieldLayout
+	{
+		int32_t fixedLen_; // the size of a fixed field, 0 for a variable field
+		int32_t idx_; // offset of a fixed field, or index in the offset table of a variable one
+	};
+	typedef vector<FieldLayout> LayoutVec;
+
+	LayoutVec layout_; // placement of the fields
+	intptr_t fixedOff_; // offset of the fixed fields area (or of the offset table in an irregular row)
+	intptr_t varTableOff_; // offset of the offset table for the variable fields
+	int nvar_; // number of the variable fields
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_AlignedRowType_h__
@@ -69,6 +69,10 @@ void StringType::printTo(string &res, const string &indent, const string &subind
 	res.append("string");
 }
 int StringType::cmpValue(const void *left, intptr_t szleft, const void *right, intptr_t szright) const
+{
+	return cmpString(left, szleft, right, szright);
+}
+int StringType::cmpString(const void *left, intptr_t szleft, const void *right, intptr_t szright)
 {
 	// size 0 should never happen (it's a NULL value) but better be safe than sorry
 	if (szleft == 0) {
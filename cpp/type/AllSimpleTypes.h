@@ -76,6 +76,10 @@ public:
 	{ }
 	virtual void printTo(string &res, const string &indent = "", const string &subindent = "  ") const;
 	virtual int cmpValue(const void *left, intptr_t szleft, const void *right, intptr_t szright) const;
+
+	// The same comparison as cmpValue() but callable without an object,
+	// for the comparators specialized by the field types.
+	static int cmpString(const void *left, intptr_t szleft, const void *right, intptr_t szright);
 };
 
 }; // TRICEPS_NS
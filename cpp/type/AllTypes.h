@@ -11,14 +11,18 @@
 
 #include <type/AllSimpleTypes.h>
 #include <type/CompactRowType.h>
+#include <type/AlignedRowType.h>
 #include <type/RowSetType.h>
 #include <type/HashedIndexType.h>
 #include <type/SortedIndexType.h>
 #include <type/OrderedIndexType.h>
+#include <type/TopIndexType.h>
 #include <type/FifoIndexType.h>
+#include <type/TimeWindowIndexType.h>
 #include <type/RootIndexType.h>
 #include <type/TableType.h>
 #include <type/BasicAggregatorType.h>
+#include <type/SimpleAggregatorType.h>
 #include <type/GroupHandleType.h>
 
 namespace TRICEPS_NS {
@@ -9,6 +9,7 @@
 #include <type/FifoIndexType.h>
 #include <type/TableType.h>
 #include <table/FifoIndex.h>
+#include <table/FifoRingIndex.h>
 #include <table/Table.h>
 
 namespace TRICEPS_NS {
@@ -124,7 +125,10 @@ void FifoIndexType::initialize()
 	if (limit_ == 0 && jumping_)
 		errors_->appendMsg(true, "FifoIndexType requires a non-0 limit for the jumping mode");
 
-	rhOffset_ = tabtype_->rhType()->allocate(sizeof(FifoIndex::RhSection));
+	if (limit_ != 0)
+		rhOffset_ = tabtype_->rhType()->allocate(sizeof(RhRingSection));
+	else
+		rhOffset_ = tabtype_->rhType()->allocate(sizeof(RhSection));
 
 	if (!errors_->hasError() && errors_->isEmpty())
 		errors_ = NULL;
@@ -135,14 +139,20 @@ Index *FifoIndexType::makeIndex(const TableType *tabtype, Table *table) const
 	if (!isInitialized() 
 	|| errors_->hasError())
 		return NULL; 
+	if (limit_ != 0)
+		return new FifoRingIndex(tabtype, table, this);
 	return new FifoIndex(tabtype, table, this);
 }
 
 void FifoIndexType::initRowHandleSection(RowHandle *rh) const
 {
-	RhSection *rs = getSection(rh);
-	rs->prev_ = 0;
-	rs->next_ = 0;
+	if (limit_ != 0) {
+		getRingSection(rh)->pos_ = 0;
+	} else {
+		RhSection *rs = getSection(rh);
+		rs->prev_ = 0;
+		rs->next_ = 0;
+	}
 }
 
 void FifoIndexType::clearRowHandleSection(RowHandle *rh) const
@@ -15,6 +15,10 @@ namespace TRICEPS_NS {
 
 // It's not much of an index, simply keeping the records in a list.
 // But it's useful fo rthings like storing the aggregation groups.
+//
+// With a limit the records are kept in a ring buffer of the row handle
+// pointers in each group instead of the list (see FifoRingIndex), that
+// makes the pushing out of the oldest record cheaper.
 class FifoIndexType : public IndexType
 {
 public:
@@ -71,6 +75,7 @@ public:
 protected:
 	// interface for the index instances
 	friend class FifoIndex;
+	friend class FifoRingIndex;
 	
 	// section in the RowHandle, placed at rhOffset_
 	struct RhSection {
@@ -78,6 +83,11 @@ protected:
 		RowHandle *next_; // next in the list
 	};
 
+	// section in the RowHandle for the limited index, placed at rhOffset_
+	struct RhRingSection {
+		size_t pos_; // position in the ring buffer
+	};
+
 	intptr_t getRhOffset() const
 	{
 		return rhOffset_;
@@ -89,6 +99,11 @@ protected:
 		return rh->get<RhSection>(rhOffset_);
 	}
 
+	RhRingSection *getRingSection(const RowHandle *rh) const
+	{
+		return rh->get<RhRingSection>(rhOffset_);
+	}
+
 protected:
 	// used by copy()
 	FifoIndexType(const FifoIndexType &orig, bool flat);
@@ -8,94 +8,25 @@
 
 #include <type/HashedIndexType.h>
 #include <type/TableType.h>
-#include <table/TreeIndex.h>
-#include <table/TreeNestedIndex.h>
+#include <table/HashedIndex.h>
+#include <table/HashedNestedIndex.h>
 #include <table/Table.h>
 #include <string.h>
 
 namespace TRICEPS_NS {
 
-//////////////////////////// HashedIndexType::Less  /////////////////////////
-
-HashedIndexType::Less::Less(const RowType *rt, intptr_t rhOffset, const vector<int32_t> &keyFld)  :
-	TreeIndexType::Less(rt),
-	keyFld_(keyFld),
-	rhOffset_(rhOffset)
-{ }
-
-HashedIndexType::Less::Less(const Less *other, Table *t) :
-	TreeIndexType::Less(other, t),
-	keyFld_(other->keyFld_),
-	rhOffset_(other->rhOffset_)
-{ }
-
-TreeIndexType::Less *HashedIndexType::Less::tableCopy(Table *t) const
-{
-	return new Less(this, t);
-}
-
-bool HashedIndexType::Less::operator() (const RowHandle *r1, const RowHandle *r2) const 
-{
-	RhSection *rs1 = r1->get<RhSection>(rhOffset_);
-	RhSection *rs2 = r2->get<RhSection>(rhOffset_);
-
-	{
-		Hash::SValue h1 = rs1->hash_;
-		Hash::SValue h2= rs2->hash_;
-		if (h1 < h2)
-			return true;
-		if (h1 > h2)
-			return false;
-	}
-
-	// if the hashes match, do the full comparison
-	int nf = keyFld_.size();
-	for (int i = 0; i < nf; i++) {
-		int idx = keyFld_[i];
-		bool notNull1, notNull2;
-		const char *v1, *v2;
-		intptr_t len1, len2;
-
-		notNull1 = rt_->getField(r1->getRow(), idx, v1, len1);
-		notNull2 = rt_->getField(r2->getRow(), idx, v2, len2);
-
-		// another shortcut
-		if (len1 < len2)
-			return true;
-		if (len1 > len2)
-			return false;
-
-		if (len1 != 0) {
-			int df = memcmp(v1, v2, len1);
-			if (df < 0)
-				return true;
-			if (df > 0)
-				return false;
-		}
-
-		// finally check for nulls if all else equal
-		if (!notNull1){
-			if (notNull2)
-				return true;
-		} else {
-			if (!notNull2)
-				return false;
-		}
-	}
-
-	return false; // gets here only on equal values
-}
-
 //////////////////////////// HashedIndexType /////////////////////////
 
 HashedIndexType::HashedIndexType(NameSet *key) :
-	TreeIndexType(IT_HASHED),
+	IndexType(IT_HASHED),
+	rhOffset_(0),
 	key_(key)
 {
 }
 
 HashedIndexType::HashedIndexType(const HashedIndexType &orig, bool flat) :
-	TreeIndexType(orig, flat)
+	IndexType(orig, flat),
+	rhOffset_(0)
 {
 	if (!orig.key_.isNull()) {
 		key_ = new NameSet(*orig.key_);
@@ -103,7 +34,8 @@ HashedIndexType::HashedIndexType(const HashedIndexType &orig, bool flat) :
 }
 
 HashedIndexType::HashedIndexType(const HashedIndexType &orig, HoldRowTypes *holder) :
-	TreeIndexType(orig, holder)
+	IndexType(orig, holder),
+	rhOffset_(0)
 {
 	if (!orig.key_.isNull()) {
 		key_ = new NameSet(*orig.key_);
@@ -243,16 +175,29 @@ void HashedIndexType::initialize()
 	const RowType *rt = tabtype_->rowType();
 	int n = key_->size();
 	keyFld_.resize(n);
+	keySize_.resize(n);
 	for (int i = 0; i < n; i++) {
 		int idx = rt->findIdx((*key_)[i]);
+		keySize_[i] = 0;
 		if (idx < 0) {
 			errors_.f("can not find the key field '%s'", (*key_)[i].c_str());
+		} else {
+			const RowType::Field &f = rt->fields()[idx];
+			if (f.arsz_ == RowType::Field::AR_SCALAR) {
+				switch (f.type_->getTypeId()) {
+				case Type::TT_INT32:
+				case Type::TT_INT64:
+				case Type::TT_FLOAT64:
+					keySize_[i] = f.type_->getSize();
+					break;
+				default:
+					break;
+				}
+			}
 		}
 		keyFld_[i] = idx;
 	}
 	// XXX should it check that the fields don't repeat?
-	
-	less_ = new Less(tabtype_->rowType(), rhOffset_, keyFld_);
 }
 
 Index *HashedIndexType::makeIndex(const TableType *tabtype, Table *table) const
@@ -260,12 +205,10 @@ Index *HashedIndexType::makeIndex(const TableType *tabtype, Table *table) const
 	if (!isInitialized() 
 	|| errors_->hasError())
 		return NULL; 
-	// no need to report the errors, so can just use the same less_,
-	// without creating a copy with the table pointer
 	if (nested_.empty())
-		return new TreeIndex(tabtype, table, this, less_);
+		return new HashedIndex(tabtype, table, this);
 	else
-		return new TreeNestedIndex(tabtype, table, this, less_);
+		return new HashedNestedIndex(tabtype, table, this);
 }
 
 void HashedIndexType::initRowHandleSection(RowHandle *rh) const
@@ -280,29 +223,67 @@ void HashedIndexType::initRowHandleSection(RowHandle *rh) const
 		intptr_t len;
 
 		rt->getField(rh->getRow(), idx, v, len);
-		hash = Hash::append(hash, v, len);
+		// The array size in the field is only a hint, so the
+		// actual length still has to be checked; the shortcuts
+		// produce the same hash as the generic path.
+		if (keySize_[i] == sizeof(uint64_t) && len == sizeof(uint64_t)) {
+			hash = Hash::append64(hash, Hash::read64((const unsigned char *)v));
+		} else if (keySize_[i] == sizeof(uint32_t) && len == sizeof(uint32_t)) {
+			hash = Hash::append32(hash, Hash::read32((const unsigned char *)v));
+		} else {
+			hash = Hash::append(hash, v, len);
+		}
 	}
 
-	RhSection *rs = rh->get<RhSection>(rhOffset_);
-	// initialize the iterator by calling its constructor
-	new(rs) RhSection;
+	RhSection *rs = getSection(rh);
 	rs->hash_ = hash;
+	rs->group_ = NULL;
 }
 
 void HashedIndexType::clearRowHandleSection(RowHandle *rh) const
 { 
-	// clear the iterator by calling its destructor
-	RhSection *rs = rh->get<RhSection>(rhOffset_);
-	rs->~RhSection();
+	// nothing dynamically allocated in the section
 }
 
 void HashedIndexType::copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const
 {
-	RhSection *rs = rh->get<RhSection>(rhOffset_);
-	RhSection *fromrs = fromrh->get<RhSection>(rhOffset_);
+	RhSection *rs = getSection(rh);
+	RhSection *fromrs = getSection(fromrh);
 	
-	// initialize the iterator by calling its constructor inside RhSection constructor
-	new(rs) RhSection(*fromrs);
+	rs->hash_ = fromrs->hash_;
+	// the nested group handles need to find their parent groups
+	rs->group_ = fromrs->group_;
+}
+
+int HashedIndexType::cmpKeys(const RowHandle *r1, const RowHandle *r2) const
+{
+	const RowType *rt = tabtype_->rowType();
+	int nf = keyFld_.size();
+	for (int i = 0; i < nf; i++) {
+		int idx = keyFld_[i];
+		bool notNull1, notNull2;
+		const char *v1, *v2;
+		intptr_t len1, len2;
+
+		notNull1 = rt->getField(r1->getRow(), idx, v1, len1);
+		notNull2 = rt->getField(r2->getRow(), idx, v2, len2);
+
+		// a shortcut
+		if (len1 != len2)
+			return (len1 < len2)? -1 : 1;
+
+		if (len1 != 0) {
+			int df = memcmp(v1, v2, len1);
+			if (df != 0)
+				return df;
+		}
+
+		// finally check for nulls if all else equal
+		if (notNull1 != notNull2)
+			return notNull1? 1 : -1;
+	}
+
+	return 0; // gets here only on equal values
 }
 
 }; // TRICEPS_NS
@@ -9,14 +9,18 @@
 #ifndef __Triceps_HashedIndexType_h__
 #define __Triceps_HashedIndexType_h__
 
-#include <type/TreeIndexType.h>
+#include <type/IndexType.h>
 #include <common/Hash.h>
 
 namespace TRICEPS_NS {
 
 class RowType;
 
-class HashedIndexType : public TreeIndexType
+// The rows are kept in an open-addressing hash table (see table/HashedSet.h).
+// The iteration order is still the same as it used to be with the
+// tree-based implementation: ordered by the hash value, and for the
+// rows with the same hash value by the key fields.
+class HashedIndexType : public IndexType
 {
 public:
 	// Keeps a reference of key. If key is not specified, it
@@ -49,35 +53,38 @@ public:
 	virtual void copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const;
 
 protected:
-	// specialization from TreeIndex
+	// interface for the index instances
+	friend class HashedIndex;
+	friend class HashedNestedIndex;
+	friend class HashedSet;
 
 	// section in the RowHandle, placed at rhOffset_
-	struct RhSection : public BasicRhSection
+	struct RhSection
 	{
 		Hash::Value hash_; // for quicker comparison
+		// For the nested index, the group where the row belongs
+		// (in the group handle itself it's not used).
+		GroupHandle *group_;
 	};
 
-	
-	// Comparator class for the row objects
-	class Less : public TreeIndexType::Less
+	// Get the section in the row handle
+	RhSection *getSection(const RowHandle *rh) const
 	{
-	public:
-		Less(const RowType *rt, intptr_t rhOffset, const vector<int32_t> &keyFld);
-
-		// from TreeIndexType::Less
-		virtual TreeIndexType::Less *tableCopy(Table *t) const;
-		virtual bool operator() (const RowHandle *r1, const RowHandle *r2) const;
-
-	protected:
-		// Internals of the tableCopy();
-		Less(const Less *other, Table *t);
+		return rh->get<RhSection>(rhOffset_);
+	}
 
-		const vector<int32_t> &keyFld_; // indexes of key fields in the record
-		intptr_t rhOffset_; // offset of this index's data in table's row handle
+	// Get the hash value cached in the row handle
+	Hash::Value getHash(const RowHandle *rh) const
+	{
+		return rh->get<RhSection>(rhOffset_)->hash_;
+	}
 
-	private:
-		Less();
-	};
+	// Compare the key fields of two rows. The hash values are not
+	// looked at, the caller is expected to compare them first.
+	// @param r1 - handle of the first row
+	// @param r2 - handle of the second row
+	// @return - <0 if r1 goes first, 0 if the keys are equal, >0 if r2 goes first
+	int cmpKeys(const RowHandle *r1, const RowHandle *r2) const;
 
 protected:
 	// used by copy()
@@ -86,9 +93,12 @@ protected:
 	HashedIndexType(const HashedIndexType &orig, HoldRowTypes *holder);
 
 protected:
-	Autoref<Less> less_;
+	intptr_t rhOffset_; // offset of this index's data in table's row handle
 	Autoref<NameSet> key_;
 	vector<int32_t> keyFld_; // indexes of key fields in the record
+	// For each key field, the size of the fixed-size scalar values that
+	// can be hashed by a shortcut, or 0 for the generic hashing.
+	vector<int32_t> keySize_;
 };
 
 }; // TRICEPS_NS
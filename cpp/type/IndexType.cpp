@@ -222,6 +222,11 @@ const NameSet *IndexType::getKeyExpr() const
 	return getKey();
 }
 
+bool IndexType::isOrdered() const
+{
+	return false;
+}
+
 Erref IndexType::getErrors() const
 {
 	return errors_;
@@ -520,6 +525,40 @@ RowHandle *IndexType::nextIterationIdx(const Table *table, const RowHandle *cur)
 	return nextRow;
 }
 
+RowHandle *IndexType::lowerBoundIdx(const Table *table, const RowHandle *what) const
+{
+	const Index *myidx = parent_->findNestedIndex(nestPos_, table, what);
+	if (myidx == NULL)
+		return NULL; // no such group, so an empty range
+
+	RowHandle *rh = myidx->lowerBound(what);
+	if (rh == NULL) {
+		// past the end of this group, continue into the next one
+		RowHandle *last = myidx->last();
+		if (last == NULL)
+			return NULL;
+		rh = nextIterationIdx(table, last);
+	}
+	return rh;
+}
+
+RowHandle *IndexType::upperBoundIdx(const Table *table, const RowHandle *what) const
+{
+	const Index *myidx = parent_->findNestedIndex(nestPos_, table, what);
+	if (myidx == NULL)
+		return NULL; // no such group, so an empty range
+
+	RowHandle *rh = myidx->upperBound(what);
+	if (rh == NULL) {
+		// past the end of this group, continue into the next one
+		RowHandle *last = myidx->last();
+		if (last == NULL)
+			return NULL;
+		rh = nextIterationIdx(table, last);
+	}
+	return rh;
+}
+
 RowHandle *IndexType::firstOfGroupIdx(const Table *table, const RowHandle *cur) const
 {
 	// logically it's very much like findRecord(), only allows the non-leaf types too
@@ -880,6 +919,8 @@ Valname indexids[] = {
 	{ IndexType::IT_FIFO, "IT_FIFO" },
 	{ IndexType::IT_SORTED, "IT_SORTED" },
 	{ IndexType::IT_ORDERED, "IT_ORDERED" },
+	{ IndexType::IT_TOP, "IT_TOP" },
+	{ IndexType::IT_TIMEWINDOW, "IT_TIMEWINDOW" },
 	{ IndexType::IT_LAST, "IT_LAST" },
 	{ -1, NULL }
 };
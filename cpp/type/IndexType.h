@@ -14,6 +14,7 @@
 #include <table/Aggregator.h>
 #include <common/Errors.h>
 #include <type/NameSet.h>
+#include <common/SmallSet.h>
 
 namespace TRICEPS_NS {
 
@@ -132,11 +133,15 @@ public:
 		IT_FIFO, // FifoIndexType
 		IT_SORTED, // SortedIndexType
 		IT_ORDERED, // OrderedIndexType
+		IT_TOP, // TopIndexType
+		IT_TIMEWINDOW, // TimeWindowIndexType
 		// add new types here
 		IT_LAST
 	};
 
-	typedef set<RowHandle *> RhSet;
+	// A set of rows touched by a table operation. Most operations touch
+	// only one or two rows, so they are kept inline without allocation.
+	typedef SmallSet<RowHandle *, 4> RhSet;
 
 	~IndexType();
 
@@ -198,6 +203,13 @@ public:
 	// calculated as some expression on the fields.
 	virtual const NameSet *getKeyExpr() const;
 
+	// Check whether the index keeps its rows (or groups) ordered by the
+	// key, and so supports the range searches with lowerBoundIdx() and
+	// upperBoundIdx().
+	//
+	// The default implementation returns false.
+	virtual bool isOrdered() const;
+
 	// Define an aggregator on this index. Each aggregator instance
 	// will work on the instance of this index.
 	// Potentially there is no reason to limit to only one aggregator
@@ -308,6 +320,14 @@ public:
 		return tabtype_;
 	}
 
+	// Get the parent index type (the top-level index types have the
+	// root index type as their parent). Available only after the
+	// index type has been placed in a table type.
+	IndexType *getParent() const
+	{
+		return parent_;
+	}
+
 protected:
 	friend class IndexTypeVec;
 	friend class TableType;
@@ -492,6 +512,27 @@ protected:
 	//       (or NULL if that was the last group)
 	RowHandle *nextGroupIdx(const Table *table, const RowHandle *cur) const;
 
+	// Find the first row with the key not less than in the pattern row,
+	// according to this index type. The index type must be ordered.
+	// If the index type is nested, the search is done in the same
+	// group of the parent index type, as where the pattern row belongs,
+	// and if no row is found in that group, the first row of the following
+	// groups is returned. So the result always can be used as the boundary
+	// in the iteration with nextIterationIdx().
+	// @param table - table where to search
+	// @param what - the pattern row
+	// @return - the found row, or NULL if there are no more rows
+	//     in the iteration order of this index type
+	RowHandle *lowerBoundIdx(const Table *table, const RowHandle *what) const;
+
+	// Find the first row with the key greater than in the pattern row,
+	// according to this index type. The rest is the same as in lowerBoundIdx().
+	// @param table - table where to search
+	// @param what - the pattern row
+	// @return - the found row, or NULL if there are no more rows
+	//     in the iteration order of this index type
+	RowHandle *upperBoundIdx(const Table *table, const RowHandle *what) const;
+
 	// Find the group size for this row, according to this index type.
 	// The row may not be in the table, then the group would be found by
 	// findRecord() first. If not found returns 0.
@@ -8,10 +8,14 @@
 
 #include <type/OrderedIndexType.h>
 #include <type/TableType.h>
+#include <type/CompactRowType.h>
+#include <type/AllSimpleTypes.h>
+#include <common/Value.h>
 #include <table/TreeIndex.h>
 #include <table/TreeNestedIndex.h>
 #include <table/Table.h>
 #include <string.h>
+#include <stddef.h>
 
 namespace TRICEPS_NS {
 
@@ -54,6 +58,7 @@ bool OrderedIndexType::Less::operator() (const RowHandle *r1, const RowHandle *r
 		if (!notNull1){
 			if (notNull2)
 				return asc_[i];
+			continue; // both are null, the values are not comparable
 		} else {
 			if (!notNull2)
 				return !asc_[i];
@@ -96,17 +101,286 @@ bool OrderedIndexType::Less::operator() (const RowHandle *r1, const RowHandle *r
 	return false; // gets here only on equal values
 }
 
+//////////////////////////// specialized comparators /////////////////////////
+
+// The comparators for the most common keys of one or two scalar fields
+// of types int32, int64, float64 or string in the CompactRow format.
+// They have the field types and the order direction compiled in, and
+// read the fields directly from the CompactRow, avoiding the virtual calls.
+// The generic OrderedIndexType::Less is used for everything else,
+// and the results of both must be the same.
+
+// The comparisons of the field values, by type.
+template <typename T>
+struct OrderedCmpNum
+{
+	static int cmp(const char *v1, intptr_t len1, const char *v2, intptr_t len2)
+	{
+		return cmpUnalignedVptr<T>(v1, len1, v2, len2);
+	}
+};
+
+struct OrderedCmpString
+{
+	static int cmp(const char *v1, intptr_t len1, const char *v2, intptr_t len2)
+	{
+		return StringType::cmpString(v1, len1, v2, len2);
+	}
+};
+
+// Compare one field of two rows.
+// @param Cmp - the value comparison class
+// @param Asc - flag: the ascending order
+// @param r1 - the first row
+// @param r2 - the second row
+// @param idx - index of the field in the row
+// @return - <0 if r1 goes first, 0 if equal, >0 if r2 goes first
+template <class Cmp, bool Asc>
+inline int orderedCmpField(const CompactRow *r1, const CompactRow *r2, int idx)
+{
+	bool notNull1 = r1->isFieldNotNull(idx);
+	bool notNull2 = r2->isFieldNotNull(idx);
+	if (!notNull1 || !notNull2) {
+		if (notNull1 == notNull2)
+			return 0;
+		// the null value goes first in the ascending order
+		return (notNull2 == Asc)? -1 : 1;
+	}
+	int result = Cmp::cmp(r1->getFieldPtr(idx), r1->getFieldLen(idx),
+		r2->getFieldPtr(idx), r2->getFieldLen(idx));
+	return Asc? result : -result;
+}
+
+template <class Cmp1, bool Asc1>
+class OrderedLess1 : public TreeIndexType::Less
+{
+public:
+	OrderedLess1(const RowType *rt, const vector<int32_t> &keyFld) :
+		TreeIndexType::Less(rt),
+		idx1_(keyFld[0])
+	{ }
+
+	// from TreeIndexType::Less
+	virtual TreeIndexType::Less *tableCopy(Table *t) const
+	{
+		return new OrderedLess1(this, t);
+	}
+	virtual bool operator() (const RowHandle *r1, const RowHandle *r2) const
+	{
+		const CompactRow *cr1 = static_cast<const CompactRow *>(r1->getRow());
+		const CompactRow *cr2 = static_cast<const CompactRow *>(r2->getRow());
+		return orderedCmpField<Cmp1, Asc1>(cr1, cr2, idx1_) < 0;
+	}
+
+protected:
+	OrderedLess1(const OrderedLess1 *other, Table *t) :
+		TreeIndexType::Less(other, t),
+		idx1_(other->idx1_)
+	{ }
+
+	int idx1_; // index of the key field
+};
+
+template <class Cmp1, bool Asc1, class Cmp2, bool Asc2>
+class OrderedLess2 : public TreeIndexType::Less
+{
+public:
+	OrderedLess2(const RowType *rt, const vector<int32_t> &keyFld) :
+		TreeIndexType::Less(rt),
+		idx1_(keyFld[0]),
+		idx2_(keyFld[1])
+	{ }
+
+	// from TreeIndexType::Less
+	virtual TreeIndexType::Less *tableCopy(Table *t) const
+	{
+		return new OrderedLess2(this, t);
+	}
+	virtual bool operator() (const RowHandle *r1, const RowHandle *r2) const
+	{
+		const CompactRow *cr1 = static_cast<const CompactRow *>(r1->getRow());
+		const CompactRow *cr2 = static_cast<const CompactRow *>(r2->getRow());
+		int result = orderedCmpField<Cmp1, Asc1>(cr1, cr2, idx1_);
+		if (result != 0)
+			return result < 0;
+		return orderedCmpField<Cmp2, Asc2>(cr1, cr2, idx2_) < 0;
+	}
+
+protected:
+	OrderedLess2(const OrderedLess2 *other, Table *t) :
+		TreeIndexType::Less(other, t),
+		idx1_(other->idx1_),
+		idx2_(other->idx2_)
+	{ }
+
+	int idx1_, idx2_; // indexes of the key fields
+};
+
+// The arguments for building a specialized comparator.
+struct OrderedLessArgs
+{
+	const RowType *rt_;
+	const vector<int32_t> &keyFld_;
+	const vector<bool> &asc_;
+	vector<int> typeId_; // type id of each key field
+
+	OrderedLessArgs(const RowType *rt, const vector<int32_t> &keyFld, const vector<bool> &asc) :
+		rt_(rt),
+		keyFld_(keyFld),
+		asc_(asc)
+	{ }
+};
+
+// Instantiate the comparator class according to the type and direction of
+// the field at position pos in the key, and pass it to Maker::make().
+// @return - the comparator, or NULL if the field type is not supported
+template <class Maker>
+TreeIndexType::Less *orderedPickField(const OrderedLessArgs &args, int pos)
+{
+	bool asc = args.asc_[pos];
+	switch (args.typeId_[pos]) {
+	case Type::TT_INT32:
+		return asc? Maker::template make<OrderedCmpNum<int32_t>, true>(args)
+			: Maker::template make<OrderedCmpNum<int32_t>, false>(args);
+	case Type::TT_INT64:
+		return asc? Maker::template make<OrderedCmpNum<int64_t>, true>(args)
+			: Maker::template make<OrderedCmpNum<int64_t>, false>(args);
+	case Type::TT_FLOAT64:
+		return asc? Maker::template make<OrderedCmpNum<double>, true>(args)
+			: Maker::template make<OrderedCmpNum<double>, false>(args);
+	case Type::TT_STRING:
+		return asc? Maker::template make<OrderedCmpString, true>(args)
+			: Maker::template make<OrderedCmpString, false>(args);
+	default:
+		return NULL;
+	}
+}
+
+// The makers for the comparators with the known types of the fields.
+struct OrderedMakeLess1
+{
+	template <class Cmp1, bool Asc1>
+	static TreeIndexType::Less *make(const OrderedLessArgs &args)
+	{
+		return new OrderedLess1<Cmp1, Asc1>(args.rt_, args.keyFld_);
+	}
+};
+
+template <class Cmp1, bool Asc1>
+struct OrderedMakeLess2
+{
+	template <class Cmp2, bool Asc2>
+	static TreeIndexType::Less *make(const OrderedLessArgs &args)
+	{
+		return new OrderedLess2<Cmp1, Asc1, Cmp2, Asc2>(args.rt_, args.keyFld_);
+	}
+};
+
+// Having the type of the first field, go pick the type of the second one.
+struct OrderedMakeLess2First
+{
+	template <class Cmp1, bool Asc1>
+	static TreeIndexType::Less *make(const OrderedLessArgs &args)
+	{
+		return orderedPickField< OrderedMakeLess2<Cmp1, Asc1> >(args, 1);
+	}
+};
+
+// Build the specialized comparator if the key is suitable for it.
+// @param rt - row type of the table
+// @param keyFld - indexes of the key fields in the row
+// @param asc - for each key field, true if the order is ascending
+// @return - the comparator, or NULL if there is no specialization for this key
+static TreeIndexType::Less *makeSpecializedLess(const RowType *rt, const vector<int32_t> &keyFld, const vector<bool> &asc)
+{
+	if (dynamic_cast<const CompactRowType *>(rt) == NULL)
+		return NULL;
+
+	int n = keyFld.size();
+	if (n < 1 || n > 2)
+		return NULL;
+
+	OrderedLessArgs args(rt, keyFld, asc);
+	for (int i = 0; i < n; i++) {
+		const RowType::Field &fld = rt->fields()[keyFld[i]];
+		if (fld.arsz_ != RowType::Field::AR_SCALAR)
+			return NULL;
+		args.typeId_.push_back(fld.type_->getTypeId());
+	}
+
+	if (n == 1)
+		return orderedPickField<OrderedMakeLess1>(args, 0);
+	else
+		return orderedPickField<OrderedMakeLess2First>(args, 0);
+}
+
+//////////////////////////// OrderedNormLess /////////////////////////
+
+// The comparator of the normalized keys cached in the row handles.
+// The handles where the key didn't fit are compared by the fallback
+// comparator that looks at the fields.
+class OrderedNormLess : public TreeIndexType::Less
+{
+public:
+	// @param rt - row type of the table
+	// @param rhOffset - offset of the index's section in the row handle
+	// @param fallback - the comparator to use on the handles without the normalized key
+	OrderedNormLess(const RowType *rt, intptr_t rhOffset, TreeIndexType::Less *fallback) :
+		TreeIndexType::Less(rt),
+		fallback_(fallback),
+		rhOffset_(rhOffset)
+	{ }
+
+	// from TreeIndexType::Less
+	virtual TreeIndexType::Less *tableCopy(Table *t) const
+	{
+		return new OrderedNormLess(this, t);
+	}
+	virtual bool operator() (const RowHandle *r1, const RowHandle *r2) const
+	{
+		const OrderedIndexType::NormRhSection *s1 = r1->get<OrderedIndexType::NormRhSection>(rhOffset_);
+		const OrderedIndexType::NormRhSection *s2 = r2->get<OrderedIndexType::NormRhSection>(rhOffset_);
+		if (s1->normLen_ < 0 || s2->normLen_ < 0)
+			return (*fallback_)(r1, r2);
+
+		int32_t len = (s1->normLen_ < s2->normLen_)? s1->normLen_ : s2->normLen_;
+		int result = memcmp(s1->normKey_, s2->normKey_, len);
+		if (result != 0)
+			return result < 0;
+		return s1->normLen_ < s2->normLen_;
+	}
+
+protected:
+	OrderedNormLess(const OrderedNormLess *other, Table *t) :
+		TreeIndexType::Less(other, t),
+		fallback_(other->fallback_->tableCopy(t)),
+		rhOffset_(other->rhOffset_)
+	{ }
+
+	Autoref<TreeIndexType::Less> fallback_;
+	intptr_t rhOffset_; // offset of the index's data in table's row handle
+};
+
 //////////////////////////// OrderedIndexType /////////////////////////
 
 OrderedIndexType::OrderedIndexType(NameSet *key) :
-	TreeIndexType(IT_ORDERED)
+	TreeIndexType(IT_ORDERED),
+	normMax_(0)
+{
+	setKey(key);
+}
+
+OrderedIndexType::OrderedIndexType(IndexId it, NameSet *key) :
+	TreeIndexType(it),
+	normMax_(0)
 {
 	setKey(key);
 }
 
 OrderedIndexType::OrderedIndexType(const OrderedIndexType &orig, bool flat) :
 	TreeIndexType(orig, flat),
-	asc_(orig.asc_)
+	asc_(orig.asc_),
+	normMax_(orig.normMax_)
 {
 	if (!orig.key_.isNull()) {
 		key_ = new NameSet(*orig.key_);
@@ -118,7 +392,8 @@ OrderedIndexType::OrderedIndexType(const OrderedIndexType &orig, bool flat) :
 
 OrderedIndexType::OrderedIndexType(const OrderedIndexType &orig, HoldRowTypes *holder) :
 	TreeIndexType(orig, holder),
-	asc_(orig.asc_)
+	asc_(orig.asc_),
+	normMax_(orig.normMax_)
 {
 	if (!orig.key_.isNull()) {
 		key_ = new NameSet(*orig.key_);
@@ -151,6 +426,20 @@ OrderedIndexType *OrderedIndexType::setKey(NameSet *key)
 	return this;
 }
 
+OrderedIndexType *OrderedIndexType::setNormalizedKey(int maxLen)
+{
+	if (initialized_) {
+		Autoref<OrderedIndexType> cleaner = this;
+		throw Exception::fTrace("Attempted to set the normalized key on an initialized Ordered index type");
+	}
+	if (maxLen < 0) {
+		Autoref<OrderedIndexType> cleaner = this;
+		throw Exception::fTrace("The normalized key length must not be negative, got %d", maxLen);
+	}
+	normMax_ = maxLen;
+	return this;
+}
+
 const NameSet *OrderedIndexType::getKey() const
 {
 	return key_;
@@ -273,7 +562,10 @@ void OrderedIndexType::initialize()
 
 	errors_ = new Errors;
 
-	rhOffset_ = tabtype_->rhType()->allocate(sizeof(BasicRhSection));
+	if (normMax_ > 0)
+		rhOffset_ = tabtype_->rhType()->allocate(offsetof(NormRhSection, normKey_) + normMax_);
+	else
+		rhOffset_ = tabtype_->rhType()->allocate(sizeof(BasicRhSection));
 
 	// find the fields
 	const RowType *rt = tabtype_->rowType();
@@ -283,13 +575,39 @@ void OrderedIndexType::initialize()
 		int idx = rt->findIdx((*key_)[i]);
 		if (idx < 0) {
 			errors_.f("can not find the key field '%s'", (*key_)[i].c_str());
+		} else if (normMax_ > 0) {
+			const RowType::Field &fld = rt->fields()[idx];
+			bool ok = false;
+			if (fld.arsz_ == RowType::Field::AR_SCALAR) {
+				switch (fld.type_->getTypeId()) {
+				case Type::TT_UINT8:
+				case Type::TT_INT32:
+				case Type::TT_INT64:
+				case Type::TT_FLOAT64:
+				case Type::TT_STRING:
+					ok = true;
+					break;
+				default:
+					break;
+				}
+			}
+			if (!ok) {
+				errors_.f("the normalized key does not support the field '%s' of type '%s%s'",
+					(*key_)[i].c_str(), fld.type_->print().c_str(),
+					(fld.arsz_ == RowType::Field::AR_SCALAR? "" : "[]"));
+			}
 		}
 		keyFld_[i] = idx;
 	}
 	// XXX should it check that the fields don't repeat?
 	// XXX if non-simple-type fields will be allowed, need some smarter handling or at least a check
 	
-	less_ = new Less(tabtype_->rowType(), rhOffset_, keyFld_, asc_);
+	if (!errors_->hasError())
+		less_ = makeSpecializedLess(rt, keyFld_, asc_);
+	if (less_.isNull())
+		less_ = new Less(rt, rhOffset_, keyFld_, asc_);
+	if (normMax_ > 0)
+		less_ = new OrderedNormLess(rt, rhOffset_, less_);
 }
 
 Index *OrderedIndexType::makeIndex(const TableType *tabtype, Table *table) const
@@ -307,6 +625,12 @@ Index *OrderedIndexType::makeIndex(const TableType *tabtype, Table *table) const
 
 void OrderedIndexType::initRowHandleSection(RowHandle *rh) const
 {
+	if (normMax_ > 0) {
+		NormRhSection *rs = rh->get<NormRhSection>(rhOffset_);
+		new(&rs->base_) BasicRhSection;
+		rs->normLen_ = normalizeKey(rh->getRow(), rs->normKey_);
+		return;
+	}
 	BasicRhSection *rs = rh->get<BasicRhSection>(rhOffset_);
 	// initialize the iterator by calling its constructor
 	new(rs) BasicRhSection;
@@ -315,12 +639,25 @@ void OrderedIndexType::initRowHandleSection(RowHandle *rh) const
 void OrderedIndexType::clearRowHandleSection(RowHandle *rh) const
 { 
 	// clear the iterator by calling its destructor
+	// (NormRhSection has nothing else to clear)
 	BasicRhSection *rs = rh->get<BasicRhSection>(rhOffset_);
 	rs->~BasicRhSection();
 }
 
 void OrderedIndexType::copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const
 {
+	if (normMax_ > 0) {
+		NormRhSection *rs = rh->get<NormRhSection>(rhOffset_);
+		NormRhSection *fromrs = fromrh->get<NormRhSection>(rhOffset_);
+
+		// the key goes past the end of the structure, so it can't be
+		// copied by the structure's copy constructor
+		new(&rs->base_) BasicRhSection(fromrs->base_);
+		rs->normLen_ = fromrs->normLen_;
+		if (fromrs->normLen_ > 0)
+			memcpy(rs->normKey_, fromrs->normKey_, fromrs->normLen_);
+		return;
+	}
 	BasicRhSection *rs = rh->get<BasicRhSection>(rhOffset_);
 	BasicRhSection *fromrs = fromrh->get<BasicRhSection>(rhOffset_);
 	
@@ -328,4 +665,108 @@ void OrderedIndexType::copyRowHandleSection(RowHandle *rh, const RowHandle *from
 	new(rs) BasicRhSection(*fromrs);
 }
 
+// Write an unsigned value in the big-endian order.
+static inline void putBigEndian(char *to, uint64_t v, int size)
+{
+	for (int i = size - 1; i >= 0; i--) {
+		to[i] = (char)(v & 0xFF);
+		v >>= 8;
+	}
+}
+
+int32_t OrderedIndexType::normalizeKey(const Row *row, char *buf) const
+{
+	// Each field starts with a byte 0 for null or 1 for not null,
+	// followed by the value for not null. The integers are stored
+	// big-endian with the sign bit flipped, the floating-point values
+	// similarly after flipping the sign bit or all the bits for the
+	// negative values, and the strings as transformed by strxfrm()
+	// with a 0 byte after them. All the bytes of the descending fields
+	// are inverted.
+	const RowType *rt = tabtype_->rowType();
+	int32_t len = 0;
+	int nf = keyFld_.size();
+	for (int i = 0; i < nf; i++) {
+		int idx = keyFld_[i];
+		const char *v;
+		intptr_t vlen;
+		int32_t start = len;
+
+		bool notNull = rt->getField(row, idx, v, vlen);
+		if (len >= normMax_)
+			return -1;
+		buf[len++] = notNull? 1 : 0;
+
+		if (notNull) {
+			int typeId = rt->fields()[idx].type_->getTypeId();
+			uint64_t uv;
+			int size;
+			switch (typeId) {
+			case Type::TT_UINT8:
+				uv = *(const uint8_t *)v;
+				size = 1;
+				break;
+			case Type::TT_INT32:
+				if (vlen != sizeof(int32_t))
+					return -1; // keep the same comparison as on the fields
+				uv = (uint32_t)getUnaligned<int32_t>((const int32_t *)v) ^ 0x80000000U;
+				size = 4;
+				break;
+			case Type::TT_INT64:
+				if (vlen != sizeof(int64_t))
+					return -1; // keep the same comparison as on the fields
+				uv = (uint64_t)getUnaligned<int64_t>((const int64_t *)v) ^ ((uint64_t)1 << 63);
+				size = 8;
+				break;
+			case Type::TT_FLOAT64: {
+					if (vlen != sizeof(double))
+						return -1; // keep the same comparison as on the fields
+					double dv = getUnaligned<double>((const double *)v);
+					if (dv != dv)
+						return -1; // NaN has no place in the order
+					if (dv == 0.)
+						dv = 0.; // -0. is equal to 0.
+					memcpy(&uv, &dv, sizeof(uv));
+					if (uv & ((uint64_t)1 << 63))
+						uv = ~uv;
+					else
+						uv ^= ((uint64_t)1 << 63);
+					size = 8;
+				}
+				break;
+			case Type::TT_STRING: {
+					if (vlen == 0)
+						return -1; // keep the same comparison as on the fields
+					// enforce the 0-termination, same as in StringType
+					if (v[vlen-1] != 0)
+						((char *)v)[vlen-1] = 0;
+					size_t avail = normMax_ - len;
+					size_t xlen = strxfrm(buf + len, v, avail);
+					if (xlen >= avail)
+						return -1;
+					len += xlen;
+					buf[len++] = 0;
+					size = 0;
+				}
+				break;
+			default:
+				return -1; // should never happen, checked in initialize()
+			}
+
+			if (size != 0) {
+				if (len + size > normMax_)
+					return -1;
+				putBigEndian(buf + len, uv, size);
+				len += size;
+			}
+		}
+
+		if (!asc_[i]) {
+			for (int32_t j = start; j < len; j++)
+				buf[j] = ~buf[j];
+		}
+	}
+	return len;
+}
+
 }; // TRICEPS_NS
@@ -36,6 +36,26 @@ public:
 	// Keeps a reference of key.
 	OrderedIndexType *setKey(NameSet *key);
 
+	// Enable the caching of the key in the row handles, converted into
+	// a normalized form that preserves the order when compared with memcmp().
+	// The comparisons then don't need to extract the fields from the rows.
+	// The keys that don't fit into maxLen bytes are compared the usual way.
+	// Supported only for the scalar fields of types uint8, int32, int64,
+	// float64 and string; the other fields are reported as errors
+	// at initialization. The string keys are converted with strxfrm(),
+	// so the collation locale must not change while the table has rows.
+	// Can be set only until initialized, afterwards will throw an Exception.
+	//
+	// @param maxLen - maximal length of the normalized key in bytes,
+	//        0 disables the caching (the default)
+	// @return - the same object, for chaining
+	OrderedIndexType *setNormalizedKey(int maxLen);
+	// @return - the maximal length of the normalized key, or 0 if disabled
+	int getNormalizedKey() const
+	{
+		return normMax_;
+	}
+
 	// from Type
 	virtual bool equals(const Type *t) const;
 	virtual bool match(const Type *t) const;
@@ -52,6 +72,17 @@ public:
 	virtual void clearRowHandleSection(RowHandle *rh) const;
 	virtual void copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const;
 
+public:
+	// public for the comparator
+	// section in the RowHandle when the normalized key is enabled;
+	// the basic section goes first, where TreeIndexType expects it,
+	// and the key continues past the end of the structure
+	struct NormRhSection {
+		BasicRhSection base_;
+		int32_t normLen_; // length of the normalized key, or -1 if it didn't fit
+		char normKey_[1]; // really normMax_ bytes
+	};
+
 protected:
 	// specialization from TreeIndex
 
@@ -78,17 +109,30 @@ protected:
 	};
 
 protected:
+	// for the subclasses that have their own index id
+	OrderedIndexType(IndexId it, NameSet *key);
 	// used by copy()
 	OrderedIndexType(const OrderedIndexType &orig, bool flat);
 	// used by deepCopy()
 	OrderedIndexType(const OrderedIndexType &orig, HoldRowTypes *holder);
 
+	// Build the normalized key of a row.
+	// @param row - row to take the key fields from
+	// @param buf - buffer to put the key into, normMax_ bytes long
+	// @return - the length of the key, or -1 if it doesn't fit into the buffer
+	//     or some value has no normalized form (then the row gets compared
+	//     by the fields)
+	int32_t normalizeKey(const Row *row, char *buf) const;
+
 protected:
-	Autoref<Less> less_;
+	// The comparator: either the generic Less or, for the common
+	// kinds of keys, one specialized by the field types.
+	Autoref<TreeIndexType::Less> less_;
 	Autoref<NameSet> key_; // only the names of fields, without descending indicator
 	Autoref<NameSet> fullKey_; // the full definition of the key with "!" prepended to the descending fields
 	vector<int32_t> keyFld_; // indexes of key fields in the record
 	vector<bool> asc_; // for each key field, true if the order is ascending, false if descending
+	int normMax_; // maximal length of the normalized key, 0 if not used
 };
 
 }; // TRICEPS_NS
@@ -9,6 +9,7 @@
 #include <type/RowType.h>
 #include <map>
 #include <string.h>
+#include <typeinfo>
 
 namespace TRICEPS_NS {
 
@@ -58,6 +59,9 @@ bool RowType::equals(const Type *t) const
 	if (!Type::equals(t))
 		return false;
 
+	if (typeid(*this) != typeid(*t)) // the rows of different formats can't be mixed
+		return false;
+
 	const RowType *rt = static_cast<const RowType *>(t);
 
 	if (fields_.size() != rt->fields_.size())
@@ -81,6 +85,9 @@ bool RowType::match(const Type *t) const
 	if (!Type::equals(t))
 		return false;
 
+	if (typeid(*this) != typeid(*t)) // the rows of different formats can't be mixed
+		return false;
+
 	const RowType *rt = static_cast<const RowType *>(t);
 
 	if (fields_.size() != rt->fields_.size())
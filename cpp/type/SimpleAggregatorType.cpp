@@ -0,0 +1,277 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Aggregator with the SQL-like functions computed in C++.
+
+#include <type/SimpleAggregatorType.h>
+#include <type/TableType.h>
+#include <type/IndexType.h>
+#include <table/SimpleAggregator.h>
+#include <sched/AggregatorGadget.h>
+#include <common/StringUtil.h>
+#include <common/Exception.h>
+
+namespace TRICEPS_NS {
+
+Valname aggFunctions[] = {
+	{ SimpleAggregatorType::FN_FIRST, "first" },
+	{ SimpleAggregatorType::FN_LAST, "last" },
+	{ SimpleAggregatorType::FN_COUNT_STAR, "count_star" },
+	{ SimpleAggregatorType::FN_COUNT, "count" },
+	{ SimpleAggregatorType::FN_SUM, "sum" },
+	{ SimpleAggregatorType::FN_MAX, "max" },
+	{ SimpleAggregatorType::FN_MIN, "min" },
+	{ SimpleAggregatorType::FN_AVG, "avg" },
+	{ -1, NULL }
+};
+
+const char *SimpleAggregatorType::functionString(int enval, const char *def)
+{
+	return enum2string(aggFunctions, enval, def);
+}
+
+int SimpleAggregatorType::stringFunction(const char *name)
+{
+	return string2enum(aggFunctions, name);
+}
+
+SimpleAggregatorType::SimpleAggregatorType(const string &name, const RowType *rt) :
+	AggregatorType(name, rt)
+{ }
+
+SimpleAggregatorType::SimpleAggregatorType(const SimpleAggregatorType &agg, HoldRowTypes *holder) :
+	AggregatorType(agg, holder),
+	fields_(agg.fields_)
+{ }
+
+SimpleAggregatorType *SimpleAggregatorType::addField(const string &resField, Function func, const string &argField)
+{
+	if (initialized_) {
+		Autoref<SimpleAggregatorType> cleaner = this;
+		throw Exception::fTrace("Attempted to add a field to an initialized SimpleAggregatorType");
+	}
+	fields_.push_back(FieldDef(resField, func, argField));
+	return this;
+}
+
+AggregatorType *SimpleAggregatorType::copy() const
+{
+	return new SimpleAggregatorType(*this);
+}
+
+AggregatorType *SimpleAggregatorType::deepCopy(HoldRowTypes *holder) const
+{
+	return new SimpleAggregatorType(*this, holder);
+}
+
+bool SimpleAggregatorType::isNumeric(const RowType::Field &fld)
+{
+	if (fld.arsz_ != RowType::Field::AR_SCALAR)
+		return false;
+	switch (fld.type_->getTypeId()) {
+	case TT_UINT8:
+	case TT_INT32:
+	case TT_INT64:
+	case TT_FLOAT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void SimpleAggregatorType::initialize(TableType *tabtype, IndexType *intype)
+{
+	if (initialized_)
+		return;
+	initialized_ = true;
+
+	errors_ = new Errors;
+
+	if (rowType_.isNull()) {
+		errors_.f("the result row type is not set");
+		return;
+	}
+
+	argType_ = tabtype->rowType();
+	const RowType::FieldVec &argfld = argType_->fields();
+	const RowType::FieldVec &resfld = rowType_->fields();
+
+	// put the definitions in the order of the result fields
+	FieldDefVec defs;
+	vector<int> pos(resfld.size(), -1);
+	for (size_t i = 0; i < fields_.size(); i++) {
+		int idx = rowType_->findIdx(fields_[i].resName_);
+		if (idx < 0) {
+			errors_.f("the result field '%s' is not in the result row type", fields_[i].resName_.c_str());
+			continue;
+		}
+		if (pos[idx] >= 0) {
+			errors_.f("the result field '%s' is defined more than once", fields_[i].resName_.c_str());
+			continue;
+		}
+		pos[idx] = i;
+	}
+	for (size_t i = 0; i < resfld.size(); i++) {
+		if (pos[i] < 0) {
+			errors_.f("the result field '%s' is not defined", resfld[i].name_.c_str());
+			continue;
+		}
+		defs.push_back(fields_[pos[i]]);
+		defs.back().resIdx_ = i;
+	}
+
+	for (size_t i = 0; i < defs.size(); i++) {
+		FieldDef &fd = defs[i];
+		const char *fname = functionString(fd.func_);
+		const RowType::Field &rf = resfld[fd.resIdx_];
+
+		if (fd.func_ == FN_COUNT_STAR) {
+			if (!fd.argName_.empty())
+				errors_.f("the result field '%s' function '%s' requires no argument, got '%s'",
+					fd.resName_.c_str(), fname, fd.argName_.c_str());
+		} else {
+			fd.argIdx_ = argType_->findIdx(fd.argName_);
+			if (fd.argIdx_ < 0) {
+				errors_.f("the result field '%s' function '%s' refers to an unknown argument field '%s'",
+					fd.resName_.c_str(), fname, fd.argName_.c_str());
+				continue;
+			}
+		}
+		const RowType::Field *af = (fd.argIdx_ < 0? NULL : &argfld[fd.argIdx_]);
+		if (af != NULL)
+			fd.argFloat_ = (af->type_->getTypeId() == TT_FLOAT64);
+
+		switch (fd.func_) {
+		case FN_SUM:
+		case FN_AVG:
+			if (!isNumeric(*af))
+				errors_.f("the result field '%s' function '%s' requires a numeric scalar argument field, '%s' is not",
+					fd.resName_.c_str(), fname, fd.argName_.c_str());
+			// fall through
+		case FN_COUNT_STAR:
+		case FN_COUNT:
+			if (!isNumeric(rf))
+				errors_.f("the result field '%s' of function '%s' must be a numeric scalar",
+					fd.resName_.c_str(), fname);
+			break;
+		case FN_MIN:
+		case FN_MAX:
+			if (af->arsz_ != RowType::Field::AR_SCALAR)
+				errors_.f("the result field '%s' function '%s' requires a scalar argument field, '%s' is not",
+					fd.resName_.c_str(), fname, fd.argName_.c_str());
+			// fall through
+		case FN_FIRST:
+		case FN_LAST:
+			if (isNumeric(*af) && isNumeric(rf)) {
+				fd.copy_ = (af->type_->getTypeId() == rf.type_->getTypeId());
+			} else if (af->type_->equals(rf.type_) && af->arsz_ == rf.arsz_) {
+				fd.copy_ = true;
+			} else {
+				errors_.f("the result field '%s' of function '%s' must have the same type as the argument field '%s'",
+					fd.resName_.c_str(), fname, fd.argName_.c_str());
+			}
+			break;
+		default:
+			errors_.f("the result field '%s' has an unknown function %d", fd.resName_.c_str(), (int)fd.func_);
+			break;
+		}
+
+		// look for an Ordered index in the group that can provide min and max
+		if ((fd.func_ == FN_MIN || fd.func_ == FN_MAX) && intype != NULL && intype->getParent() != NULL) {
+			const IndexTypeVec &siblings = intype->getParent()->getSubIndexes();
+			for (size_t j = 0; j < siblings.size(); j++) {
+				const IndexType *sib = siblings[j].index_;
+				if (sib->getIndexId() != IndexType::IT_ORDERED && sib->getIndexId() != IndexType::IT_TOP)
+					continue;
+				const NameSet *key = sib->getKeyExpr();
+				if (key == NULL || key->empty())
+					continue;
+				const string &k = (*key)[0];
+				if (k == fd.argName_) {
+					fd.ordPos_ = j;
+					fd.ordAsc_ = true;
+					break;
+				} else if (k.size() > 1 && k[0] == '!' && k.compare(1, string::npos, fd.argName_) == 0) {
+					fd.ordPos_ = j;
+					fd.ordAsc_ = false;
+					break;
+				}
+			}
+		}
+	}
+	fields_ = defs;
+
+	if (!errors_->hasError() && errors_->isEmpty())
+		errors_ = NULL;
+}
+
+bool SimpleAggregatorType::equals(const Type *t) const
+{
+	if (this == t)
+		return true; // self-comparison, shortcut
+	if (!AggregatorType::equals(t))
+		return false;
+
+	const SimpleAggregatorType *sat = static_cast<const SimpleAggregatorType *>(t);
+	if (fields_.size() != sat->fields_.size())
+		return false;
+	for (size_t i = 0; i < fields_.size(); i++) {
+		const FieldDef &f1 = fields_[i];
+		const FieldDef &f2 = sat->fields_[i];
+		if (f1.resName_ != f2.resName_ || f1.func_ != f2.func_ || f1.argName_ != f2.argName_)
+			return false;
+	}
+	return true;
+}
+
+bool SimpleAggregatorType::match(const Type *t) const
+{
+	if (this == t)
+		return true; // self-comparison, shortcut
+	if (!AggregatorType::match(t))
+		return false;
+
+	// the field names may differ but the computations must be the same
+	const SimpleAggregatorType *sat = static_cast<const SimpleAggregatorType *>(t);
+	if (fields_.size() != sat->fields_.size())
+		return false;
+	for (size_t i = 0; i < fields_.size(); i++) {
+		const FieldDef &f1 = fields_[i];
+		const FieldDef &f2 = sat->fields_[i];
+		if (f1.func_ != f2.func_)
+			return false;
+	}
+	return true;
+}
+
+void SimpleAggregatorType::printTo(string &res, const string &indent, const string &subindent) const
+{
+	AggregatorType::printTo(res, indent, subindent);
+	res.append(" {");
+	for (size_t i = 0; i < fields_.size(); i++) {
+		const FieldDef &fd = fields_[i];
+		res.append(" ");
+		res.append(fd.resName_);
+		res.append("=");
+		res.append(functionString(fd.func_));
+		res.append("(");
+		res.append(fd.argName_);
+		res.append(")");
+	}
+	res.append(" }");
+}
+
+AggregatorGadget *SimpleAggregatorType::makeGadget(Table *table, IndexType *intype) const
+{
+	return new AggregatorGadget(this, table, intype);
+}
+
+Aggregator *SimpleAggregatorType::makeAggregator(Table *table, AggregatorGadget *gadget) const
+{
+	return new SimpleAggregator(this);
+}
+
+}; // TRICEPS_NS
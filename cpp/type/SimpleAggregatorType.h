@@ -0,0 +1,139 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Aggregator with the SQL-like functions computed in C++.
+
+#ifndef __Triceps_SimpleAggregatorType_h__
+#define __Triceps_SimpleAggregatorType_h__
+
+#include <type/AggregatorType.h>
+#include <type/RowType.h>
+#include <table/Aggregator.h>
+
+namespace TRICEPS_NS {
+
+class SimpleAggregator;
+
+// The aggregator that computes each result field by one of the
+// standard SQL-like functions on one field of the table's rows.
+// Unlike the Perl SimpleAggregator, it doesn't iterate through the group
+// on every change: count, sum and avg are updated additively from the
+// inserted and deleted rows, first and last are taken from the ends of the
+// group's index, and min and max come from the ends of an Ordered index
+// in the same group if there is one with that field as the first key
+// (otherwise they are kept as a running value, and the group is re-scanned
+// only when the row with the current min or max value gets deleted).
+//
+// The NULL values in the argument field are skipped by all the functions
+// other than first and last. The sum of no values is 0, the avg, min and
+// max of no values are NULL.
+class SimpleAggregatorType : public AggregatorType
+{
+	friend class SimpleAggregator;
+public:
+	// The aggregation functions.
+	enum Function {
+		FN_FIRST, // argument from the first row of the group
+		FN_LAST, // argument from the last row of the group
+		FN_COUNT_STAR, // number of rows in the group, no argument
+		FN_COUNT, // number of non-NULL values
+		FN_SUM, // sum of the values
+		FN_MAX, // maximal value
+		FN_MIN, // minimal value
+		FN_AVG, // average of the non-NULL values
+		// add the new values above
+		FN_LAST_MARKER // for the range checks
+	};
+
+	// Convert the function to string and back.
+	// @param enval - function value
+	// @param def - default value to return if the value is not known
+	// @return - the name of the function, in lowercase as in Perl
+	static const char *functionString(int enval, const char *def = "???");
+	// @param name - name of the function
+	// @return - the function value, or -1 if not found
+	static int stringFunction(const char *name);
+
+	// @param name - name for aggregators' gadget in the table, will be tablename.name
+	// @param rt - type of rows produced by this aggregator, wil be referenced
+	SimpleAggregatorType(const string &name, const RowType *rt);
+	// the default copy constructor also works well
+
+	// for deep copy
+	SimpleAggregatorType(const SimpleAggregatorType &agg, HoldRowTypes *holder);
+
+	// Constructors duplicated as make() for syntactically better usage.
+	static SimpleAggregatorType *make(const string &name, const RowType *rt)
+	{
+		return new SimpleAggregatorType(name, rt);
+	}
+
+	// Define the computation of a result field. Every field of the result
+	// row type must be defined exactly once. The errors in the definitions
+	// are detected on initialization.
+	// May be used only until initialized. Afterwards will throw an Exception.
+	//
+	// @param resField - name of the field in the result row type
+	// @param func - function to compute
+	// @param argField - name of the argument field in the table's row type,
+	//        must be "" for FN_COUNT_STAR
+	// @return - this
+	SimpleAggregatorType *addField(const string &resField, Function func, const string &argField);
+
+	// from Type
+	virtual bool equals(const Type *t) const;
+	virtual bool match(const Type *t) const;
+	virtual void printTo(string &res, const string &indent = "", const string &subindent = "  ") const;
+
+	// from AggregatorType
+	virtual void initialize(TableType *tabtype, IndexType *intype);
+	virtual AggregatorType *copy() const;
+	virtual AggregatorType *deepCopy(HoldRowTypes *holder) const;
+	// creates just the generic AggregatorGadget, nothing special
+	virtual AggregatorGadget *makeGadget(Table *table, IndexType *intype) const;
+	virtual Aggregator *makeAggregator(Table *table, AggregatorGadget *gadget) const;
+
+protected:
+	// Definition of one result field.
+	struct FieldDef
+	{
+		FieldDef(const string &resField, Function func, const string &argField) :
+			resName_(resField),
+			argName_(argField),
+			func_(func),
+			resIdx_(-1),
+			argIdx_(-1),
+			ordPos_(-1),
+			ordAsc_(true),
+			copy_(false),
+			argFloat_(false)
+		{ }
+
+		string resName_; // name of the result field
+		string argName_; // name of the argument field
+		Function func_; // the function to compute
+		// computed on initialization
+		int resIdx_; // index of the result field
+		int argIdx_; // index of the argument field, -1 for FN_COUNT_STAR
+		int ordPos_; // for min and max, position of the Ordered index in the
+			// group that has the argument as the first key, or -1
+		bool ordAsc_; // the direction of that Ordered index
+		bool copy_; // the value is copied as-is, not converted as a number
+		bool argFloat_; // the argument is a floating-point number
+	};
+	typedef vector<FieldDef> FieldDefVec;
+
+	// Check whether the field is a scalar number.
+	// @param fld - field to check
+	static bool isNumeric(const RowType::Field &fld);
+
+	FieldDefVec fields_; // after initialization, in the order of the result fields
+	Autoref<const RowType> argType_; // row type of the table, set on initialization
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_SimpleAggregatorType_h__
@@ -0,0 +1,142 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An index that keeps the rows in the order of a timestamp, for the time windows.
+
+#include <type/TimeWindowIndexType.h>
+#include <type/TableType.h>
+#include <table/TimeWindowIndex.h>
+#include <table/Table.h>
+
+namespace TRICEPS_NS {
+
+TimeWindowIndexType::TimeWindowIndexType(const string &field) :
+	IndexType(IT_TIMEWINDOW),
+	field_(field),
+	rhOffset_(0),
+	fieldIdx_(-1)
+{ }
+
+TimeWindowIndexType::TimeWindowIndexType(const TimeWindowIndexType &orig, bool flat) :
+	IndexType(orig, flat),
+	field_(orig.field_),
+	rhOffset_(0),
+	fieldIdx_(-1)
+{ }
+
+TimeWindowIndexType::TimeWindowIndexType(const TimeWindowIndexType &orig, HoldRowTypes *holder) :
+	IndexType(orig, holder),
+	field_(orig.field_),
+	rhOffset_(0),
+	fieldIdx_(-1)
+{ }
+
+TimeWindowIndexType *TimeWindowIndexType::setField(const string &field)
+{
+	if (initialized_) {
+		Autoref<TimeWindowIndexType> cleaner = this;
+		throw Exception::fTrace("Attempted to set the timestamp field on an initialized TimeWindow index type");
+	}
+	field_ = field;
+	return this;
+}
+
+const NameSet *TimeWindowIndexType::getKey() const
+{
+	return NULL; // the timestamp is not a key
+}
+
+bool TimeWindowIndexType::equals(const Type *t) const
+{
+	if (this == t)
+		return true; // self-comparison, shortcut
+
+	if (!IndexType::equals(t))
+		return false;
+	
+	const TimeWindowIndexType *tit = static_cast<const TimeWindowIndexType *>(t);
+	return (field_ == tit->field_);
+}
+
+void TimeWindowIndexType::printTo(string &res, const string &indent, const string &subindent) const
+{
+	res.append("index TimeWindowIndex(");
+	res.append(field_);
+	res.append(")");
+	printSubelementsTo(res, indent, subindent);
+}
+
+IndexType *TimeWindowIndexType::copy(bool flat) const
+{
+	return new TimeWindowIndexType(*this, flat);
+}
+
+IndexType *TimeWindowIndexType::deepCopy(HoldRowTypes *holder) const
+{
+	return new TimeWindowIndexType(*this, holder);
+}
+
+void TimeWindowIndexType::initialize()
+{
+	if (isInitialized())
+		return; // nothing to do
+	initialized_ = true;
+
+	errors_ = new Errors;
+
+	if (nested_.size() != 0)
+		errors_->appendMsg(true, "TimeWindowIndexType currently does not support further nested indexes");
+
+	if (field_.empty()) {
+		errors_->appendMsg(true, "TimeWindowIndexType requires the timestamp field name");
+	} else {
+		const RowType *rt = tabtype_->rowType();
+		fieldIdx_ = rt->findIdx(field_);
+		if (fieldIdx_ < 0) {
+			errors_.f("can not find the timestamp field '%s'", field_.c_str());
+		} else {
+			const RowType::Field &fld = rt->fields()[fieldIdx_];
+			if (fld.type_->getTypeId() != Type::TT_INT64 || fld.arsz_ != RowType::Field::AR_SCALAR) {
+				errors_.f("the timestamp field '%s' must be an int64 scalar", field_.c_str());
+				fieldIdx_ = -1;
+			}
+		}
+	}
+
+	rhOffset_ = tabtype_->rhType()->allocate(sizeof(RhSection));
+
+	if (!errors_->hasError() && errors_->isEmpty())
+		errors_ = NULL;
+}
+
+Index *TimeWindowIndexType::makeIndex(const TableType *tabtype, Table *table) const
+{
+	if (!isInitialized() 
+	|| errors_->hasError())
+		return NULL; 
+	return new TimeWindowIndex(tabtype, table, this);
+}
+
+void TimeWindowIndexType::initRowHandleSection(RowHandle *rh) const
+{
+	RhSection *rs = getSection(rh);
+	rs->prev_ = NULL;
+	rs->next_ = NULL;
+	rs->ts_ = tabtype_->rowType()->getInt64(rh->getRow(), fieldIdx_);
+}
+
+void TimeWindowIndexType::clearRowHandleSection(RowHandle *rh) const
+{ } // no dynamic references, nothing to clear
+
+void TimeWindowIndexType::copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const
+{
+	RhSection *rs = getSection(rh);
+	rs->prev_ = NULL;
+	rs->next_ = NULL;
+	rs->ts_ = getSection(fromrh)->ts_;
+}
+
+}; // TRICEPS_NS
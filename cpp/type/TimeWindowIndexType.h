@@ -0,0 +1,104 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An index that keeps the rows in the order of a timestamp, for the time windows.
+
+#ifndef __Triceps_TimeWindowIndexType_h__
+#define __Triceps_TimeWindowIndexType_h__
+
+#include <type/IndexType.h>
+
+namespace TRICEPS_NS {
+
+// The time window index keeps the rows ordered by an int64 timestamp
+// field, in the ascending order. Unlike the Ordered index, the timestamp
+// is not a key: any number of rows may have the same timestamp, and they
+// are kept in the order of their arrival. It's a leaf index, like
+// the FifoIndex, and in the same way the rows are found in it by the
+// comparison of the whole row.
+//
+// The rows are normally expected to arrive in the order of time, then
+// the insert is O(1). A row that arrives late gets sorted into place by
+// scanning back from the newest row.
+//
+// The old rows get expired in bulk by Table::expireBefore(). The null
+// timestamps are treated as 0.
+class TimeWindowIndexType : public IndexType
+{
+public:
+	// @param field - name of the timestamp field, must be an int64 scalar;
+	//        if not specified, must be set later, before initialization
+	TimeWindowIndexType(const string &field = "");
+	// Constructor duplicated as make() for syntactically better usage.
+	static TimeWindowIndexType *make(const string &field = "")
+	{
+		return new TimeWindowIndexType(field);
+	}
+
+	// Set the timestamp field later (only until initialized).
+	TimeWindowIndexType *setField(const string &field);
+
+	const string &getField() const
+	{
+		return field_;
+	}
+
+	// The index of the timestamp field in the row type, available
+	// after initialization.
+	int getFieldIdx() const
+	{
+		return fieldIdx_;
+	}
+
+	// from Type
+	virtual bool equals(const Type *t) const;
+	virtual void printTo(string &res, const string &indent = "", const string &subindent = "  ") const;
+
+	// from IndexType
+	virtual const NameSet *getKey() const;
+	virtual IndexType *copy(bool flat = false) const;
+	virtual IndexType *deepCopy(HoldRowTypes *holder) const;
+	virtual void initialize();
+	virtual Index *makeIndex(const TableType *tabtype, Table *table) const;
+	virtual void initRowHandleSection(RowHandle *rh) const;
+	virtual void clearRowHandleSection(RowHandle *rh) const;
+	virtual void copyRowHandleSection(RowHandle *rh, const RowHandle *fromrh) const;
+
+	// Get the timestamp of a row handle in a table of this type,
+	// as cached in the handle.
+	int64_t getTimestamp(const RowHandle *rh) const
+	{
+		return getSection(rh)->ts_;
+	}
+
+protected:
+	friend class TimeWindowIndex;
+
+	struct RhSection {
+		RowHandle *prev_; // previous in the list
+		RowHandle *next_; // next in the list
+		int64_t ts_; // timestamp of the row, cached
+	};
+
+	RhSection *getSection(const RowHandle *rh) const
+	{
+		return rh->get<RhSection>(rhOffset_);
+	}
+
+protected:
+	// used by copy()
+	TimeWindowIndexType(const TimeWindowIndexType &orig, bool flat);
+	// used by deepCopy()
+	TimeWindowIndexType(const TimeWindowIndexType &orig, HoldRowTypes *holder);
+
+	string field_; // name of the timestamp field
+	intptr_t rhOffset_; // offset of this index's data in table's row handle
+	int fieldIdx_; // index of the timestamp field in the row type
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_TimeWindowIndexType_h__
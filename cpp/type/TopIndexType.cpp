@@ -0,0 +1,109 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An ordered index that keeps only a limited number of the top rows.
+
+#include <type/TopIndexType.h>
+#include <type/TableType.h>
+#include <table/TopIndex.h>
+#include <table/Table.h>
+
+namespace TRICEPS_NS {
+
+TopIndexType::TopIndexType(NameSet *key, size_t limit) :
+	OrderedIndexType(IT_TOP, key),
+	limit_(limit)
+{ }
+
+TopIndexType::TopIndexType(const TopIndexType &orig, bool flat) :
+	OrderedIndexType(orig, flat),
+	limit_(orig.limit_)
+{ }
+
+TopIndexType::TopIndexType(const TopIndexType &orig, HoldRowTypes *holder) :
+	OrderedIndexType(orig, holder),
+	limit_(orig.limit_)
+{ }
+
+TopIndexType *TopIndexType::setLimit(size_t limit)
+{
+	if (initialized_) {
+		Autoref<TopIndexType> cleaner = this;
+		throw Exception::fTrace("Attempted to set the limit value on an initialized Top index type");
+	}
+	limit_ = limit;
+	return this;
+}
+
+bool TopIndexType::equals(const Type *t) const
+{
+	if (this == t)
+		return true; // self-comparison, shortcut
+
+	if (!OrderedIndexType::equals(t))
+		return false;
+
+	const TopIndexType *tit = static_cast<const TopIndexType *>(t);
+	return (limit_ == tit->limit_);
+}
+
+bool TopIndexType::match(const Type *t) const
+{
+	if (this == t)
+		return true; // self-comparison, shortcut
+
+	if (!OrderedIndexType::match(t))
+		return false;
+
+	const TopIndexType *tit = static_cast<const TopIndexType *>(t);
+	return (limit_ == tit->limit_);
+}
+
+void TopIndexType::printTo(string &res, const string &indent, const string &subindent) const
+{
+	res.append("index TopIndex(");
+	if (fullKey_) {
+		for (NameSet::iterator i = fullKey_->begin(); i != fullKey_->end(); ++i) {
+			res.append(*i);
+			res.append(", ");
+		}
+	}
+	res.append(strprintf("limit=%zd)", limit_));
+	printSubelementsTo(res, indent, subindent);
+}
+
+IndexType *TopIndexType::copy(bool flat) const
+{
+	return new TopIndexType(*this, flat);
+}
+
+IndexType *TopIndexType::deepCopy(HoldRowTypes *holder) const
+{
+	return new TopIndexType(*this, holder);
+}
+
+void TopIndexType::initialize()
+{
+	if (isInitialized())
+		return; // nothing to do
+
+	OrderedIndexType::initialize();
+
+	if (nested_.size() != 0)
+		errors_.f("TopIndexType currently does not support further nested indexes");
+	if (limit_ == 0)
+		errors_.f("TopIndexType requires a non-0 limit");
+}
+
+Index *TopIndexType::makeIndex(const TableType *tabtype, Table *table) const
+{
+	if (!isInitialized() 
+	|| errors_->hasError())
+		return NULL; 
+	return new TopIndex(tabtype, table, this, less_);
+}
+
+}; // TRICEPS_NS
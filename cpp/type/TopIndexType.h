@@ -0,0 +1,82 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// An ordered index that keeps only a limited number of the top rows.
+
+#ifndef __Triceps_TopIndexType_h__
+#define __Triceps_TopIndexType_h__
+
+#include <type/OrderedIndexType.h>
+
+namespace TRICEPS_NS {
+
+// The Top index works like the Ordered index but keeps no more than
+// a limited number of rows in each group: the first ones in the order of
+// its key. For example, with the key "!volume" and the limit 100 it keeps
+// the top 100 rows by volume. The key should be unique, same as for
+// the Ordered index: the new row with the same key replaces the old one.
+//
+// When a new row gets inserted into a full group, the last row in the order
+// gets pushed out, same as the FifoIndex with a limit pushes out the
+// oldest row. If the new row itself would be the last one, the insert fails.
+// The rows that get pushed out or rejected don't come back later, when
+// the rows at the top get deleted.
+//
+// Like with the FifoIndex, the rows already marked for replacement by the
+// preceding indexes are taken into account. So if the same row also has
+// a primary key, define the primary index before the Top index, and then
+// an update of a row in a full group will replace it correctly.
+//
+// This index is always a leaf, it can't have any nested indexes.
+class TopIndexType : public OrderedIndexType
+{
+public:
+	// Keeps a reference of key. If key is not specified, it
+	// must be set later, before initialization.
+	//
+	// The field names that are prefixed by "!" are used in the reverse order,
+	// the rest in the direct order.
+	// @param key - the key that defines the order
+	// @param limit - the maximal number of rows in a group, must be set
+	//        to non-0 before the initialization
+	TopIndexType(NameSet *key = NULL, size_t limit = 0);
+	// Constructors duplicated as make() for syntactically better usage.
+	static TopIndexType *make(NameSet *key = NULL, size_t limit = 0)
+	{
+		return new TopIndexType(key, limit);
+	}
+
+	// Set the limit later (only until initialized).
+	TopIndexType *setLimit(size_t limit);
+
+	size_t getLimit() const
+	{
+		return limit_;
+	}
+
+	// from Type
+	virtual bool equals(const Type *t) const;
+	virtual bool match(const Type *t) const;
+	virtual void printTo(string &res, const string &indent = "", const string &subindent = "  ") const;
+
+	// from IndexType
+	virtual IndexType *copy(bool flat = false) const;
+	virtual IndexType *deepCopy(HoldRowTypes *holder) const;
+	virtual void initialize();
+	virtual Index *makeIndex(const TableType *tabtype, Table *table) const;
+
+protected:
+	// used by copy()
+	TopIndexType(const TopIndexType &orig, bool flat);
+	// used by deepCopy()
+	TopIndexType(const TopIndexType &orig, HoldRowTypes *holder);
+
+	size_t limit_; // the maximal number of rows in a group
+};
+
+}; // TRICEPS_NS
+
+#endif // __Triceps_TopIndexType_h__
@@ -11,6 +11,13 @@
 
 namespace TRICEPS_NS {
 
+//////////////////////////// TreeIndexType  /////////////////////////
+
+bool TreeIndexType::isOrdered() const
+{
+	return true;
+}
+
 //////////////////////////// TreeIndexType::Less  /////////////////////////
 
 TreeIndexType::Less::~Less()
@@ -38,6 +38,9 @@ protected:
 	{ }
 
 public:
+	// from IndexType
+	virtual bool isOrdered() const;
+
 	// index instance interface: the part made public for the sorted indexes
 	
 	// Comparator base class for the row objects.
@@ -0,0 +1,31 @@
+
+#include <utest/Utest.h>
+
+int main(int ac, char **av)
+{
+	Utest driver(ac, av);
+
+
+	extern Utest::Testcase rowtype;
+	driver.addcase(rowtype, "rowtype");
+
+	extern Utest::Testcase mkrow;
+	driver.addcase(mkrow, "mkrow");
+
+	extern Utest::Testcase mkrow_irregular;
+	driver.addcase(mkrow_irregular, "mkrow_irregular");
+
+	extern Utest::Testcase mkrowover;
+	driver.addcase(mkrowover, "mkrowover");
+
+	extern Utest::Testcase equal;
+	driver.addcase(equal, "equal");
+
+	extern Utest::Testcase copy_compact;
+	driver.addcase(copy_compact, "copy_compact");
+
+	extern Utest::Testcase dump;
+	driver.addcase(dump, "dump");
+
+	return driver.run();
+}
@@ -0,0 +1,334 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+//
+// Test of an AlignedRow type.
+
+#include <utest/Utest.h>
+#include <string.h>
+
+#include <type/AllTypes.h>
+#include <common/StringUtil.h>
+
+// Make fields of all simple types, with the fixed fields mixed between
+// the variable ones
+void mkfields(RowType::FieldVec &fields)
+{
+	fields.clear();
+	fields.push_back(RowType::Field("a", Type::r_uint8, 10));
+	fields.push_back(RowType::Field("b", Type::r_int32));
+	fields.push_back(RowType::Field("c", Type::r_int64));
+	fields.push_back(RowType::Field("d", Type::r_float64));
+	fields.push_back(RowType::Field("e", Type::r_string));
+	fields.push_back(RowType::Field("f", Type::r_int32, 0));
+	fields.push_back(RowType::Field("g", Type::r_int32));
+}
+
+uint8_t v_uint8[10] = "123456789";
+int32_t v_int32 = 1234;
+int64_t v_int64 = 0xdeadbeefc00c;
+double v_float64 = 9.99e99;
+char v_string[] = "hello world";
+int32_t v_int32ar[3] = { 1, 2, 3 };
+int32_t v_int32g = 5678;
+
+void mkfdata(FdataVec &fd)
+{
+	fd.resize(7);
+	fd[0].setPtr(true, &v_uint8, sizeof(v_uint8));
+	fd[1].setPtr(true, &v_int32, sizeof(v_int32));
+	fd[2].setPtr(true, &v_int64, sizeof(v_int64));
+	fd[3].setPtr(true, &v_float64, sizeof(v_float64));
+	fd[4].setPtr(true, &v_string, sizeof(v_string));
+	fd[5].setPtr(true, &v_int32ar, sizeof(v_int32ar));
+	fd[6].setPtr(true, &v_int32g, sizeof(v_int32g));
+}
+
+// check that all the fields in the row match the data
+// @return - true on failure
+bool checkfields(Utest *utest, RowType *rt, const Row *r, const FdataVec &dv)
+{
+	const char *ptr;
+	intptr_t len;
+	for (int i = 0; i < rt->fieldCount(); i++) {
+		bool notNull = rt->getField(r, i, ptr, len);
+		if (dv[i].notNull_) {
+			if ( UT_ASSERT(notNull)
+			|| UT_IS(len, dv[i].len_)
+			|| UT_ASSERT(dv[i].data_ == NULL || !memcmp(dv[i].data_, ptr, len)) ) {
+				printf("failed at field %d\n", i);
+				fflush(stdout);
+				return true;
+			}
+		} else {
+			if ( UT_ASSERT(!notNull)
+			|| UT_IS(len, 0)
+			|| UT_ASSERT(rt->isFieldNull(r, i)) ) {
+				printf("failed at null field %d\n", i);
+				fflush(stdout);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+UTESTCASE rowtype(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<AlignedRowType> rt1 = new AlignedRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<RowType> rt2 = new AlignedRowType(rt1);
+	UT_ASSERT(rt2->getErrors().isNull());
+	UT_ASSERT(rt1->equals(rt2));
+	UT_ASSERT(rt1->match(rt2));
+
+	Autoref<RowType> rt1cp = rt1->copy();
+	UT_ASSERT(rt1->equals(rt1cp));
+	UT_ASSERT(rt1->match(rt1cp));
+
+	// the different formats don't match
+	Autoref<RowType> rtc = new CompactRowType(fld);
+	UT_ASSERT(!rt1->equals(rtc));
+	UT_ASSERT(!rtc->equals(rt1));
+	UT_ASSERT(!rt1->match(rtc));
+	UT_ASSERT(!rtc->match(rt1));
+
+	UT_ASSERT(!rt1->isFieldFixed(0));
+	UT_ASSERT(rt1->isFieldFixed(1));
+	UT_ASSERT(rt1->isFieldFixed(2));
+	UT_ASSERT(rt1->isFieldFixed(3));
+	UT_ASSERT(!rt1->isFieldFixed(4));
+	UT_ASSERT(!rt1->isFieldFixed(5));
+	UT_ASSERT(rt1->isFieldFixed(6));
+}
+
+UTESTCASE mkrow(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new AlignedRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	FdataVec dv;
+	mkfdata(dv);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+	if (checkfields(utest, rt1, r1, dv)) return;
+
+	// the fixed fields are aligned
+	const char *ptr;
+	intptr_t len;
+	for (int i = 1; i <= 3; i++) {
+		rt1->getField(r1, i, ptr, len);
+		UT_IS(((intptr_t)ptr) % len, 0);
+	}
+
+	UT_IS(rt1->getUint8(r1, 0, 1), '2');
+	UT_IS(rt1->getInt32(r1, 1), 1234);
+	UT_IS(rt1->getInt32(r1, 1, 1), 0); // null
+	UT_IS(rt1->getInt64(r1, 2), 0xdeadbeefc00c);
+	UT_IS(rt1->getFloat64(r1, 3), 9.99e99);
+	UT_IS(string(rt1->getString(r1, 4)), "hello world");
+	UT_IS(rt1->getInt32(r1, 5, 2), 3);
+	UT_IS(rt1->getInt32(r1, 6), 5678);
+
+	// try to put a NULL in each of the fields
+	for (int j = 0; j < rt1->fieldCount(); j++) {
+		mkfdata(dv);
+		dv[j].notNull_ = false;
+		r1.assign(rt1, rt1->makeRow(dv));
+		if (checkfields(utest, rt1, r1, dv)) {
+			printf("null in %d\n", j);
+			return;
+		}
+	}
+
+	// put NULL in all the fields
+	mkfdata(dv);
+	for (int i = 0; i < rt1->fieldCount(); i++) {
+		dv[i].notNull_ = false;
+	}
+	r1.assign(rt1, rt1->makeRow(dv));
+	if (checkfields(utest, rt1, r1, dv)) return;
+	UT_ASSERT(rt1->isRowEmpty(r1));
+	UT_IS(rt1->getInt64(r1, 2), 0);
+
+	// the auto-filling with NULLs
+	mkfdata(dv);
+	dv.resize(2);
+	r1.assign(rt1, rt1->makeRow(dv));
+	UT_ASSERT(!rt1->isRowEmpty(r1));
+	UT_ASSERT(!rt1->isFieldNull(r1, 1));
+	for (int i = 2; i < rt1->fieldCount(); i++)
+		UT_ASSERT(rt1->isFieldNull(r1, i));
+}
+
+UTESTCASE mkrow_irregular(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new AlignedRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	// the scalar fields with the wrong size still get stored as they are
+	FdataVec dv;
+	mkfdata(dv);
+	dv[1].setPtr(true, &v_int32ar, sizeof(v_int32ar));
+	dv[3].setPtr(true, &v_int32, 2);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+	UT_ASSERT(static_cast<const AlignedRow *>(r1.get())->isIrregular());
+	if (checkfields(utest, rt1, r1, dv)) return;
+	UT_IS(rt1->getInt32(r1, 1, 2), 3);
+	UT_IS(rt1->getFloat64(r1, 3), 0); // too short
+
+	// the round-trip through a compact row keeps everything
+	Autoref<RowType> rtc = new CompactRowType(fld);
+	Rowref rc(rtc, rtc->copyRow(rt1, r1));
+	Rowref r2(rt1, rt1->copyRow(rtc, rc));
+	UT_ASSERT(rt1->equalRows(r1, r2));
+
+	dv[1].notNull_ = false;
+	dv[3].notNull_ = false;
+	r1.assign(rt1, rt1->makeRow(dv));
+	UT_ASSERT(!static_cast<const AlignedRow *>(r1.get())->isIrregular());
+	if (checkfields(utest, rt1, r1, dv)) return;
+}
+
+UTESTCASE mkrowover(Utest *utest)
+{
+	// test the override fields
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new AlignedRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	FdataVec dv;
+	mkfdata(dv);
+
+	dv[0].data_ = 0; // test the zeroing
+	dv[2].data_ = 0;
+
+	dv.push_back(Fdata(0, 0, "aa", 2));
+	dv.push_back(Fdata(0, 8, "bb", 2));
+	dv.push_back(Fdata(1, -1, "bb", 2));
+	dv.push_back(Fdata(2, 4, "cc", 2));
+	dv.push_back(Fdata(3, 0, "01234567890123456789", 20));
+	dv.push_back(Fdata(6, 0, "dd", 2));
+
+	Rowref r1(rt1, dv);
+
+	const char *ptr;
+	intptr_t len;
+
+	if ( UT_ASSERT(rt1->getField(r1, 0, ptr, len))
+	|| UT_IS(len, dv[0].len_)
+	|| UT_ASSERT(!memcmp("aa\0\0\0\0\0\0bb", ptr, len)) )
+		return;
+	if ( UT_ASSERT(rt1->getField(r1, 2, ptr, len))
+	|| UT_IS(len, 8)
+	|| UT_ASSERT(!memcmp("\0\0\0\0cc\0\0", ptr, len)) )
+		return;
+	if ( UT_ASSERT(rt1->getField(r1, 6, ptr, len))
+	|| UT_IS(len, 4)
+	|| UT_ASSERT(!memcmp("dd", ptr, 2)) )
+		return;
+
+	// the rest of fields should be unchanged
+	for (int i = 1; i < rt1->fieldCount(); i++) {
+		if (i == 2 || i == 6)
+			continue;
+		if ( UT_ASSERT(rt1->getField(r1, i, ptr, len))
+		|| UT_IS(len, dv[i].len_)
+		|| UT_ASSERT(!memcmp(dv[i].data_, ptr, len)) ) {
+			printf("failed at field %d\n", i);
+			fflush(stdout);
+			return;
+		}
+	}
+}
+
+UTESTCASE equal(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rt1 = new AlignedRowType(fld);
+	if (UT_ASSERT(rt1->getErrors().isNull())) return;
+
+	FdataVec dv;
+	mkfdata(dv);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+	Rowref r2(rt1,  rt1->makeRow(dv));
+
+	dv[0].notNull_ = false;
+	Rowref r3(rt1,  rt1->makeRow(dv));
+
+	dv[1].data_ = NULL;
+	Rowref r4(rt1,  rt1->makeRow(dv));
+
+	// a null fixed field is not the same as a zero one
+	dv[1].notNull_ = false;
+	Rowref r5(rt1,  rt1->makeRow(dv));
+
+	UT_ASSERT(rt1->equalRows(r1, r1));
+	UT_ASSERT(rt1->equalRows(r1, r2));
+	UT_ASSERT(!rt1->equalRows(r1, r3));
+	UT_ASSERT(!rt1->equalRows(r3, r4));
+	UT_ASSERT(!rt1->equalRows(r4, r5));
+}
+
+UTESTCASE copy_compact(Utest *utest)
+{
+	RowType::FieldVec fld;
+	mkfields(fld);
+
+	Autoref<RowType> rta = new AlignedRowType(fld);
+	Autoref<RowType> rtc = new CompactRowType(fld);
+
+	FdataVec dv;
+	for (int j = -1; j < rta->fieldCount(); j++) {
+		mkfdata(dv);
+		if (j >= 0)
+			dv[j].notNull_ = false;
+		Rowref ra(rta,  rta->makeRow(dv));
+		Rowref rc(rtc,  rtc->makeRow(dv));
+
+		Rowref ra2(rta,  rta->copyRow(rtc, rc));
+		if (checkfields(utest, rta, ra2, dv)) return;
+		UT_ASSERT(rta->equalRows(ra, ra2));
+
+		Rowref rc2(rtc,  rtc->copyRow(rta, ra));
+		if (checkfields(utest, rtc, rc2, dv)) return;
+		UT_ASSERT(rtc->equalRows(rc, rc2));
+	}
+}
+
+UTESTCASE dump(Utest *utest)
+{
+	RowType::FieldVec fld;
+	fld.push_back(RowType::Field("a", Type::r_int32));
+	fld.push_back(RowType::Field("b", Type::r_string));
+
+	Autoref<RowType> rt1 = new AlignedRowType(fld);
+	FdataVec dv(2);
+	int32_t v = 0x01020304;
+	dv[0].setPtr(true, &v, sizeof(v));
+	dv[1].setPtr(true, "x", 1);
+	Rowref r1(rt1,  rt1->makeRow(dv));
+
+	string res;
+	rt1->hexdumpRow(res, r1);
+	// length 0x15, no nulls, padding, field a, offsets table 0x14 and 0x15, data
+	// (the values are little-endian)
+	UT_IS(res,
+		"00000000   15 00 00 00 00 00 00 00  04 03 02 01 14 00 00 00  ................\n"
+		"00000010   15 00 00 00 78                                    ....x\n");
+}
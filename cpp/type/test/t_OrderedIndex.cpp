@@ -868,3 +868,199 @@ UTESTCASE orderedIndexArray(Utest *utest)
 
 }
 
+
+// Print the key-relevant fields of a row, for comparing the order.
+static string printScalarRow(const RowType *rt, const Row *row)
+{
+	string res;
+	if (rt->isFieldNull(row, 1))
+		res.append("-");
+	else
+		res.append(strprintf("%d", (int)rt->getInt32(row, 1, 0)));
+	res.append(",");
+	if (rt->isFieldNull(row, 2))
+		res.append("-");
+	else
+		res.append(strprintf("%lld", (long long)rt->getInt64(row, 2, 0)));
+	res.append(",");
+	if (rt->isFieldNull(row, 3))
+		res.append("-");
+	else
+		res.append(strprintf("%g", rt->getFloat64(row, 3, 0)));
+	res.append(",");
+	if (rt->isFieldNull(row, 4))
+		res.append("-");
+	else
+		res.append(rt->getString(row, 4));
+	res.append(" ");
+	return res;
+}
+
+// Insert the same rows into two tables with the same key, one with the
+// CompactRowType and one with the AlignedRowType, and check that the
+// resulting order is the same.
+// @param key - the key for the index
+// @param normLen - length of the normalized key for the CompactRowType table
+// @param longStrings - flag: use the long strings in the field "e"
+static void checkSameOrder(Utest *utest, NameSet *key, int normLen, bool longStrings)
+{
+	RowType::FieldVec fld;
+	mkfieldsScalar(fld);
+
+	Autoref<RowType> rtc = new CompactRowType(fld);
+	UT_ASSERT(rtc->getErrors().isNull());
+	Autoref<RowType> rta = new AlignedRowType(fld);
+	UT_ASSERT(rta->getErrors().isNull());
+
+	Autoref<Unit> unit = new Unit("u");
+
+	Autoref<TableType> ttc = TableType::make(rtc)
+		->addSubIndex("primary", OrderedIndexType::make(key)->setNormalizedKey(normLen));
+	ttc->initialize();
+	UT_ASSERT(ttc->getErrors().isNull());
+	Autoref<TableType> tta = TableType::make(rta)
+		->addSubIndex("primary", OrderedIndexType::make(key));
+	tta->initialize();
+	UT_ASSERT(tta->getErrors().isNull());
+
+	Autoref<Table> tc = ttc->makeTable(unit, "tc");
+	Autoref<Table> ta = tta->makeTable(unit, "ta");
+
+	for (int i = 0; i < 40; i++) {
+		FdataVec dv;
+		mkfdataScalar(dv);
+
+		uint8_t va = (uint8_t)(i % 3);
+		int32_t vb = (i * 7) % 5 - 2;
+		int64_t vc = (i * 13) % 9 - 4;
+		double vd = ((i * 5) % 6) * 0.5 - 1.;
+		if (i % 10 == 1)
+			vd = -0.; // must be equal to 0.
+		string ve = strprintf("s%d", (i * 3) % 8);
+		if (longStrings && i % 3 == 0)
+			ve.append(i % 2, 'x').append("-a-long-string-that-does-not-fit");
+
+		dv[0].data_ = (char *)&va;
+		dv[1].data_ = (char *)&vb;
+		dv[2].data_ = (char *)&vc;
+		dv[3].data_ = (char *)&vd;
+		dv[4].setPtr(true, ve.c_str(), ve.size() + 1);
+		if (i % 11 == 0)
+			dv[1].setNull();
+		if (i % 7 == 3)
+			dv[2].setNull();
+		if (i % 8 == 5)
+			dv[3].setNull();
+		if (i % 9 == 4)
+			dv[4].setNull();
+
+		Rowref rc(rtc, dv);
+		tc->insertRow(rc);
+		Rowref ra(rta, dv);
+		ta->insertRow(ra);
+	}
+
+	string resc, resa;
+	for (RowHandle *iter = tc->begin(); iter != NULL; iter = tc->next(iter)) {
+		resc.append(printScalarRow(rtc, iter->getRow()));
+		// the search by a new handle finds the same row
+		Rhref rh(tc, tc->makeRowHandle(iter->getRow()));
+		UT_IS(tc->find(rh), iter);
+	}
+	for (RowHandle *iter = ta->begin(); iter != NULL; iter = ta->next(iter))
+		resa.append(printScalarRow(rta, iter->getRow()));
+
+	UT_ASSERT(tc->size() > 1);
+	UT_IS(tc->size(), ta->size());
+	if (UT_IS(resc, resa)) {
+		printf("key %s, normalized %d\n", key->at(0).c_str(), normLen);
+		fflush(stdout);
+	}
+}
+
+// The keys used for checking the order.
+static const char *orderKeys[][2] = {
+	{ "b", NULL },
+	{ "!b", NULL },
+	{ "c", NULL },
+	{ "!c", NULL },
+	{ "d", NULL },
+	{ "!d", NULL },
+	{ "e", NULL },
+	{ "!e", NULL },
+	{ "b", "!c" },
+	{ "!b", "e" },
+	{ "e", "d" },
+	{ "!d", "!b" },
+	{ "c", "!e" },
+	{ "a", "b" }, // uint8 is not specialized, for the comparison
+	{ "!e", "!a" },
+};
+
+// The keys of 1 and 2 scalar fields with the CompactRowType get the specialized
+// comparators, so check that they produce the same order as the generic one
+// that gets used with the AlignedRowType.
+UTESTCASE orderedSpecialized(Utest *utest)
+{
+	for (size_t k = 0; k < sizeof(orderKeys) / sizeof(orderKeys[0]); k++) {
+		Autoref<NameSet> key = NameSet::make()->add(orderKeys[k][0]);
+		if (orderKeys[k][1] != NULL)
+			key->add(orderKeys[k][1]);
+		checkSameOrder(utest, key, 0, false);
+	}
+}
+
+// The normalized keys must produce the same order as the field comparison,
+// both when they fit and when they don't.
+UTESTCASE orderedNormalized(Utest *utest)
+{
+	for (size_t k = 0; k < sizeof(orderKeys) / sizeof(orderKeys[0]); k++) {
+		Autoref<NameSet> key = NameSet::make()->add(orderKeys[k][0]);
+		if (orderKeys[k][1] != NULL)
+			key->add(orderKeys[k][1]);
+		checkSameOrder(utest, key, 64, false);
+		// some long strings won't fit
+		checkSameOrder(utest, key, 24, true);
+		// everything goes through the fallback
+		checkSameOrder(utest, key, 1, true);
+	}
+	// a key with more fields than specialized
+	Autoref<NameSet> key3 = NameSet::make()->add("!c")->add("e")->add("d");
+	checkSameOrder(utest, key3, 64, true);
+
+	// the unsupported fields
+	RowType::FieldVec fld;
+	mkfields(fld);
+	Autoref<RowType> rt1 = new CompactRowType(fld);
+	UT_ASSERT(rt1->getErrors().isNull());
+
+	Autoref<TableType> tt = TableType::make(rt1)
+		->addSubIndex("primary", OrderedIndexType::make(
+			NameSet::make()->add("a")->add("b")->add("c")
+		)->setNormalizedKey(64));
+	tt->initialize();
+	UT_ASSERT(!tt->getErrors().isNull());
+	UT_IS(tt->getErrors()->print(),
+		"index error:\n"
+		"  nested index 1 'primary':\n"
+		"    the normalized key does not support the field 'a' of type 'uint8[]'\n"
+		"    the normalized key does not support the field 'b' of type 'int32[]'\n");
+
+	// the setting is copied
+	Autoref<OrderedIndexType> it = OrderedIndexType::make(NameSet::make()->add("c"))->setNormalizedKey(16);
+	UT_IS(it->getNormalizedKey(), 16);
+	Autoref<OrderedIndexType> itcopy = static_cast<OrderedIndexType *>(it->copy());
+	UT_IS(itcopy->getNormalizedKey(), 16);
+
+	Exception::abort_ = false; // make them catchable
+	Exception::enableBacktrace_ = false; // make the error messages predictable
+	{
+		string msg;
+		try {
+			it->setNormalizedKey(-1);
+		} catch (Exception e) {
+			msg = e.getErrors()->print();
+		}
+		UT_IS(msg, "The normalized key length must not be negative, got -1\n");
+	}
+}
@@ -30,6 +30,8 @@ WrapMagic magicWrapAutoFnBind = { "AuFnBnd" };
 WrapMagic magicWrapTable = { "Table" };
 WrapMagic magicWrapIndex = { "Index" };
 WrapMagic magicWrapRowHandle = { "RowHand" };
+WrapMagic magicWrapLookupJoin = { "LkpJoin" };
+WrapMagic magicWrapJoinTwo = { "JoinTwo" };
 
 WrapMagic magicWrapApp = { "App" };
 WrapMagic magicWrapTrieadOwner = { "TrOwner" };
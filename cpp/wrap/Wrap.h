@@ -13,6 +13,8 @@
 #include <sched/Unit.h>
 #include <sched/FnReturn.h>
 #include <table/Table.h>
+#include <table/LookupJoin.h>
+#include <table/JoinTwo.h>
 #include <mem/Rhref.h>
 #include <app/App.h>
 #include <app/AutoDrain.h>
@@ -204,6 +206,8 @@ DEFINE_WRAP(AutoFnBind);
 DEFINE_WRAP(Table);
 DEFINE_WRAP(Index);
 DEFINE_WRAP2(Table, Rhref, RowHandle);
+DEFINE_WRAP(LookupJoin);
+DEFINE_WRAP(JoinTwo);
 
 DEFINE_WRAP(App);
 DEFINE_WRAP(Triead);
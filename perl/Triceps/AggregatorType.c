@@ -0,0 +1,623 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of AggregatorType.xs. Do not edit this file, edit AggregatorType.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "AggregatorType.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for AggregatorType.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+#include "PerlCallback.h"
+#include "PerlAggregator.h"
+#include <type/SimpleAggregatorType.h>
+
+#line 29 "AggregatorType.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 173 "AggregatorType.c"
+
+XS_EUPXS(XS_Triceps__AggregatorType_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 25 "AggregatorType.xs"
+		RETVAL = 1;
+#line 186 "AggregatorType.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapAggregatorType *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::DESTROY(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::DESTROY(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 32 "AggregatorType.xs"
+		// warn("AggregatorType destroyed!");
+		delete self;
+#line 215 "AggregatorType.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_new)
+{
+    dVAR; dXSARGS;
+    if (items < 5)
+       croak_xs_usage(cv,  "CLASS, wrt, name, constructor, handler, ...");
+    {
+	WrapAggregatorType *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+	WrapRowType *	wrt;
+	char *	name = (char *)SvPV_nolen(ST(2))
+;
+	SV *	constructor = ST(3)
+;
+	SV *	handler = ST(4)
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		wrt = (WrapRowType *)SvIV((SV*)SvRV( ST(1) ));
+		if (wrt == 0 || wrt->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::new(): wrt has an incorrect magic for WrapRowTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::new(): wrt is not a blessed SV reference to WrapRowTypePtr" );
+	}
+;
+#line 47 "AggregatorType.xs"
+		static char funcName[] =  "Triceps::AggregatorType::new";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			RowType *rt = wrt->get();
+
+			Onceref<PerlCallback> cbconst; // defaults to NULL
+			if (SvOK(constructor)) {
+				cbconst = new PerlCallback(true);
+				PerlCallbackInitializeSplit(cbconst, "Triceps::AggregatorType::new(constructor)", constructor, 5, items-5); // may throw
+			}
+
+			Onceref<PerlCallback> cbhand = new PerlCallback(true);
+			PerlCallbackInitialize(cbhand, "Triceps::AggregatorType::new(handler)", 4, items-4); // may throw
+
+			RETVAL = new WrapAggregatorType(new PerlAggregatorType(name, rt, NULL, cbconst, cbhand));
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 268 "AggregatorType.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_newSimple); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_newSimple)
+{
+    dVAR; dXSARGS;
+    if (items < 3)
+       croak_xs_usage(cv,  "CLASS, wrt, name, ...");
+    {
+	WrapAggregatorType *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+	WrapRowType *	wrt;
+	char *	name = (char *)SvPV_nolen(ST(2))
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		wrt = (WrapRowType *)SvIV((SV*)SvRV( ST(1) ));
+		if (wrt == 0 || wrt->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::newSimple(): wrt has an incorrect magic for WrapRowTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::newSimple(): wrt is not a blessed SV reference to WrapRowTypePtr" );
+	}
+;
+#line 79 "AggregatorType.xs"
+		static char funcName[] =  "Triceps::AggregatorType::newSimple";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			if ((items - 3) % 3 != 0)
+				throw Exception::f("Usage: %s(CLASS, rowType, name, [resField, function, argField] ...), the field definitions must go in groups of 3", funcName);
+
+			Autoref<SimpleAggregatorType> agg = new SimpleAggregatorType(name, wrt->get());
+			for (int i = 3; i < items; i += 3) {
+				string resfld, fname, argfld;
+				GetSvString(resfld, ST(i), "%s: result field name", funcName);
+				GetSvString(fname, ST(i+1), "%s: function name for field '%s'", funcName, resfld.c_str());
+				int func = SimpleAggregatorType::stringFunction(fname.c_str());
+				if (func < 0)
+					throw Exception::f("%s: unknown function '%s' for field '%s'", funcName, fname.c_str(), resfld.c_str());
+				if (SvOK(ST(i+2)))
+					GetSvString(argfld, ST(i+2), "%s: argument field name for field '%s'", funcName, resfld.c_str());
+				agg->addField(resfld, (SimpleAggregatorType::Function)func, argfld);
+			}
+			RETVAL = new WrapAggregatorType(agg);
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 327 "AggregatorType.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_copy); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_copy)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapAggregatorType *	RETVAL;
+	WrapAggregatorType *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::copy(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::copy(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 163 "AggregatorType.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::AggregatorType";
+
+		clearErrMsg();
+		AggregatorType *agt = self->get();
+		RETVAL = new WrapAggregatorType(agt->copy());
+#line 365 "AggregatorType.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapAggregatorType *	self;
+	WrapAggregatorType *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::same(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::same(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::same(): other has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::same(): other is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 175 "AggregatorType.xs"
+		clearErrMsg();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
+		RETVAL = (agself == agother);
+#line 413 "AggregatorType.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_getRowType); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_getRowType)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRowType *	RETVAL;
+	WrapAggregatorType *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::getRowType(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::getRowType(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 186 "AggregatorType.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::RowType";
+
+		clearErrMsg();
+		AggregatorType *agself = self->get();
+		RETVAL = new WrapRowType(const_cast<RowType *>(agself->getRowType()));
+#line 447 "AggregatorType.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_print); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_print)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "self, ...");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	RETVAL;
+	WrapAggregatorType *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::print(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::print(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 201 "AggregatorType.xs"
+		GEN_PRINT_METHOD(AggregatorType)
+#line 482 "AggregatorType.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_equals); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_equals)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapAggregatorType *	self;
+	WrapAggregatorType *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::equals(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::equals(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::equals(): other has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::equals(): other is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 207 "AggregatorType.xs"
+		clearErrMsg();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
+		RETVAL = agself->equals(agother);
+#line 525 "AggregatorType.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__AggregatorType_match); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__AggregatorType_match)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapAggregatorType *	self;
+	WrapAggregatorType *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::match(): self has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::match(): self is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapAggregatorType *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::AggregatorType::match(): other has an incorrect magic for WrapAggregatorTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::AggregatorType::match(): other is not a blessed SV reference to WrapAggregatorTypePtr" );
+	}
+;
+#line 217 "AggregatorType.xs"
+		clearErrMsg();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
+		RETVAL = agself->match(agother);
+#line 569 "AggregatorType.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__AggregatorType); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__AggregatorType)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::AggregatorType::CLONE_SKIP", XS_Triceps__AggregatorType_CLONE_SKIP);
+        newXS_deffile("Triceps::AggregatorType::DESTROY", XS_Triceps__AggregatorType_DESTROY);
+        newXS_deffile("Triceps::AggregatorType::new", XS_Triceps__AggregatorType_new);
+        newXS_deffile("Triceps::AggregatorType::newSimple", XS_Triceps__AggregatorType_newSimple);
+        newXS_deffile("Triceps::AggregatorType::copy", XS_Triceps__AggregatorType_copy);
+        newXS_deffile("Triceps::AggregatorType::same", XS_Triceps__AggregatorType_same);
+        newXS_deffile("Triceps::AggregatorType::getRowType", XS_Triceps__AggregatorType_getRowType);
+        newXS_deffile("Triceps::AggregatorType::print", XS_Triceps__AggregatorType_print);
+        newXS_deffile("Triceps::AggregatorType::equals", XS_Triceps__AggregatorType_equals);
+        newXS_deffile("Triceps::AggregatorType::match", XS_Triceps__AggregatorType_match);
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
@@ -14,6 +14,7 @@
 #include "TricepsPerl.h"
 #include "PerlCallback.h"
 #include "PerlAggregator.h"
+#include <type/SimpleAggregatorType.h>
 
 MODULE = Triceps::AggregatorType		PACKAGE = Triceps::AggregatorType
 ###################################################################################
@@ -65,6 +66,42 @@ new(char *CLASS, WrapRowType *wrt, char *name, SV *constructor, SV *handler, ...
 	OUTPUT:
 		RETVAL
 
+#// The constructor of the native C++ SimpleAggregatorType that computes
+#// the SQL-like functions without calling any Perl code.
+#// @param CLASS - name of type being constructed
+#// @param wrt - row type of the aggregation result
+#// @param name - name that will be used to create the aggregator gadget in the table
+#// @param ... - repeating groups of 3: result field name, function name,
+#//        argument field name (must be undef for "count_star")
+WrapAggregatorType *
+newSimple(char *CLASS, WrapRowType *wrt, char *name, ...)
+	CODE:
+		static char funcName[] =  "Triceps::AggregatorType::newSimple";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			if ((items - 3) % 3 != 0)
+				throw Exception::f("Usage: %s(CLASS, rowType, name, [resField, function, argField] ...), the field definitions must go in groups of 3", funcName);
+
+			Autoref<SimpleAggregatorType> agg = new SimpleAggregatorType(name, wrt->get());
+			for (int i = 3; i < items; i += 3) {
+				string resfld, fname, argfld;
+				GetSvString(resfld, ST(i), "%s: result field name", funcName);
+				GetSvString(fname, ST(i+1), "%s: function name for field '%s'", funcName, resfld.c_str());
+				int func = SimpleAggregatorType::stringFunction(fname.c_str());
+				if (func < 0)
+					throw Exception::f("%s: unknown function '%s' for field '%s'", funcName, fname.c_str(), resfld.c_str());
+				if (SvOK(ST(i+2)))
+					GetSvString(argfld, ST(i+2), "%s: argument field name for field '%s'", funcName, resfld.c_str());
+				agg->addField(resfld, (SimpleAggregatorType::Function)func, argfld);
+			}
+			RETVAL = new WrapAggregatorType(agg);
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
 #// The new-style constructor, with option-style arguments
 #// Confesses on errors.
 #//
@@ -127,8 +164,8 @@ copy(WrapAggregatorType *self)
 		static char CLASS[] = "Triceps::AggregatorType";
 
 		clearErrMsg();
-		PerlAggregatorType *agt = self->get();
-		RETVAL = new WrapAggregatorType(static_cast<PerlAggregatorType *>( agt->copy() ));
+		AggregatorType *agt = self->get();
+		RETVAL = new WrapAggregatorType(agt->copy());
 	OUTPUT:
 		RETVAL
 
@@ -136,8 +173,8 @@ int
 same(WrapAggregatorType *self, WrapAggregatorType *other)
 	CODE:
 		clearErrMsg();
-		PerlAggregatorType *agself = self->get();
-		PerlAggregatorType *agother = other->get();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
 		RETVAL = (agself == agother);
 	OUTPUT:
 		RETVAL
@@ -150,7 +187,7 @@ getRowType(WrapAggregatorType *self)
 		static char CLASS[] = "Triceps::RowType";
 
 		clearErrMsg();
-		PerlAggregatorType *agself = self->get();
+		AggregatorType *agself = self->get();
 		RETVAL = new WrapRowType(const_cast<RowType *>(agself->getRowType()));
 	OUTPUT:
 		RETVAL
@@ -161,15 +198,15 @@ getRowType(WrapAggregatorType *self)
 SV *
 print(WrapAggregatorType *self, ...)
 	PPCODE:
-		GEN_PRINT_METHOD(PerlAggregatorType)
+		GEN_PRINT_METHOD(AggregatorType)
 
 #// type comparisons
 int
 equals(WrapAggregatorType *self, WrapAggregatorType *other)
 	CODE:
 		clearErrMsg();
-		PerlAggregatorType *agself = self->get();
-		PerlAggregatorType *agother = other->get();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
 		RETVAL = agself->equals(agother);
 	OUTPUT:
 		RETVAL
@@ -178,8 +215,8 @@ int
 match(WrapAggregatorType *self, WrapAggregatorType *other)
 	CODE:
 		clearErrMsg();
-		PerlAggregatorType *agself = self->get();
-		PerlAggregatorType *agother = other->get();
+		AggregatorType *agself = self->get();
+		AggregatorType *agother = other->get();
 		RETVAL = agself->match(agother);
 	OUTPUT:
 		RETVAL
@@ -76,6 +76,22 @@ isReverse(WrapFacet *self)
 	OUTPUT:
 		RETVAL
 
+int
+isUnicast(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->isUnicast();
+	OUTPUT:
+		RETVAL
+
+int
+isPartitioned(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->isPartitioned();
+	OUTPUT:
+		RETVAL
+
 int
 queueLimit(WrapFacet *self)
 	CODE:
@@ -84,6 +100,14 @@ queueLimit(WrapFacet *self)
 	OUTPUT:
 		RETVAL
 
+int
+queueRing(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->queueRing();
+	OUTPUT:
+		RETVAL
+
 #// the constant
 int
 DEFAULT_QUEUE_LIMIT()
@@ -220,6 +244,47 @@ impTableType(WrapFacet *self, char *name)
 	OUTPUT:
 		RETVAL
 
+#// set the coalescing of the transactions in a writer facet
+void
+setCoalesce(WrapFacet *self, int maxTrans, int maxOps = 0, IV maxDelayUs = 0)
+	CODE:
+		clearErrMsg();
+		try { do {
+			self->get()->setCoalesce(maxTrans, maxOps, maxDelayUs);
+		} while(0); } TRICEPS_CATCH_CROAK;
+
+int
+isCoalescing(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->isCoalescing();
+	OUTPUT:
+		RETVAL
+
+int
+coalesceTrans(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->coalesceTrans();
+	OUTPUT:
+		RETVAL
+
+int
+coalesceOps(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->coalesceOps();
+	OUTPUT:
+		RETVAL
+
+IV
+coalesceDelayUs(WrapFacet *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->coalesceDelayUs();
+	OUTPUT:
+		RETVAL
+
 int
 flushWriter(WrapFacet *self)
 	CODE:
@@ -79,6 +79,7 @@ newOrdered(char *CLASS, ...)
 		try { do {
 			clearErrMsg();
 			Autoref<NameSet> key;
+			IV normalizedKey = 0;
 
 			if (items % 2 != 1) {
 				throw Exception::f("Usage: %s(CLASS, optionName, optionValue, ...), option names and values must go in pairs", funcName);
@@ -91,6 +92,8 @@ newOrdered(char *CLASS, ...)
 						throw Exception::f("%s: option 'key' can not be used twice", funcName);
 					}
 					key = parseNameSet(funcName, "key", val); // may throw
+				} else if (!strcmp(opt, "normalizedKey")) {
+					normalizedKey = SvIV(val);
 				} else {
 					throw Exception::f("%s: unknown option '%s'", funcName, opt);
 				}
@@ -99,8 +102,86 @@ newOrdered(char *CLASS, ...)
 			if (key.isNull()) {
 				throw Exception::f("%s: the required option 'key' is missing", funcName);
 			}
+			if (normalizedKey < 0) {
+				throw Exception::f("%s: the option 'normalizedKey' must not be negative, got %ld", funcName, (long)normalizedKey);
+			}
+
+			RETVAL = new WrapIndexType((new OrderedIndexType(key))->setNormalizedKey((int)normalizedKey));
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+#// create a TopIndex
+#// options go in pairs  name => value 
+WrapIndexType *
+newTop(char *CLASS, ...)
+	CODE:
+		static char funcName[] =  "Triceps::IndexType::newTop";
+		RETVAL = NULL; // shut up the warning
+		try { do {
+			clearErrMsg();
+			Autoref<NameSet> key;
+			IV limit = 0;
+
+			if (items % 2 != 1) {
+				throw Exception::f("Usage: %s(CLASS, optionName, optionValue, ...), option names and values must go in pairs", funcName);
+			}
+			for (int i = 1; i < items; i += 2) {
+				const char *opt = (const char *)SvPV_nolen(ST(i));
+				SV *val = ST(i+1);
+				if (!strcmp(opt, "key")) {
+					if (!key.isNull()) {
+						throw Exception::f("%s: option 'key' can not be used twice", funcName);
+					}
+					key = parseNameSet(funcName, "key", val); // may throw
+				} else if (!strcmp(opt, "limit")) {
+					limit = SvIV(val);
+				} else {
+					throw Exception::f("%s: unknown option '%s'", funcName, opt);
+				}
+			}
+
+			if (key.isNull()) {
+				throw Exception::f("%s: the required option 'key' is missing", funcName);
+			}
+			if (limit <= 0) {
+				throw Exception::f("%s: the option 'limit' must be a positive number, got %ld", funcName, (long)limit);
+			}
+
+			RETVAL = new WrapIndexType(new TopIndexType(key, (size_t)limit));
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+#// create a TimeWindowIndex
+#// options go in pairs  name => value 
+WrapIndexType *
+newTimeWindow(char *CLASS, ...)
+	CODE:
+		static char funcName[] =  "Triceps::IndexType::newTimeWindow";
+		RETVAL = NULL; // shut up the warning
+		try { do {
+			clearErrMsg();
+			string field;
+
+			if (items % 2 != 1) {
+				throw Exception::f("Usage: %s(CLASS, optionName, optionValue, ...), option names and values must go in pairs", funcName);
+			}
+			for (int i = 1; i < items; i += 2) {
+				const char *opt = (const char *)SvPV_nolen(ST(i));
+				SV *val = ST(i+1);
+				if (!strcmp(opt, "field")) {
+					GetSvString(field, val, "%s: option '%s'", funcName, opt);
+				} else {
+					throw Exception::f("%s: unknown option '%s'", funcName, opt);
+				}
+			}
+
+			if (field.empty()) {
+				throw Exception::f("%s: the required option 'field' is missing", funcName);
+			}
 
-			RETVAL = new WrapIndexType(new OrderedIndexType(key));
+			RETVAL = new WrapIndexType(new TimeWindowIndexType(field));
 		} while(0); } TRICEPS_CATCH_CROAK;
 	OUTPUT:
 		RETVAL
@@ -298,7 +379,7 @@ setAggregator(WrapIndexType *self, WrapAggregatorType *wagg)
 
 		clearErrMsg();
 		IndexType *ixt = self->get();
-		PerlAggregatorType *agg = wagg->get();
+		AggregatorType *agg = wagg->get();
 
 		try { do {
 			if (ixt->isInitialized()) {
@@ -326,7 +407,7 @@ getAggregator(WrapIndexType *self)
 
 		clearErrMsg();
 		IndexType *ixt = self->get();
-		PerlAggregatorType *agg = dynamic_cast<PerlAggregatorType *>(const_cast<AggregatorType *>(ixt->getAggregator()));
+		AggregatorType *agg = const_cast<AggregatorType *>(ixt->getAggregator());
 
 		if (agg == NULL)
 			XSRETURN_UNDEF; // not a croak!
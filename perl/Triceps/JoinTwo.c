@@ -0,0 +1,566 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of JoinTwo.xs. Do not edit this file, edit JoinTwo.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "JoinTwo.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for the native C++ JoinTwo. The Perl Triceps::JoinTwo
+// resolves the field patterns and then uses it as its implementation.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+
+#line 27 "JoinTwo.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 171 "JoinTwo.c"
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 23 "JoinTwo.xs"
+		RETVAL = 1;
+#line 184 "JoinTwo.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapJoinTwo *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::DESTROY(): self has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::DESTROY(): self is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+#line 30 "JoinTwo.xs"
+		// warn("JoinTwoNative destroyed!");
+		delete self;
+#line 213 "JoinTwo.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_new)
+{
+    dVAR; dXSARGS;
+    if (items != 17)
+       croak_xs_usage(cv,  "CLASS, name, wlt, wrt, wlidx, wridx, wlfrom, wrfrom, by, leftFields, leftNames, rightFields, rightNames, fieldsLeftFirst, fieldsUniqKey, type, overrideSimpleMinded");
+    {
+	WrapJoinTwo *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+	char *	name = (char *)SvPV_nolen(ST(1))
+;
+	WrapTable *	wlt;
+	WrapTable *	wrt;
+	WrapIndexType *	wlidx;
+	WrapIndexType *	wridx;
+	WrapLabel *	wlfrom;
+	WrapLabel *	wrfrom;
+	SV *	by = ST(8)
+;
+	SV *	leftFields = ST(9)
+;
+	SV *	leftNames = ST(10)
+;
+	SV *	rightFields = ST(11)
+;
+	SV *	rightNames = ST(12)
+;
+	int	fieldsLeftFirst = (int)SvIV(ST(13))
+;
+	char *	fieldsUniqKey = (char *)SvPV_nolen(ST(14))
+;
+	char *	type = (char *)SvPV_nolen(ST(15))
+;
+	int	overrideSimpleMinded = (int)SvIV(ST(16))
+;
+
+	if( sv_isobject(ST(2)) && (SvTYPE(SvRV(ST(2))) == SVt_PVMG) ) {
+		wlt = (WrapTable *)SvIV((SV*)SvRV( ST(2) ));
+		if (wlt == 0 || wlt->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wlt has an incorrect magic for WrapTablePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wlt is not a blessed SV reference to WrapTablePtr" );
+	}
+;
+
+	if( sv_isobject(ST(3)) && (SvTYPE(SvRV(ST(3))) == SVt_PVMG) ) {
+		wrt = (WrapTable *)SvIV((SV*)SvRV( ST(3) ));
+		if (wrt == 0 || wrt->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wrt has an incorrect magic for WrapTablePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wrt is not a blessed SV reference to WrapTablePtr" );
+	}
+;
+
+	if( sv_isobject(ST(4)) && (SvTYPE(SvRV(ST(4))) == SVt_PVMG) ) {
+		wlidx = (WrapIndexType *)SvIV((SV*)SvRV( ST(4) ));
+		if (wlidx == 0 || wlidx->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wlidx has an incorrect magic for WrapIndexTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wlidx is not a blessed SV reference to WrapIndexTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(5)) && (SvTYPE(SvRV(ST(5))) == SVt_PVMG) ) {
+		wridx = (WrapIndexType *)SvIV((SV*)SvRV( ST(5) ));
+		if (wridx == 0 || wridx->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wridx has an incorrect magic for WrapIndexTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wridx is not a blessed SV reference to WrapIndexTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(6)) && (SvTYPE(SvRV(ST(6))) == SVt_PVMG) ) {
+		wlfrom = (WrapLabel *)SvIV((SV*)SvRV( ST(6) ));
+		if (wlfrom == 0 || wlfrom->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wlfrom has an incorrect magic for WrapLabelPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wlfrom is not a blessed SV reference to WrapLabelPtr" );
+	}
+;
+
+	if( sv_isobject(ST(7)) && (SvTYPE(SvRV(ST(7))) == SVt_PVMG) ) {
+		wrfrom = (WrapLabel *)SvIV((SV*)SvRV( ST(7) ));
+		if (wrfrom == 0 || wrfrom->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::new(): wrfrom has an incorrect magic for WrapLabelPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::new(): wrfrom is not a blessed SV reference to WrapLabelPtr" );
+	}
+;
+#line 57 "JoinTwo.xs"
+		static char funcName[] =  "Triceps::JoinTwoNative::new";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			int jt = JoinTwo::stringJoinType(type);
+			if (jt < 0)
+				throw Exception::f("%s: unknown join type '%s'", funcName, type);
+			int uk = JoinTwo::stringUniqKey(fieldsUniqKey);
+			if (uk < 0)
+				throw Exception::f("%s: unknown key uniqueness mode '%s'", funcName, fieldsUniqKey);
+
+			Table *lt = wlt->get();
+			Autoref<JoinTwo> join = new JoinTwo(lt->getUnit(), name, lt, wrt->get(), wlidx->get(), wridx->get());
+
+			if (!SvROK(by) || SvTYPE(SvRV(by)) != SVt_PVAV)
+				throw Exception::f("%s: argument 'by' value must be an array reference", funcName);
+			AV *bya = (AV *)SvRV(by);
+			int bylen = av_len(bya) + 1;
+			if (bylen % 2 != 0)
+				throw Exception::f("%s: argument 'by' must contain an even number of field names", funcName);
+			for (int i = 0; i < bylen; i += 2) {
+				string lf, rf;
+				GetSvString(lf, *av_fetch(bya, i, 1), "%s: argument 'by' element %d", funcName, i);
+				GetSvString(rf, *av_fetch(bya, i+1, 1), "%s: argument 'by' element %d", funcName, i+1);
+				join->addBy(lf, rf);
+			}
+
+			join->setLeftFromLabel(wlfrom->get())
+				->setRightFromLabel(wrfrom->get())
+				->setLeftFields(parseOptNameSet(funcName, "leftFields", leftFields),
+					parseOptNameSet(funcName, "leftNames", leftNames))
+				->setRightFields(parseOptNameSet(funcName, "rightFields", rightFields),
+					parseOptNameSet(funcName, "rightNames", rightNames))
+				->setFieldsLeftFirst(fieldsLeftFirst)
+				->setFieldsUniqKey((JoinTwo::UniqKey)uk)
+				->setType((JoinTwo::JoinType)jt)
+				->setOverrideSimpleMinded(overrideSimpleMinded);
+
+			join->initialize();
+			Erref err = join->getErrors();
+			if (err->hasError())
+				throw Exception(err, strprintf("%s: the join '%s' is invalid:", funcName, name));
+
+			RETVAL = new WrapJoinTwo(join);
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 363 "JoinTwo.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapJoinTwo *	self;
+	WrapJoinTwo *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::same(): self has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::same(): self is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::same(): other has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::same(): other is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+#line 110 "JoinTwo.xs"
+		clearErrMsg();
+		RETVAL = (self->get() == other->get());
+#line 409 "JoinTwo.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_getName); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_getName)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapJoinTwo *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::getName(): self has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::getName(): self is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+#line 118 "JoinTwo.xs"
+		clearErrMsg();
+		RETVAL = (char *)self->get()->getName().c_str();
+#line 440 "JoinTwo.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_getOutputLabel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_getOutputLabel)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapLabel *	RETVAL;
+	WrapJoinTwo *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::getOutputLabel(): self has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::getOutputLabel(): self is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+#line 126 "JoinTwo.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getOutputLabel());
+#line 474 "JoinTwo.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__JoinTwoNative_getResultRowType); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__JoinTwoNative_getResultRowType)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRowType *	RETVAL;
+	WrapJoinTwo *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapJoinTwo *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::JoinTwoNative::getResultRowType(): self has an incorrect magic for WrapJoinTwoPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::JoinTwoNative::getResultRowType(): self is not a blessed SV reference to WrapJoinTwoPtr" );
+	}
+;
+#line 137 "JoinTwo.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::RowType";
+
+		clearErrMsg();
+		RETVAL = new WrapRowType(const_cast<RowType *>(self->get()->getResultRowType()));
+#line 511 "JoinTwo.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__JoinTwo); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__JoinTwo)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::JoinTwoNative::CLONE_SKIP", XS_Triceps__JoinTwoNative_CLONE_SKIP);
+        newXS_deffile("Triceps::JoinTwoNative::DESTROY", XS_Triceps__JoinTwoNative_DESTROY);
+        newXS_deffile("Triceps::JoinTwoNative::new", XS_Triceps__JoinTwoNative_new);
+        newXS_deffile("Triceps::JoinTwoNative::same", XS_Triceps__JoinTwoNative_same);
+        newXS_deffile("Triceps::JoinTwoNative::getName", XS_Triceps__JoinTwoNative_getName);
+        newXS_deffile("Triceps::JoinTwoNative::getOutputLabel", XS_Triceps__JoinTwoNative_getOutputLabel);
+        newXS_deffile("Triceps::JoinTwoNative::getResultRowType", XS_Triceps__JoinTwoNative_getResultRowType);
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
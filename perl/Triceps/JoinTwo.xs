@@ -0,0 +1,144 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for the native C++ JoinTwo. The Perl Triceps::JoinTwo
+// resolves the field patterns and then uses it as its implementation.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+
+MODULE = Triceps::JoinTwo		PACKAGE = Triceps::JoinTwoNative
+###################################################################################
+
+int
+CLONE_SKIP(...)
+	CODE:
+		RETVAL = 1;
+	OUTPUT:
+		RETVAL
+
+void
+DESTROY(WrapJoinTwo *self)
+	CODE:
+		// warn("JoinTwoNative destroyed!");
+		delete self;
+
+#// Create and initialize the native join. All the field selections must
+#// be already resolved to the explicit lists of field names.
+#// @param CLASS - name of type being constructed
+#// @param name - name of the join
+#// @param wlt - the left table
+#// @param wrt - the right table
+#// @param wlidx - the index type in the left table
+#// @param wridx - the index type in the right table
+#// @param wlfrom - the label to react to the changes on the left side
+#// @param wrfrom - the label to react to the changes on the right side
+#// @param by - reference to array of the key field pairs (leftFld, rightFld, ...)
+#// @param leftFields - reference to array of the left fields passing to the
+#//        result, or undef for all the fields
+#// @param leftNames - reference to array of their names in the result, or undef
+#//        for the same names
+#// @param rightFields - same for the right side
+#// @param rightNames - same for the right side
+#// @param fieldsLeftFirst - flag: the left-side fields go first in the result
+#// @param fieldsUniqKey - the key uniqueness mode, as a string
+#// @param type - the join type, as a string
+#// @param overrideSimpleMinded - flag: produce the simple-minded garbage result
+WrapJoinTwo *
+new(char *CLASS, char *name, WrapTable *wlt, WrapTable *wrt, WrapIndexType *wlidx, WrapIndexType *wridx, WrapLabel *wlfrom, WrapLabel *wrfrom, SV *by, SV *leftFields, SV *leftNames, SV *rightFields, SV *rightNames, int fieldsLeftFirst, char *fieldsUniqKey, char *type, int overrideSimpleMinded)
+	CODE:
+		static char funcName[] =  "Triceps::JoinTwoNative::new";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			int jt = JoinTwo::stringJoinType(type);
+			if (jt < 0)
+				throw Exception::f("%s: unknown join type '%s'", funcName, type);
+			int uk = JoinTwo::stringUniqKey(fieldsUniqKey);
+			if (uk < 0)
+				throw Exception::f("%s: unknown key uniqueness mode '%s'", funcName, fieldsUniqKey);
+
+			Table *lt = wlt->get();
+			Autoref<JoinTwo> join = new JoinTwo(lt->getUnit(), name, lt, wrt->get(), wlidx->get(), wridx->get());
+
+			if (!SvROK(by) || SvTYPE(SvRV(by)) != SVt_PVAV)
+				throw Exception::f("%s: argument 'by' value must be an array reference", funcName);
+			AV *bya = (AV *)SvRV(by);
+			int bylen = av_len(bya) + 1;
+			if (bylen % 2 != 0)
+				throw Exception::f("%s: argument 'by' must contain an even number of field names", funcName);
+			for (int i = 0; i < bylen; i += 2) {
+				string lf, rf;
+				GetSvString(lf, *av_fetch(bya, i, 1), "%s: argument 'by' element %d", funcName, i);
+				GetSvString(rf, *av_fetch(bya, i+1, 1), "%s: argument 'by' element %d", funcName, i+1);
+				join->addBy(lf, rf);
+			}
+
+			join->setLeftFromLabel(wlfrom->get())
+				->setRightFromLabel(wrfrom->get())
+				->setLeftFields(parseOptNameSet(funcName, "leftFields", leftFields),
+					parseOptNameSet(funcName, "leftNames", leftNames))
+				->setRightFields(parseOptNameSet(funcName, "rightFields", rightFields),
+					parseOptNameSet(funcName, "rightNames", rightNames))
+				->setFieldsLeftFirst(fieldsLeftFirst)
+				->setFieldsUniqKey((JoinTwo::UniqKey)uk)
+				->setType((JoinTwo::JoinType)jt)
+				->setOverrideSimpleMinded(overrideSimpleMinded);
+
+			join->initialize();
+			Erref err = join->getErrors();
+			if (err->hasError())
+				throw Exception(err, strprintf("%s: the join '%s' is invalid:", funcName, name));
+
+			RETVAL = new WrapJoinTwo(join);
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+int
+same(WrapJoinTwo *self, WrapJoinTwo *other)
+	CODE:
+		clearErrMsg();
+		RETVAL = (self->get() == other->get());
+	OUTPUT:
+		RETVAL
+
+char *
+getName(WrapJoinTwo *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = (char *)self->get()->getName().c_str();
+	OUTPUT:
+		RETVAL
+
+WrapLabel *
+getOutputLabel(WrapJoinTwo *self)
+	CODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getOutputLabel());
+	OUTPUT:
+		RETVAL
+
+WrapRowType *
+getResultRowType(WrapJoinTwo *self)
+	CODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::RowType";
+
+		clearErrMsg();
+		RETVAL = new WrapRowType(const_cast<RowType *>(self->get()->getResultRowType()));
+	OUTPUT:
+		RETVAL
+
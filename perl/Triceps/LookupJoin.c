@@ -0,0 +1,643 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of LookupJoin.xs. Do not edit this file, edit LookupJoin.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "LookupJoin.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for the native C++ LookupJoin. The Perl Triceps::LookupJoin
+// resolves the field patterns and then uses it as its implementation.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+
+#line 27 "LookupJoin.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 171 "LookupJoin.c"
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 23 "LookupJoin.xs"
+		RETVAL = 1;
+#line 184 "LookupJoin.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapLookupJoin *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::DESTROY(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::DESTROY(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 30 "LookupJoin.xs"
+		// warn("LookupJoinNative destroyed!");
+		delete self;
+#line 213 "LookupJoin.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_new)
+{
+    dVAR; dXSARGS;
+    if (items != 15)
+       croak_xs_usage(cv,  "CLASS, wunit, name, wlrt, wtab, widx, by, leftFields, leftNames, rightFields, rightNames, fieldsLeftFirst, fieldsMirrorKey, isLeft, limitOne");
+    {
+	WrapLookupJoin *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+	WrapUnit *	wunit;
+	char *	name = (char *)SvPV_nolen(ST(2))
+;
+	WrapRowType *	wlrt;
+	WrapTable *	wtab;
+	WrapIndexType *	widx;
+	SV *	by = ST(6)
+;
+	SV *	leftFields = ST(7)
+;
+	SV *	leftNames = ST(8)
+;
+	SV *	rightFields = ST(9)
+;
+	SV *	rightNames = ST(10)
+;
+	int	fieldsLeftFirst = (int)SvIV(ST(11))
+;
+	int	fieldsMirrorKey = (int)SvIV(ST(12))
+;
+	int	isLeft = (int)SvIV(ST(13))
+;
+	int	limitOne = (int)SvIV(ST(14))
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		wunit = (WrapUnit *)SvIV((SV*)SvRV( ST(1) ));
+		if (wunit == 0 || wunit->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::new(): wunit has an incorrect magic for WrapUnitPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::new(): wunit is not a blessed SV reference to WrapUnitPtr" );
+	}
+;
+
+	if( sv_isobject(ST(3)) && (SvTYPE(SvRV(ST(3))) == SVt_PVMG) ) {
+		wlrt = (WrapRowType *)SvIV((SV*)SvRV( ST(3) ));
+		if (wlrt == 0 || wlrt->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::new(): wlrt has an incorrect magic for WrapRowTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::new(): wlrt is not a blessed SV reference to WrapRowTypePtr" );
+	}
+;
+
+	if( sv_isobject(ST(4)) && (SvTYPE(SvRV(ST(4))) == SVt_PVMG) ) {
+		wtab = (WrapTable *)SvIV((SV*)SvRV( ST(4) ));
+		if (wtab == 0 || wtab->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::new(): wtab has an incorrect magic for WrapTablePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::new(): wtab is not a blessed SV reference to WrapTablePtr" );
+	}
+;
+
+	if( sv_isobject(ST(5)) && (SvTYPE(SvRV(ST(5))) == SVt_PVMG) ) {
+		widx = (WrapIndexType *)SvIV((SV*)SvRV( ST(5) ));
+		if (widx == 0 || widx->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::new(): widx has an incorrect magic for WrapIndexTypePtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::new(): widx is not a blessed SV reference to WrapIndexTypePtr" );
+	}
+;
+#line 56 "LookupJoin.xs"
+		static char funcName[] =  "Triceps::LookupJoinNative::new";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			Table *t = wtab->get();
+			IndexType *idx = widx->get();
+			if (idx->getTabtype() != t->getType())
+				throw Exception::f("%s: the index type does not belong to the right table's type", funcName);
+
+			Autoref<LookupJoin> join = new LookupJoin(wunit->get(), name, wlrt->get(), t, idx);
+
+			if (!SvROK(by) || SvTYPE(SvRV(by)) != SVt_PVAV)
+				throw Exception::f("%s: argument 'by' value must be an array reference", funcName);
+			AV *bya = (AV *)SvRV(by);
+			int bylen = av_len(bya) + 1;
+			if (bylen % 2 != 0)
+				throw Exception::f("%s: argument 'by' must contain an even number of field names", funcName);
+			for (int i = 0; i < bylen; i += 2) {
+				string lf, rf;
+				GetSvString(lf, *av_fetch(bya, i, 1), "%s: argument 'by' element %d", funcName, i);
+				GetSvString(rf, *av_fetch(bya, i+1, 1), "%s: argument 'by' element %d", funcName, i+1);
+				join->addBy(lf, rf);
+			}
+
+			join->setLeftFields(parseOptNameSet(funcName, "leftFields", leftFields),
+				parseOptNameSet(funcName, "leftNames", leftNames));
+			join->setRightFields(parseOptNameSet(funcName, "rightFields", rightFields),
+				parseOptNameSet(funcName, "rightNames", rightNames));
+			join->setFieldsLeftFirst(fieldsLeftFirst)
+				->setFieldsMirrorKey(fieldsMirrorKey)
+				->setIsLeft(isLeft)
+				->setLimitOne(limitOne);
+
+			join->initialize();
+			Erref err = join->getErrors();
+			if (err->hasError())
+				throw Exception(err, strprintf("%s: the join '%s' is invalid:", funcName, name));
+
+			RETVAL = new WrapLookupJoin(join);
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 336 "LookupJoin.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapLookupJoin *	self;
+	WrapLookupJoin *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::same(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::same(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::same(): other has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::same(): other is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 104 "LookupJoin.xs"
+		clearErrMsg();
+		RETVAL = (self->get() == other->get());
+#line 382 "LookupJoin.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_getName); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_getName)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapLookupJoin *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::getName(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::getName(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 112 "LookupJoin.xs"
+		clearErrMsg();
+		RETVAL = (char *)self->get()->getName().c_str();
+#line 413 "LookupJoin.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_getInputLabel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_getInputLabel)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapLabel *	RETVAL;
+	WrapLookupJoin *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::getInputLabel(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::getInputLabel(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 120 "LookupJoin.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getInputLabel());
+#line 447 "LookupJoin.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_getOutputLabel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_getOutputLabel)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapLabel *	RETVAL;
+	WrapLookupJoin *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::getOutputLabel(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::getOutputLabel(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 131 "LookupJoin.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getOutputLabel());
+#line 484 "LookupJoin.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_getResultRowType); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_getResultRowType)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRowType *	RETVAL;
+	WrapLookupJoin *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::getResultRowType(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::getResultRowType(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+#line 142 "LookupJoin.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::RowType";
+
+		clearErrMsg();
+		RETVAL = new WrapRowType(const_cast<RowType *>(self->get()->getResultRowType()));
+#line 521 "LookupJoin.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__LookupJoinNative_lookup); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__LookupJoinNative_lookup)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, wr");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	WrapLookupJoin *	self;
+	WrapRow *	wr;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapLookupJoin *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::lookup(): self has an incorrect magic for WrapLookupJoinPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::lookup(): self is not a blessed SV reference to WrapLookupJoinPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		wr = (WrapRow *)SvIV((SV*)SvRV( ST(1) ));
+		if (wr == 0 || wr->badMagic()) {
+			croakWithMsg( "Triceps::LookupJoinNative::lookup(): wr has an incorrect magic for WrapRowPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::LookupJoinNative::lookup(): wr is not a blessed SV reference to WrapRowPtr" );
+	}
+;
+#line 158 "LookupJoin.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Row";
+		static char funcName[] =  "Triceps::LookupJoinNative::lookup";
+
+		try { do {
+			clearErrMsg();
+			LookupJoin *join = self->get();
+
+			if (!wr->ref_.getType()->match(join->getLeftRowType())) {
+				string msg = strprintf("%s: join and row types are not equal, in join: ", funcName);
+				join->getLeftRowType()->printTo(msg, NOINDENT);
+				msg.append(", in row: ");
+				wr->ref_.getType()->printTo(msg, NOINDENT);
+				throw Exception(msg, false);
+			}
+
+			Autoref<Tray> tray = new Tray;
+			join->lookup(Rowop::OP_NOP, wr->get(), tray);
+
+			RowType *rt = const_cast<RowType *>(join->getResultRowType());
+			for (Tray::iterator it = tray->begin(); it != tray->end(); ++it) {
+				SV *rowv = sv_newmortal();
+				sv_setref_pv( rowv, CLASS, (void*)(new WrapRow(rt, const_cast<Row *>((*it)->getRow()))) );
+				XPUSHs(rowv);
+			}
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 591 "LookupJoin.c"
+	PUTBACK;
+	return;
+    }
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__LookupJoin); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__LookupJoin)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::LookupJoinNative::CLONE_SKIP", XS_Triceps__LookupJoinNative_CLONE_SKIP);
+        newXS_deffile("Triceps::LookupJoinNative::DESTROY", XS_Triceps__LookupJoinNative_DESTROY);
+        newXS_deffile("Triceps::LookupJoinNative::new", XS_Triceps__LookupJoinNative_new);
+        newXS_deffile("Triceps::LookupJoinNative::same", XS_Triceps__LookupJoinNative_same);
+        newXS_deffile("Triceps::LookupJoinNative::getName", XS_Triceps__LookupJoinNative_getName);
+        newXS_deffile("Triceps::LookupJoinNative::getInputLabel", XS_Triceps__LookupJoinNative_getInputLabel);
+        newXS_deffile("Triceps::LookupJoinNative::getOutputLabel", XS_Triceps__LookupJoinNative_getOutputLabel);
+        newXS_deffile("Triceps::LookupJoinNative::getResultRowType", XS_Triceps__LookupJoinNative_getResultRowType);
+        newXS_deffile("Triceps::LookupJoinNative::lookup", XS_Triceps__LookupJoinNative_lookup);
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
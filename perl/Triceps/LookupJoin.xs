@@ -0,0 +1,184 @@
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for the native C++ LookupJoin. The Perl Triceps::LookupJoin
+// resolves the field patterns and then uses it as its implementation.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+
+MODULE = Triceps::LookupJoin		PACKAGE = Triceps::LookupJoinNative
+###################################################################################
+
+int
+CLONE_SKIP(...)
+	CODE:
+		RETVAL = 1;
+	OUTPUT:
+		RETVAL
+
+void
+DESTROY(WrapLookupJoin *self)
+	CODE:
+		// warn("LookupJoinNative destroyed!");
+		delete self;
+
+#// Create and initialize the native join. All the field selections must
+#// be already resolved to the explicit lists of field names.
+#// @param CLASS - name of type being constructed
+#// @param wunit - unit where the join belongs
+#// @param name - name of the join
+#// @param wlrt - type of the left-side rows
+#// @param wtab - the right-side table
+#// @param widx - the index type in the right table used for the look-up
+#// @param by - reference to array of the key field pairs (leftFld, rightFld, ...)
+#// @param leftFields - reference to array of the left fields passing to the
+#//        result, or undef for all the fields
+#// @param leftNames - reference to array of their names in the result, or undef
+#//        for the same names
+#// @param rightFields - same for the right side
+#// @param rightNames - same for the right side
+#// @param fieldsLeftFirst - flag: the left-side fields go first in the result
+#// @param fieldsMirrorKey - flag: fill the right-side key fields from the
+#//        left side when no match is found
+#// @param isLeft - flag: left outer join, otherwise inner join
+#// @param limitOne - flag: return no more than one row
+WrapLookupJoin *
+new(char *CLASS, WrapUnit *wunit, char *name, WrapRowType *wlrt, WrapTable *wtab, WrapIndexType *widx, SV *by, SV *leftFields, SV *leftNames, SV *rightFields, SV *rightNames, int fieldsLeftFirst, int fieldsMirrorKey, int isLeft, int limitOne)
+	CODE:
+		static char funcName[] =  "Triceps::LookupJoinNative::new";
+		RETVAL = NULL; // shut up the warning
+
+		try { do {
+			clearErrMsg();
+
+			Table *t = wtab->get();
+			IndexType *idx = widx->get();
+			if (idx->getTabtype() != t->getType())
+				throw Exception::f("%s: the index type does not belong to the right table's type", funcName);
+
+			Autoref<LookupJoin> join = new LookupJoin(wunit->get(), name, wlrt->get(), t, idx);
+
+			if (!SvROK(by) || SvTYPE(SvRV(by)) != SVt_PVAV)
+				throw Exception::f("%s: argument 'by' value must be an array reference", funcName);
+			AV *bya = (AV *)SvRV(by);
+			int bylen = av_len(bya) + 1;
+			if (bylen % 2 != 0)
+				throw Exception::f("%s: argument 'by' must contain an even number of field names", funcName);
+			for (int i = 0; i < bylen; i += 2) {
+				string lf, rf;
+				GetSvString(lf, *av_fetch(bya, i, 1), "%s: argument 'by' element %d", funcName, i);
+				GetSvString(rf, *av_fetch(bya, i+1, 1), "%s: argument 'by' element %d", funcName, i+1);
+				join->addBy(lf, rf);
+			}
+
+			join->setLeftFields(parseOptNameSet(funcName, "leftFields", leftFields),
+				parseOptNameSet(funcName, "leftNames", leftNames));
+			join->setRightFields(parseOptNameSet(funcName, "rightFields", rightFields),
+				parseOptNameSet(funcName, "rightNames", rightNames));
+			join->setFieldsLeftFirst(fieldsLeftFirst)
+				->setFieldsMirrorKey(fieldsMirrorKey)
+				->setIsLeft(isLeft)
+				->setLimitOne(limitOne);
+
+			join->initialize();
+			Erref err = join->getErrors();
+			if (err->hasError())
+				throw Exception(err, strprintf("%s: the join '%s' is invalid:", funcName, name));
+
+			RETVAL = new WrapLookupJoin(join);
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+int
+same(WrapLookupJoin *self, WrapLookupJoin *other)
+	CODE:
+		clearErrMsg();
+		RETVAL = (self->get() == other->get());
+	OUTPUT:
+		RETVAL
+
+char *
+getName(WrapLookupJoin *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = (char *)self->get()->getName().c_str();
+	OUTPUT:
+		RETVAL
+
+WrapLabel *
+getInputLabel(WrapLookupJoin *self)
+	CODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getInputLabel());
+	OUTPUT:
+		RETVAL
+
+WrapLabel *
+getOutputLabel(WrapLookupJoin *self)
+	CODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+
+		clearErrMsg();
+		RETVAL = new WrapLabel(self->get()->getOutputLabel());
+	OUTPUT:
+		RETVAL
+
+WrapRowType *
+getResultRowType(WrapLookupJoin *self)
+	CODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::RowType";
+
+		clearErrMsg();
+		RETVAL = new WrapRowType(const_cast<RowType *>(self->get()->getResultRowType()));
+	OUTPUT:
+		RETVAL
+
+#// Perform the look-up and return the result rows, without sending
+#// them anywhere.
+#// @param self - this object
+#// @param wr - the left-side row
+#// @return - an array of the result rows
+void
+lookup(WrapLookupJoin *self, WrapRow *wr)
+	PPCODE:
+		// for casting of return value
+		static char CLASS[] = "Triceps::Row";
+		static char funcName[] =  "Triceps::LookupJoinNative::lookup";
+
+		try { do {
+			clearErrMsg();
+			LookupJoin *join = self->get();
+
+			if (!wr->ref_.getType()->match(join->getLeftRowType())) {
+				string msg = strprintf("%s: join and row types are not equal, in join: ", funcName);
+				join->getLeftRowType()->printTo(msg, NOINDENT);
+				msg.append(", in row: ");
+				wr->ref_.getType()->printTo(msg, NOINDENT);
+				throw Exception(msg, false);
+			}
+
+			Autoref<Tray> tray = new Tray;
+			join->lookup(Rowop::OP_NOP, wr->get(), tray);
+
+			RowType *rt = const_cast<RowType *>(join->getResultRowType());
+			for (Tray::iterator it = tray->begin(); it != tray->end(); ++it) {
+				SV *rowv = sv_newmortal();
+				sv_setref_pv( rowv, CLASS, (void*)(new WrapRow(rt, const_cast<Row *>((*it)->getRow()))) );
+				XPUSHs(rowv);
+			}
+		} while(0); } TRICEPS_CATCH_CROAK;
+
@@ -0,0 +1,536 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of Nexus.xs. Do not edit this file, edit Nexus.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "Nexus.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for Nexus.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+#include "app/Nexus.h"
+
+#line 27 "Nexus.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 171 "Nexus.c"
+
+XS_EUPXS(XS_Triceps__Nexus_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 23 "Nexus.xs"
+		RETVAL = 1;
+#line 184 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::DESTROY(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::DESTROY(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 30 "Nexus.xs"
+		// Nexus *nx = self->get();
+		// warn("Nexus %s %p wrap %p destroyed!", nx->getName().c_str(), to, self);
+		delete self;
+#line 214 "Nexus.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+	WrapNexus *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::same(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::same(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapNexus *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::same(): other has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::same(): other is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 38 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx1 = self->get();
+		Nexus *nx2 = other->get();
+		RETVAL = (nx1 == nx2);
+#line 256 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_getName); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_getName)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::getName(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::getName(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 48 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = (char *)nx->getName().c_str();
+#line 288 "Nexus.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_getTrieadName); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_getTrieadName)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::getTrieadName(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::getTrieadName(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 57 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = (char *)nx->getTrieadName().c_str();
+#line 321 "Nexus.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_isReverse); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_isReverse)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::isReverse(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::isReverse(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 66 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->isReverse();
+#line 354 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_isUnicast); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_isUnicast)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::isUnicast(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::isUnicast(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 75 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->isUnicast();
+#line 386 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_isPartitioned); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_isPartitioned)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::isPartitioned(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::isPartitioned(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 84 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->isPartitioned();
+#line 418 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_queueLimit); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_queueLimit)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::queueLimit(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::queueLimit(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 93 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->queueLimit();
+#line 450 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Nexus_queueRing); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Nexus_queueRing)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapNexus *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapNexus *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Nexus::queueRing(): self has an incorrect magic for WrapNexusPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Nexus::queueRing(): self is not a blessed SV reference to WrapNexusPtr" );
+	}
+;
+#line 102 "Nexus.xs"
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->queueRing();
+#line 482 "Nexus.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__Nexus); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__Nexus)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::Nexus::CLONE_SKIP", XS_Triceps__Nexus_CLONE_SKIP);
+        newXS_deffile("Triceps::Nexus::DESTROY", XS_Triceps__Nexus_DESTROY);
+        newXS_deffile("Triceps::Nexus::same", XS_Triceps__Nexus_same);
+        newXS_deffile("Triceps::Nexus::getName", XS_Triceps__Nexus_getName);
+        newXS_deffile("Triceps::Nexus::getTrieadName", XS_Triceps__Nexus_getTrieadName);
+        newXS_deffile("Triceps::Nexus::isReverse", XS_Triceps__Nexus_isReverse);
+        newXS_deffile("Triceps::Nexus::isUnicast", XS_Triceps__Nexus_isUnicast);
+        newXS_deffile("Triceps::Nexus::isPartitioned", XS_Triceps__Nexus_isPartitioned);
+        newXS_deffile("Triceps::Nexus::queueLimit", XS_Triceps__Nexus_queueLimit);
+        newXS_deffile("Triceps::Nexus::queueRing", XS_Triceps__Nexus_queueRing);
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
@@ -69,6 +69,24 @@ isReverse(WrapNexus *self)
 	OUTPUT:
 		RETVAL
 
+int
+isUnicast(WrapNexus *self)
+	CODE:
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->isUnicast();
+	OUTPUT:
+		RETVAL
+
+int
+isPartitioned(WrapNexus *self)
+	CODE:
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->isPartitioned();
+	OUTPUT:
+		RETVAL
+
 int
 queueLimit(WrapNexus *self)
 	CODE:
@@ -78,4 +96,13 @@ queueLimit(WrapNexus *self)
 	OUTPUT:
 		RETVAL
 
+int
+queueRing(WrapNexus *self)
+	CODE:
+		clearErrMsg();
+		Nexus *nx = self->get();
+		RETVAL = nx->queueRing();
+	OUTPUT:
+		RETVAL
+
 #// tested in TrieadOwner.t
@@ -116,7 +116,8 @@ protected:
 };
 
 extern WrapMagic magicWrapAggregatorType;
-typedef Wrap<magicWrapAggregatorType, PerlAggregatorType> WrapAggregatorType;
+// wraps any aggregator type, including the native C++ ones
+typedef Wrap<magicWrapAggregatorType, AggregatorType> WrapAggregatorType;
 
 }; // Triceps::TricepsPerl
 }; // Triceps
@@ -26,10 +26,14 @@ CLONE_SKIP(...)
 	OUTPUT:
 		RETVAL
 
+#// newAligned() builds the row type with the aligned format, that
+#// has the faster access to the numeric fields, for the cost of the bigger rows
 WrapRowType *
 Triceps::RowType::new(...)
+	ALIAS:
+		newAligned = 1
 	CODE:
-		static char funcName[] =  "Triceps::RowType::new";
+		const char *funcName = (ix == 1? "Triceps::RowType::newAligned" : "Triceps::RowType::new");
 		RETVAL = NULL; // shut up the warning
 		try { do {
 			RowType::FieldVec fld;
@@ -58,10 +62,14 @@ Triceps::RowType::new(...)
 				}
 				fld.push_back(add);
 			}
-			Onceref<RowType> rt = new CompactRowType(fld);
+			Onceref<RowType> rt;
+			if (ix == 1)
+				rt = new AlignedRowType(fld);
+			else
+				rt = new CompactRowType(fld);
 			Erref err = rt->getErrors();
 			if (err->hasError()) {
-				throw Exception::f(err, "Triceps::RowType::new: incorrect specification:");
+				throw Exception::f(err, "%s: incorrect specification:", funcName);
 			}
 
 			RETVAL = new WrapRowType(rt);
@@ -78,7 +86,7 @@ Triceps::RowType::new(...)
 				spec.f("%s => %s", fname, ftype);
 			}
 
-			err->append("Triceps::RowType::new: The specification was: {", spec);
+			err->append(strprintf("%s: The specification was: {", funcName), spec);
 			err->appendMsg(true, "}");
 			setCroakMsg(err->print());
 			croakIfSet();
@@ -268,6 +276,16 @@ same(WrapRowType *self, WrapRowType *other)
 	OUTPUT:
 		RETVAL
 
+#// check whether the type uses the aligned row format
+int
+isAligned(WrapRowType *self)
+	CODE:
+		clearErrMsg();
+		RowType *rt = self->get();
+		RETVAL = (dynamic_cast<AlignedRowType *>(rt) != NULL);
+	OUTPUT:
+		RETVAL
+
 int
 equals(WrapRowType *self, WrapRowType *other)
 	CODE:
@@ -0,0 +1,591 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of Rowop.xs. Do not edit this file, edit Rowop.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "Rowop.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for Rowop.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+
+#line 26 "Rowop.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 170 "Rowop.c"
+
+XS_EUPXS(XS_Triceps__Rowop_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 25 "Rowop.xs"
+		RETVAL = 1;
+#line 183 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::DESTROY(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::DESTROY(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 32 "Rowop.xs"
+		// warn("Rowop destroyed!");
+		delete self;
+#line 212 "Rowop.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_copy); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_copy)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRowop *	RETVAL;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::copy(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::copy(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 39 "Rowop.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Rowop";
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = new WrapRowop(new Rowop(*rop));
+#line 243 "Rowop.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+	WrapRowop *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::same(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::same(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapRowop *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::same(): other has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::same(): other is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 51 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		Rowop *orop = other->get();
+		RETVAL = (rop == orop);
+#line 291 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_getOpcode); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_getOpcode)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::getOpcode(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::getOpcode(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 61 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = rop->getOpcode();
+#line 323 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_isInsert); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_isInsert)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::isInsert(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::isInsert(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 72 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = rop->isInsert();
+#line 355 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_isDelete); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_isDelete)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::isDelete(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::isDelete(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 81 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = rop->isDelete();
+#line 387 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_isNop); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_isNop)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::isNop(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::isNop(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 90 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = rop->isNop();
+#line 419 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_getLabel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_getLabel)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapLabel *	RETVAL;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::getLabel(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::getLabel(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 99 "Rowop.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Label";
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = new WrapLabel(const_cast<Label *>(rop->getLabel()));
+#line 452 "Rowop.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_getRow); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_getRow)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapRow *	RETVAL;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::getRow(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::getRow(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 110 "Rowop.xs"
+		// for casting of return value
+		static char CLASS[] = "Triceps::Row";
+		clearErrMsg();
+		Rowop *rop = self->get();
+		// XXX Should it check for row being NULL? C++ code can create that...
+		RETVAL = new WrapRow(const_cast<RowType *>(rop->getLabel()->getType()), const_cast<Row *>(rop->getRow()));
+#line 490 "Rowop.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__Rowop_getEnqMode); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__Rowop_getEnqMode)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapRowop *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapRowop *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::Rowop::getEnqMode(): self has an incorrect magic for WrapRowopPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::Rowop::getEnqMode(): self is not a blessed SV reference to WrapRowopPtr" );
+	}
+;
+#line 122 "Rowop.xs"
+		clearErrMsg();
+		Rowop *rop = self->get();
+		RETVAL = rop->getEnqMode();
+#line 526 "Rowop.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__Rowop); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__Rowop)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::Rowop::CLONE_SKIP", XS_Triceps__Rowop_CLONE_SKIP);
+        newXS_deffile("Triceps::Rowop::DESTROY", XS_Triceps__Rowop_DESTROY);
+        newXS_deffile("Triceps::Rowop::copy", XS_Triceps__Rowop_copy);
+        newXS_deffile("Triceps::Rowop::same", XS_Triceps__Rowop_same);
+        newXS_deffile("Triceps::Rowop::getOpcode", XS_Triceps__Rowop_getOpcode);
+        newXS_deffile("Triceps::Rowop::isInsert", XS_Triceps__Rowop_isInsert);
+        newXS_deffile("Triceps::Rowop::isDelete", XS_Triceps__Rowop_isDelete);
+        newXS_deffile("Triceps::Rowop::isNop", XS_Triceps__Rowop_isNop);
+        newXS_deffile("Triceps::Rowop::getLabel", XS_Triceps__Rowop_getLabel);
+        newXS_deffile("Triceps::Rowop::getRow", XS_Triceps__Rowop_getRow);
+        newXS_deffile("Triceps::Rowop::getEnqMode", XS_Triceps__Rowop_getEnqMode);
+
+    /* Initialisation Section */
+
+#line 20 "Rowop.xs"
+// fprintf(stderr, "DEBUG Rowop items=%d sp=%p mark=%p\n", items, sp, mark);
+
+#line 578 "Rowop.c"
+
+    /* End of Initialisation Section */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
@@ -528,6 +528,36 @@ findIdx(WrapTable *self, WrapIndexType *widx, SV *rowarg)
 	OUTPUT:
 		RETVAL
 
+#// Find the boundary of a range in an ordered index: the first row with the
+#// key not less than (lowerBoundIdx) or greater than (upperBoundIdx) the argument.
+WrapRowHandle *
+lowerBoundIdx(WrapTable *self, WrapIndexType *widx, SV *rowarg)
+	ALIAS:
+		upperBoundIdx = 1
+	CODE:
+		static char CLASS[] = "Triceps::RowHandle";
+		const char *funcName = (ix == 1? "Triceps::Table::upperBoundIdx" : "Triceps::Table::lowerBoundIdx");
+
+		RETVAL = NULL; // shut up the warning
+		try { do {
+			clearErrMsg();
+			Table *t = self->get();
+			IndexType *idx = widx->get();
+
+			if (idx->getTabtype() != t->getType()) {
+				throw TRICEPS_NS::Exception(strprintf("%s: indexType argument does not belong to table's type", funcName), false);
+			}
+
+			Rhref rhr(t,  parseRowOrHandle(t, funcName, rowarg)); // may throw
+
+			if (ix == 1)
+				RETVAL = new WrapRowHandle(t, t->upperBoundIdx(idx, rhr.get()));
+			else
+				RETVAL = new WrapRowHandle(t, t->lowerBoundIdx(idx, rhr.get()));
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
 int
 groupSizeIdx(WrapTable *self, WrapIndexType *widx, SV *rowarg)
 	CODE:
@@ -551,6 +581,49 @@ groupSizeIdx(WrapTable *self, WrapIndexType *widx, SV *rowarg)
 	OUTPUT:
 		RETVAL
 
+#// Expire the rows older than a watermark in the first TimeWindow index
+#// of the table type, as a batch.
+#// @param ts - (int64) the watermark
+#// @return - the number of rows removed
+int
+expireBefore(WrapTable *self, SV *ts)
+	CODE:
+		static char funcName[] =  "Triceps::Table::expireBefore";
+
+		RETVAL = 0; // shut up the warning
+		try { do {
+			clearErrMsg();
+			Table *t = self->get();
+
+			RETVAL = t->expireBefore((int64_t)SvIV(ts));
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+#// Expire the rows older than a watermark in a TimeWindow index, as a batch.
+#// @param widx - the TimeWindow index type from this table's type
+#// @param ts - (int64) the watermark
+#// @return - the number of rows removed
+int
+expireBeforeIdx(WrapTable *self, WrapIndexType *widx, SV *ts)
+	CODE:
+		static char funcName[] =  "Triceps::Table::expireBeforeIdx";
+
+		RETVAL = 0; // shut up the warning
+		try { do {
+			clearErrMsg();
+			Table *t = self->get();
+			IndexType *idx = widx->get();
+
+			if (idx->getTabtype() != t->getType()) {
+				throw TRICEPS_NS::Exception(strprintf("%s: indexType argument does not belong to table's type", funcName), false);
+			}
+
+			RETVAL = t->expireBefore(idx, (int64_t)SvIV(ts));
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
 #// Clear the table. If the limit is specified, will clear no more than
 #// this many rows. The rows are removed in the order of the first leaf index.
 #// @param limit - (int, optional) maximal number of rows to delete.
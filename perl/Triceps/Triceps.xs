@@ -30,6 +30,8 @@ XS(boot_Triceps__Tray);
 XS(boot_Triceps__Unit); 
 XS(boot_Triceps__UnitTracer); 
 XS(boot_Triceps__Table); 
+XS(boot_Triceps__LookupJoin); 
+XS(boot_Triceps__JoinTwo); 
 XS(boot_Triceps__AggregatorType); 
 XS(boot_Triceps__AggregatorContext); 
 XS(boot_Triceps__FrameMark); 
@@ -105,6 +107,14 @@ BOOT:
 	SPAGAIN; POPs;
 	//
 	PUSHMARK(SP); if (items >= 2) { XPUSHs(ST(0)); XPUSHs(ST(1)); } PUTBACK; 
+	boot_Triceps__LookupJoin(aTHX_ cv); 
+	SPAGAIN; POPs;
+	//
+	PUSHMARK(SP); if (items >= 2) { XPUSHs(ST(0)); XPUSHs(ST(1)); } PUTBACK; 
+	boot_Triceps__JoinTwo(aTHX_ cv); 
+	SPAGAIN; POPs;
+	//
+	PUSHMARK(SP); if (items >= 2) { XPUSHs(ST(0)); XPUSHs(ST(1)); } PUTBACK; 
 	boot_Triceps__AggregatorType(aTHX_ cv); 
 	SPAGAIN; POPs;
 	//
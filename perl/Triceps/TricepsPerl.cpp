@@ -338,6 +338,13 @@ Onceref<NameSet> parseNameSet(const char *funcName, const char *optname, SV *opt
 	return key;
 }
 
+Onceref<NameSet> parseOptNameSet(const char *funcName, const char *optname, SV *optval)
+{
+	if (!SvOK(optval))
+		return NULL;
+	return parseNameSet(funcName, optname, optval);
+}
+
 Gadget::EnqMode parseEnqMode(const char *funcName, SV *enqMode)
 {
 	int intem;
@@ -426,12 +433,15 @@ char *translateUnitTracerSubclass(const Unit::Tracer *tr)
 	static char base[] = "Triceps::UnitTracer";
 	static char strn[] = "Triceps::UnitTracerStringName";
 	static char pl[] = "Triceps::UnitTracerPerl";
+	static char prof[] = "Triceps::UnitTracerProfiling";
 	try {
 		const type_info &trinfo = typeid(*tr);
 		if (trinfo == typeid(Unit::StringNameTracer))
 			return strn;
 		else if (trinfo == typeid(UnitTracerPerl))
 			return pl;
+		else if (trinfo == typeid(Unit::ProfilingTracer))
+			return prof;
 		else
 			return base;
 	} catch(...) {
@@ -93,6 +93,14 @@ SV *bytesToVal(Type::TypeId ti, int arsz, bool notNull, const char *data, intptr
 // @return - the parsed NameSet
 Onceref<NameSet> parseNameSet(const char *funcName, const char *optname, SV *optval);
 
+// Same as parseNameSet() but the value may also be undef.
+// On error throws an Exception.
+// @param funcName - calling function name, for error messages
+// @param optname - option name of the originating value, for error messages
+// @param ref - option value (will be checked for being undef or a reference to array)
+// @return - the parsed NameSet, or NULL if the value is undef
+Onceref<NameSet> parseOptNameSet(const char *funcName, const char *optname, SV *optval);
+
 // Parse an enqueuing mode as an integer or string constant to an enum.
 // On error throws an Exception.
 // @param funcName - calling function name, for error messages
@@ -277,6 +277,17 @@ isInputOnly(WrapTrieadOwner *self)
 #// reverse => 0/1
 #// (optional) Flag: this Nexus goes in the reverse direction. Default: 0.
 #//
+#// unicast => 0/1
+#// (optional) Flag: each tray written into this Nexus goes to only one reader,
+#// the one with the shortest queue. Default: 0.
+#//
+#// partition => [ $labelName => [ @keyFields ], ... ]
+#// (optional) Partition the Nexus by the keys: each row of a label listed here
+#// goes to only one reader, selected by the hash of the key fields, so that
+#// all the rows with the same key go to the same reader. The rows of the other
+#// labels go to all the readers that get any data from the same tray.
+#// Implies the unicast mode. Default: not partitioned.
+#//
 #// chainFront => 0/1
 #// (optional) Flag: when the labels are specified as $fromLabel, chain them
 #// at the front. Default: 1.
@@ -287,6 +298,12 @@ isInputOnly(WrapTrieadOwner *self)
 #// twice that many trays before the future writes block. (Optional, the
 #// default is whatever picked by the C++ code in Facet::DEFAULT_QUEUE_LIMIT, 500 or so).
 #//
+#// queueRing => 0/1
+#// (optional) Flag: the queues of this Nexus use the lock-free ring buffers
+#// instead of the double-buffering under a mutex, to reduce the overhead of
+#// passing many small trays. Ignored for the reverse nexuses and the very
+#// large queue limits. Default: 0.
+#//
 #// import => $importType
 #// A string value, essentially an enum, determining how this Nexus gets
 #// immediately imported back into this thread. The supported values are:
@@ -313,10 +330,13 @@ makeNexus(WrapTrieadOwner *self, ...)
 			AV *labels = NULL;
 			AV *rowTypes = NULL;
 			AV *tableTypes = NULL;
+			AV *partition = NULL;
 			string name;
 			bool reverse = false;
+			bool unicast = false;
 			bool chainFront = true;
 			int qlimit = -1; // "default"
+			bool qring = false;
 			string import; // the import type
 			bool writer;
 
@@ -336,12 +356,18 @@ makeNexus(WrapTrieadOwner *self, ...)
 					tableTypes = GetSvArray(arg, "%s: option '%s'", funcName, optname);
 				} else if (!strcmp(optname, "reverse")) {
 					reverse = SvTRUE(arg);
+				} else if (!strcmp(optname, "unicast")) {
+					unicast = SvTRUE(arg);
+				} else if (!strcmp(optname, "partition")) {
+					partition = GetSvArray(arg, "%s: option '%s'", funcName, optname);
 				} else if (!strcmp(optname, "chainFront")) {
 					chainFront = SvTRUE(arg);
 				} else if (!strcmp(optname, "queueLimit")) {
 					qlimit = GetSvInt(arg, "%s: option '%s'", funcName, optname);
 					if (qlimit <= 0)
 						throw Exception::f("%s: option '%s' must be >0, got %d", funcName, optname, qlimit);
+				} else if (!strcmp(optname, "queueRing")) {
+					qring = SvTRUE(arg);
 				} else if (!strcmp(optname, "import")) {
 					GetSvString(import, arg, "%s: option '%s'", funcName, optname);
 				} else {
@@ -376,8 +402,26 @@ makeNexus(WrapTrieadOwner *self, ...)
 			// now make the Facet out it
 			Autoref<Facet> fa = new Facet(fret, writer);
 			fa->setReverse(reverse);
+			fa->setUnicast(unicast);
 			if (qlimit > 0)
 				fa->setQueueLimit(qlimit);
+			fa->setQueueRing(qring);
+
+			if (partition) {
+				len = av_len(partition)+1; // av_len returns the index of last element
+				if (len % 2 != 0)
+					throw Exception::f("%s: option 'partition' must contain the pairs of label names and keys, got %d elements", funcName, len);
+				for (i = 0; i < len; i+=2) {
+					SV *svname, *svval;
+					svname = *av_fetch(partition, i, 0);
+					svval = *av_fetch(partition, i+1, 0);
+
+					string elname;
+					GetSvString(elname, svname, "%s: option 'partition' element %d name", funcName, i+1);
+
+					fa->setPartitionKey(elname, parseNameSet(funcName, "partition", svval));
+				}
+			}
 
 			if (rowTypes) {
 				len = av_len(rowTypes)+1; // av_len returns the index of last element
@@ -625,6 +669,27 @@ flushWriters(WrapTrieadOwner *self)
 	OUTPUT:
 		RETVAL
 
+int
+flushWritersDue(WrapTrieadOwner *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = 0;
+		try { do {
+			RETVAL = self->get()->flushWritersDue();
+		} while(0); } TRICEPS_CATCH_CROAK;
+	OUTPUT:
+		RETVAL
+
+#// the time in microseconds until flushWritersDue() has to be called,
+#// or -1 if there is no such time
+IV
+flushDueUs(WrapTrieadOwner *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->flushDueUs();
+	OUTPUT:
+		RETVAL
+
 void
 requestMyselfDead(WrapTrieadOwner *self)
 	CODE:
@@ -695,6 +760,20 @@ mainLoop(WrapTrieadOwner *self)
 			self->get()->mainLoop();
 		} while(0); } TRICEPS_CATCH_CROAK;
 
+void
+setQueueSpin(WrapTrieadOwner *self, int spin)
+	CODE:
+		clearErrMsg();
+		self->get()->setQueueSpin(spin);
+
+int
+getQueueSpin(WrapTrieadOwner *self)
+	CODE:
+		clearErrMsg();
+		RETVAL = self->get()->getQueueSpin();
+	OUTPUT:
+		RETVAL
+
 bool
 isRqDrain(WrapTrieadOwner *self)
 	CODE:
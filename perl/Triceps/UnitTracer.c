@@ -0,0 +1,747 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of UnitTracer.xs. Do not edit this file, edit UnitTracer.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "UnitTracer.xs"
+//
+// (C) Copyright 2011-2015 Sergey A. Babkin.
+// This file is a part of Triceps.
+// See the file COPYRIGHT for the copyright notice and license information
+//
+// The wrapper for Unit::Tracer and its subclasses.
+
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "TricepsPerl.h"
+#include "PerlCallback.h"
+
+// see also translateUnitTracerSubclass() in TricepsPerl.*
+
+#line 29 "UnitTracer.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 173 "UnitTracer.c"
+
+XS_EUPXS(XS_Triceps__UnitTracer_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracer_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 25 "UnitTracer.xs"
+		RETVAL = 1;
+#line 186 "UnitTracer.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracer_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracer_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracer::DESTROY(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracer::DESTROY(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 32 "UnitTracer.xs"
+		// warn("UnitTracer destroyed!");
+		delete self;
+#line 215 "UnitTracer.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracer___testSuperclassCall); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracer___testSuperclassCall)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracer::__testSuperclassCall(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracer::__testSuperclassCall(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 40 "UnitTracer.xs"
+		RETVAL = 1;
+#line 243 "UnitTracer.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracer_same); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracer_same)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "self, other");
+    {
+	int	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+	WrapUnitTracer *	other;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracer::same(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracer::same(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+
+	if( sv_isobject(ST(1)) && (SvTYPE(SvRV(ST(1))) == SVt_PVMG) ) {
+		other = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(1) ));
+		if (other == 0 || other->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracer::same(): other has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracer::same(): other is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 48 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *t = self->get();
+		Unit::Tracer *ot = other->get();
+		RETVAL = (t == ot);
+#line 287 "UnitTracer.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerStringName_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerStringName_new)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "CLASS, ...");
+    {
+	WrapUnitTracer *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+#line 62 "UnitTracer.xs"
+		static char funcName[] =  "Triceps::UnitTracerStringName::new";
+		RETVAL = NULL; // shut up the warning
+		try { do {
+			clearErrMsg();
+			// defaults for options
+			bool verbose = false;
+
+			if (items % 2 != 1) {
+				throw Exception::f("Usage: %s(CLASS, optionName, optionValue, ...), option names and values must go in pairs", funcName);
+			}
+			for (int i = 1; i < items; i += 2) {
+				const char *optname = (const char *)SvPV_nolen(ST(i));
+				if (!strcmp(optname, "verbose")) {
+					verbose = (SvIV(ST(i+1)) != 0);
+				} else {
+					throw Exception::f("%s: unknown option '%s'", funcName, optname);
+				}
+			}
+
+			// for casting of return value
+			RETVAL = new WrapUnitTracer(new Unit::StringNameTracer(verbose));
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 328 "UnitTracer.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerStringName_print); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerStringName_print)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerStringName::print(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerStringName::print(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 91 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::StringNameTracer *sntr = dynamic_cast<Unit::StringNameTracer *>(tracer);
+		if (sntr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		string msg = sntr->getBuffer()->print();
+		RETVAL = (char *)msg.c_str();
+#line 368 "UnitTracer.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerStringName_clearBuffer); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerStringName_clearBuffer)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerStringName::clearBuffer(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerStringName::clearBuffer(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 104 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::StringNameTracer *sntr = dynamic_cast<Unit::StringNameTracer *>(tracer);
+		if (sntr != NULL)
+			sntr->clearBuffer();
+#line 401 "UnitTracer.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerStringName___testSubclassCall); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerStringName___testSubclassCall)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerStringName::__testSubclassCall(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerStringName::__testSubclassCall(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 114 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::StringNameTracer *sntr = dynamic_cast<Unit::StringNameTracer *>(tracer);
+		if (sntr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		RETVAL = (char *)"UnitTracerStringName";
+#line 434 "UnitTracer.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_new)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "CLASS");
+    {
+	WrapUnitTracer *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+#line 129 "UnitTracer.xs"
+		clearErrMsg();
+		RETVAL = new WrapUnitTracer(new Unit::ProfilingTracer);
+#line 456 "UnitTracer.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_snapshot); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_snapshot)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	RETVAL;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerProfiling::snapshot(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerProfiling::snapshot(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 139 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		Unit::ProfilingTracer::LabelStatsVec st;
+		ptr->snapshot(st);
+		for (size_t i = 0; i < st.size(); i++) {
+			HV *hash = newHV();
+			hv_store(hash, "unit", 4, newSVpvn(st[i].unitName_.c_str(), st[i].unitName_.size()), 0);
+			hv_store(hash, "label", 5, newSVpvn(st[i].labelName_.c_str(), st[i].labelName_.size()), 0);
+			hv_store(hash, "calls", 5, newSViv(st[i].calls_), 0);
+			hv_store(hash, "inclusive", 9, newSViv(st[i].inclusiveNs_), 0);
+			hv_store(hash, "self", 4, newSViv(st[i].selfNs_), 0);
+			hv_store(hash, "max", 3, newSViv(st[i].maxNs_), 0);
+			AV *hist = newAV();
+			for (int j = 0; j < Unit::ProfilingTracer::HIST_SIZE; j++)
+				av_push(hist, newSViv(st[i].hist_[j]));
+			hv_store(hash, "hist", 4, newRV_noinc((SV *)hist), 0);
+			XPUSHs(sv_2mortal(newRV_noinc((SV *)hash)));
+		}
+#line 511 "UnitTracer.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_snapshotUnits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_snapshotUnits)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	RETVAL;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerProfiling::snapshotUnits(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerProfiling::snapshotUnits(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 166 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		Unit::ProfilingTracer::UnitStatsVec st;
+		ptr->snapshotUnits(st);
+		for (size_t i = 0; i < st.size(); i++) {
+			HV *hash = newHV();
+			hv_store(hash, "unit", 4, newSVpvn(st[i].unitName_.c_str(), st[i].unitName_.size()), 0);
+			hv_store(hash, "calls", 5, newSViv(st[i].calls_), 0);
+			hv_store(hash, "self", 4, newSViv(st[i].selfNs_), 0);
+			XPUSHs(sv_2mortal(newRV_noinc((SV *)hash)));
+		}
+#line 554 "UnitTracer.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_reset); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerProfiling_reset)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerProfiling::reset(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerProfiling::reset(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 184 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr != NULL)
+			ptr->reset();
+#line 585 "UnitTracer.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerProfiling___testSubclassCall); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerProfiling___testSubclassCall)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerProfiling::__testSubclassCall(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerProfiling::__testSubclassCall(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 194 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		RETVAL = (char *)"UnitTracerProfiling";
+#line 618 "UnitTracer.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerPerl_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerPerl_new)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "CLASS, ...");
+    {
+	WrapUnitTracer *	RETVAL;
+	char *	CLASS = (char *)SvPV_nolen(ST(0))
+;
+#line 209 "UnitTracer.xs"
+		static char funcName[] =  "Triceps::UnitTracerPerl::new";
+		RETVAL = NULL; // shut up the warning
+		try { do {
+			clearErrMsg();
+
+			Onceref<PerlCallback> cb = new PerlCallback();
+			PerlCallbackInitialize(cb, funcName, 1, items-1); // may throw
+
+			RETVAL = new WrapUnitTracer(new UnitTracerPerl(cb));
+		} while(0); } TRICEPS_CATCH_CROAK;
+#line 648 "UnitTracer.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv( RETVALSV, CLASS, (void*)RETVAL );
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Triceps__UnitTracerPerl___testSubclassCall); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Triceps__UnitTracerPerl___testSubclassCall)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "self");
+    {
+	char *	RETVAL;
+	dXSTARG;
+	WrapUnitTracer *	self;
+
+	if( sv_isobject(ST(0)) && (SvTYPE(SvRV(ST(0))) == SVt_PVMG) ) {
+		self = (WrapUnitTracer *)SvIV((SV*)SvRV( ST(0) ));
+		if (self == 0 || self->badMagic()) {
+			croakWithMsg( "Triceps::UnitTracerPerl::__testSubclassCall(): self has an incorrect magic for WrapUnitTracerPtr" );
+		}
+	} else{
+		croakWithMsg( "Triceps::UnitTracerPerl::__testSubclassCall(): self is not a blessed SV reference to WrapUnitTracerPtr" );
+	}
+;
+#line 226 "UnitTracer.xs"
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		UnitTracerPerl *ptr = dynamic_cast<UnitTracerPerl *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		RETVAL = (char *)"UnitTracerPerl";
+#line 687 "UnitTracer.c"
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Triceps__UnitTracer); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Triceps__UnitTracer)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Triceps::UnitTracer::CLONE_SKIP", XS_Triceps__UnitTracer_CLONE_SKIP);
+        newXS_deffile("Triceps::UnitTracer::DESTROY", XS_Triceps__UnitTracer_DESTROY);
+        newXS_deffile("Triceps::UnitTracer::__testSuperclassCall", XS_Triceps__UnitTracer___testSuperclassCall);
+        newXS_deffile("Triceps::UnitTracer::same", XS_Triceps__UnitTracer_same);
+        newXS_deffile("Triceps::UnitTracerStringName::new", XS_Triceps__UnitTracerStringName_new);
+        newXS_deffile("Triceps::UnitTracerStringName::print", XS_Triceps__UnitTracerStringName_print);
+        newXS_deffile("Triceps::UnitTracerStringName::clearBuffer", XS_Triceps__UnitTracerStringName_clearBuffer);
+        newXS_deffile("Triceps::UnitTracerStringName::__testSubclassCall", XS_Triceps__UnitTracerStringName___testSubclassCall);
+        newXS_deffile("Triceps::UnitTracerProfiling::new", XS_Triceps__UnitTracerProfiling_new);
+        newXS_deffile("Triceps::UnitTracerProfiling::snapshot", XS_Triceps__UnitTracerProfiling_snapshot);
+        newXS_deffile("Triceps::UnitTracerProfiling::snapshotUnits", XS_Triceps__UnitTracerProfiling_snapshotUnits);
+        newXS_deffile("Triceps::UnitTracerProfiling::reset", XS_Triceps__UnitTracerProfiling_reset);
+        newXS_deffile("Triceps::UnitTracerProfiling::__testSubclassCall", XS_Triceps__UnitTracerProfiling___testSubclassCall);
+        newXS_deffile("Triceps::UnitTracerPerl::new", XS_Triceps__UnitTracerPerl_new);
+        newXS_deffile("Triceps::UnitTracerPerl::__testSubclassCall", XS_Triceps__UnitTracerPerl___testSubclassCall);
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
@@ -120,6 +120,86 @@ __testSubclassCall(WrapUnitTracer *self)
 	OUTPUT:
 		RETVAL
 
+MODULE = Triceps::UnitTracer		PACKAGE = Triceps::UnitTracerProfiling
+###################################################################################
+
+WrapUnitTracer *
+new(char *CLASS)
+	CODE:
+		clearErrMsg();
+		RETVAL = new WrapUnitTracer(new Unit::ProfilingTracer);
+	OUTPUT:
+		RETVAL
+
+#// returns a list of hash references, one per label, in the order of
+#// decreasing self time
+SV *
+snapshot(WrapUnitTracer *self)
+	PPCODE:
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		Unit::ProfilingTracer::LabelStatsVec st;
+		ptr->snapshot(st);
+		for (size_t i = 0; i < st.size(); i++) {
+			HV *hash = newHV();
+			hv_store(hash, "unit", 4, newSVpvn(st[i].unitName_.c_str(), st[i].unitName_.size()), 0);
+			hv_store(hash, "label", 5, newSVpvn(st[i].labelName_.c_str(), st[i].labelName_.size()), 0);
+			hv_store(hash, "calls", 5, newSViv(st[i].calls_), 0);
+			hv_store(hash, "inclusive", 9, newSViv(st[i].inclusiveNs_), 0);
+			hv_store(hash, "self", 4, newSViv(st[i].selfNs_), 0);
+			hv_store(hash, "max", 3, newSViv(st[i].maxNs_), 0);
+			AV *hist = newAV();
+			for (int j = 0; j < Unit::ProfilingTracer::HIST_SIZE; j++)
+				av_push(hist, newSViv(st[i].hist_[j]));
+			hv_store(hash, "hist", 4, newRV_noinc((SV *)hist), 0);
+			XPUSHs(sv_2mortal(newRV_noinc((SV *)hash)));
+		}
+
+#// returns a list of hash references, one per unit name, in the order of
+#// decreasing self time
+SV *
+snapshotUnits(WrapUnitTracer *self)
+	PPCODE:
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		Unit::ProfilingTracer::UnitStatsVec st;
+		ptr->snapshotUnits(st);
+		for (size_t i = 0; i < st.size(); i++) {
+			HV *hash = newHV();
+			hv_store(hash, "unit", 4, newSVpvn(st[i].unitName_.c_str(), st[i].unitName_.size()), 0);
+			hv_store(hash, "calls", 5, newSViv(st[i].calls_), 0);
+			hv_store(hash, "self", 4, newSViv(st[i].selfNs_), 0);
+			XPUSHs(sv_2mortal(newRV_noinc((SV *)hash)));
+		}
+
+void
+reset(WrapUnitTracer *self)
+	CODE:
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr != NULL)
+			ptr->reset();
+
+#// to test a subclass call
+char *
+__testSubclassCall(WrapUnitTracer *self)
+	CODE:
+		clearErrMsg();
+		Unit::Tracer *tracer = self->get();
+		Unit::ProfilingTracer *ptr = dynamic_cast<Unit::ProfilingTracer *>(tracer);
+		if (ptr == NULL)
+			XSRETURN_UNDEF; // not croak!
+		RETVAL = (char *)"UnitTracerProfiling";
+	OUTPUT:
+		RETVAL
+
 MODULE = Triceps::UnitTracer		PACKAGE = Triceps::UnitTracerPerl
 ###################################################################################
 
@@ -229,6 +229,7 @@ Triceps::sigusr2_setup();
 require Triceps::Fields;
 require Triceps::Unit;
 require Triceps::UnitTracerPerl;
+require Triceps::UnitTracerProfiling;
 require Triceps::UnitTracerStringName;
 require Triceps::Row;
 require Triceps::Rowop;
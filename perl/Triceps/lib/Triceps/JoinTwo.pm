@@ -92,6 +92,12 @@ use strict;
 # overrideKeyTypes (optional) - flag: allow the key types to be not exactly the same
 #    (default: 0)
 #
+# Whenever possible, the join is executed by the native C++ JoinTwo, with
+# the patterns resolved here into the explicit lists of fields. The pair
+# of the Perl LookupJoins is used only when the native version can not do
+# the job: with leftSaveJoinerTo or rightSaveJoinerTo, or when the types
+# of the key fields on the left and right side are not exactly the same.
+#
 sub new # (class, optionName => optionValue ...)
 {
 	my $myname = "Triceps::JoinTwo::new";
@@ -277,6 +283,9 @@ sub new # (class, optionName => optionValue ...)
 		@rightkeys = @newright;
 	}
 
+	# the native C++ join can be used if the key types match exactly
+	# and nobody wants to see the Perl joiner code
+	my $native = !defined($self->{leftSaveJoinerTo}) && !defined($self->{rightSaveJoinerTo});
 	my (@leftby, @rightby); # build the "by" specifications for LookupJoin
 	for ($i = 0; $i <= $#leftkeys; $i++) { # check that the array-ness matches
 		push @leftby, $leftkeys[$i], $rightkeys[$i];
@@ -302,6 +311,7 @@ sub new # (class, optionName => optionValue ...)
 					. $rightkeys[$i] . " " . $rightType)
 				unless ($leftType eq $rightType);
 		}
+		$native = 0 unless ($leftType eq $rightType);
 	}
 
 	my $fieldsMirrorKey = 1;
@@ -330,6 +340,54 @@ sub new # (class, optionName => optionValue ...)
 		Carp::confess("Unknown value '" . $self->{fieldsUniqKey} . "' of option 'fieldsUniqKey', must be one of none|manual|left|right|first");
 	}
 
+	if ($native) {
+		# resolve the field patterns into the explicit lists of fields,
+		# the key uniqueness is already applied to the patterns above
+		my %choice = (
+			left => \@leftfld,
+			right => \@rightfld,
+		);
+		my (%srcfld, %resfld, %resultmap, @resultfld);
+		my @order = ($self->{fieldsLeftFirst} ? ("left", "right") : ("right", "left"));
+		for my $side (@order) {
+			my $orig = $choice{$side};
+			my @trans = &Triceps::Fields::filter("$myname: option '${side}Fields'", $orig, $self->{"${side}Fields"});
+			for (my $i = 0; $i <= $#trans; $i++) {
+				my $f = $trans[$i];
+				next unless defined $f;
+				if (exists $resultmap{$f}) {
+					Carp::confess("A duplicate field '$f' is produced from  ${side}-side field '"
+						. $orig->[$i] . "'; the preceding fields are: (" . join(", ", @resultfld) . ")" )
+				}
+				push @resultfld, $f;
+				$resultmap{$f} = $#resultfld;
+				push @{$srcfld{$side}}, $orig->[$i];
+				push @{$resfld{$side}}, $f;
+			}
+		}
+
+		Triceps::wrapfess
+			"$myname internal error: failed to create the native join:",
+			sub { $self->{native} = Triceps::JoinTwoNative->new($self->{name},
+				$self->{leftTable}, $self->{rightTable}, $self->{leftIdxType}, $self->{rightIdxType},
+				$self->{leftFromLabel}, $self->{rightFromLabel}, \@leftby,
+				$srcfld{left} || [], $resfld{left} || [], $srcfld{right} || [], $resfld{right} || [],
+				$self->{fieldsLeftFirst}, ($fieldsMirrorKey? "manual" : "none"),
+				$self->{type}, $self->{overrideSimpleMinded}); };
+
+		$self->{resultRowType} = $self->{native}->getResultRowType();
+		$self->{outputLabel} = $self->{native}->getOutputLabel();
+
+		delete $self->{leftFromLabel}; 
+		delete $self->{rightFromLabel};
+
+		# make a clearing label, since there is no input label in this object
+		$self->{clearingLabel} = $self->{unit}->makeClearingLabel($self->{name} . ".clear", $self);
+
+		bless $self, $class;
+		return $self;
+	}
+
 	# now create the LookupJoins
 	$self->{leftLookup} = Triceps::LookupJoin->new(
 		unit => $self->{unit},
@@ -367,7 +425,8 @@ sub new # (class, optionName => optionValue ...)
 	);
 
 	# create the output label
-	$self->{outputLabel} = $self->{unit}->makeDummyLabel($self->{leftLookup}->getResultRowType(), $self->{name} . ".out");
+	$self->{resultRowType} = $self->{leftLookup}->getResultRowType();
+	$self->{outputLabel} = $self->{unit}->makeDummyLabel($self->{resultRowType}, $self->{name} . ".out");
 
 	# and connect them together
 	$self->{leftFromLabel}->chain($self->{leftLookup}->getInputLabel());
@@ -389,7 +448,7 @@ sub new # (class, optionName => optionValue ...)
 sub getResultRowType # (self)
 {
 	my $self = shift;
-	return $self->{leftLookup}->getResultRowType();
+	return $self->{resultRowType};
 }
 
 sub getOutputLabel # (self)
@@ -488,6 +547,13 @@ sub getOverrideKeyTypes # (self)
 	return $self->{overrideKeyTypes};
 }
 
+# Check whether the join is executed by the native C++ code.
+sub isNative # (self)
+{
+	my $self = shift;
+	return (defined $self->{native}? 1 : 0);
+}
+
 # Similar to Table's fnReturn(), creates the FnReturn on the first call.
 # The resulting FnReturn has one label "out".
 sub fnReturn # (self)
@@ -87,6 +87,12 @@ use strict;
 # saveJoinerTo (optional, ref to a scalar) - where to save a copy of the joiner function
 #    source code
 #
+# Whenever possible, the join is executed by the native C++ LookupJoin, with
+# the patterns resolved here into the explicit lists of fields. The generated
+# Perl joiner is used only when the native version can not do the job:
+# with oppositeOuter (and groupSizeCode), with saveJoinerTo, or when the
+# types of the key fields on the left and right side are not exactly the same.
+#
 sub new # (class, optionName => optionValue ...)
 {
 	my $myname = "Triceps::LookupJoin::new";
@@ -231,6 +237,7 @@ sub new # (class, optionName => optionValue ...)
 				';
 	my @bykeys;
 	my %leftkeys;
+	my $native = !$self->{oppositeOuter} && !defined($self->{saveJoinerTo});
 	my @cpby = @{$self->{by}};
 	while ($#cpby >= 0) {
 		my $lf = shift @cpby;
@@ -251,6 +258,7 @@ sub new # (class, optionName => optionValue ...)
 
 		Carp::confess("Option 'by' fields '$lf'='$rt' mismatch the array-ness, with types '$lf_type' and '$rt_type'")
 			unless ($lf_arr == $rt_arr);
+		$native = 0 unless ($lf_type eq $rt_type);
 		
 		$genjoin .= '"' . quotemeta($rt) . '" => $leftdata[' . $leftmap{$lf} . "],\n\t\t\t\t";
 	}
@@ -285,6 +293,8 @@ sub new # (class, optionName => optionValue ...)
 	my @resultdef;
 	my %resultmap; 
 	my @resultfld;
+	my %srcfld; # for the native join, the selected fields of each side
+	my %resfld; # for the native join, the names of these fields in the result
 	
 	# reference the variables for access by left/right iterator
 	my %choice = (
@@ -314,6 +324,8 @@ sub new # (class, optionName => optionValue ...)
 			push @resultdef, $f, $choice{"${side}def"}->[$index*2 + 1];
 			push @resultfld, $f;
 			$resultmap{$f} = $#resultfld; # fix the index
+			push @{$srcfld{$side}}, $orig->[$i];
+			push @{$resfld{$side}}, $f;
 			$genresdata .= '$' . $side . 'data[' . $index . "],\n\t\t\t\t";
 			if ($side eq "right") {
 				$genoppdata .= '$' . $side . 'data[' . $index . "],\n\t\t\t\t";
@@ -475,27 +487,41 @@ sub new # (class, optionName => optionValue ...)
 
 	#print STDERR "DEBUG $genjoin\n";
 
-	${$self->{saveJoinerTo}} = $genjoin if (defined($self->{saveJoinerTo}));
-	undef $@;
-	if ($auto) {
-		$self->{joinerAutomatic} = eval $genjoin; # compile!
+	if ($native) {
+		# the right-side keys are already excluded from rightFields if needed
+		Triceps::wrapfess
+			"$myname internal error: failed to create the native join:",
+			sub { $self->{native} = Triceps::LookupJoinNative->new($self->{unit}, $self->{name},
+				$self->{leftRowType}, $self->{rightTable}, $self->{rightIdxType}, $self->{by},
+				$srcfld{left} || [], $resfld{left} || [], $srcfld{right} || [], $resfld{right} || [],
+				$self->{fieldsLeftFirst}, $self->{fieldsMirrorKey}, $self->{isLeft}, $self->{limitOne}); };
+
+		$self->{resultRowType} = $self->{native}->getResultRowType();
+		$self->{inputLabel} = $self->{native}->getInputLabel();
+		$self->{outputLabel} = $self->{native}->getOutputLabel();
 	} else {
-		$self->{joiner} = eval $genjoin; # compile!
+		${$self->{saveJoinerTo}} = $genjoin if (defined($self->{saveJoinerTo}));
+		undef $@;
+		if ($auto) {
+			$self->{joinerAutomatic} = eval $genjoin; # compile!
+		} else {
+			$self->{joiner} = eval $genjoin; # compile!
+		}
+		# $@ already contains an \n at the end
+		Carp::confess("Internal error: LookupJoin failed to compile the joiner function:\n$@function text:\n"
+				. Triceps::Code::numalign($genjoin, "  ") . "\n")
+			if $@;
+
+		# now create the result row type
+		#print STDERR "DEBUG result type def = (", join(", ", @resultdef), ")\n"; # DEBUG
+		$self->{resultRowType} = Triceps::RowType->new(@resultdef);
+
+		# create the input label
+		$self->{inputLabel} = $self->{unit}->makeLabel($self->{leftRowType}, $self->{name} . ".in", 
+			undef, $auto? $self->{joinerAutomatic} : \&handleInput, $self);
+		# create the output label
+		$self->{outputLabel} = $self->{unit}->makeDummyLabel($self->{resultRowType}, $self->{name} . ".out");
 	}
-	# $@ already contains an \n at the end
-	Carp::confess("Internal error: LookupJoin failed to compile the joiner function:\n$@function text:\n"
-			. Triceps::Code::numalign($genjoin, "  ") . "\n")
-		if $@;
-
-	# now create the result row type
-	#print STDERR "DEBUG result type def = (", join(", ", @resultdef), ")\n"; # DEBUG
-	$self->{resultRowType} = Triceps::RowType->new(@resultdef);
-
-	# create the input label
-	$self->{inputLabel} = $self->{unit}->makeLabel($self->{leftRowType}, $self->{name} . ".in", 
-		undef, $auto? $self->{joinerAutomatic} : \&handleInput, $self);
-	# create the output label
-	$self->{outputLabel} = $self->{unit}->makeDummyLabel($self->{resultRowType}, $self->{name} . ".out");
 	
 	# chain the input label, if any
 	if (defined $self->{leftFromLabel}) {
@@ -523,6 +549,7 @@ sub lookup # (self, leftRow)
 	my ($self, $leftRow) = @_;
 	confess("Joiner '" . $self->{name} . "' was created with automatic option and does not support the manual lookup() call")
 		if ($self->{automatic});
+	return $self->{native}->lookup($leftRow) if (defined $self->{native});
 	my @result = &{$self->{joiner}}($self, $leftRow);
 	#print STDERR "DEBUG lookup result=(", join(", ", @result), ")\n";
 	return @result;
@@ -663,6 +690,13 @@ sub getGroupSizeCode # (self)
 	return $self->{groupSizeCode};
 }
 
+# Check whether the join is executed by the native C++ code.
+sub isNative # (self)
+{
+	my $self = shift;
+	return (defined $self->{native}? 1 : 0);
+}
+
 # Similar to Table's fnReturn(), creates the FnReturn on the first call.
 # The resulting FnReturn has one label "out".
 sub fnReturn # (self)
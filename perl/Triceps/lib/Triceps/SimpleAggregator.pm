@@ -15,8 +15,8 @@ use Carp;
 
 use strict;
 
-# Right now the aggregation functions work in a fairly dumb way,
-# never additive.
+# The aggregation functions in Perl work in a fairly dumb way,
+# never additive. The native C++ ones are additive.
 
 # Should normally not be accessed from outside the package.
 # The definition of built-in aggregation functions
@@ -93,6 +93,23 @@ our $FUNCTIONS = {
 	},
 };
 
+# Should normally not be accessed from outside the package.
+# The built-in functions that have a native C++ implementation in
+# SimpleAggregatorType. When all the fields of an aggregator use only
+# these functions, with the arguments given as field names, the aggregator
+# gets built as a native one, computing the results incrementally
+# without calling any Perl code.
+our $NATIVE_FUNCTIONS = {
+	first => 1,
+	last => 1,
+	count_star => 1,
+	count => 1,
+	sum => 1,
+	max => 1,
+	min => 1,
+	avg => 1,
+};
+
 # Make an aggregator and add it to a table type.
 # The arguments are passed in option form, name-value pairs.
 # Note: no $class argument!!!
@@ -103,11 +120,16 @@ our $FUNCTIONS = {
 #       the one where the aggregator is to be added
 #   result (reference to an array of result field definitions) - repeating groups
 #       fieldName => type, function, function_argument
+#       The function argument is either a Perl sub reference that computes it
+#       from a row, or a field name string.
+#       If all the functions are the built-in ones listed in $NATIVE_FUNCTIONS
+#       and all the arguments are field names, the aggregator is built
+#       as a native C++ SimpleAggregatorType.
 #   saveRowTypeTo (optional, ref to a scalar) - where to save a copy of the result row type
 #   saveInitTo (optional, ref to a scalar) - where to save a copy of the init function
 #       source code, the saved value may be undef if the init is not used
 #   saveComputeTo (optional, ref to a scalar) - where to save a copy of the compute
-#       function source code
+#       function source code, the saved value is undef for a native aggregator
 #   functions (optional, ref to a hash) - additional user-defined aggregation functions
 #       which may override the built-in ones. The format is the same as for $FUNCTIONS above.
 # @return - the same TableType, with added aggregator, or die
@@ -148,6 +170,8 @@ sub make # (optName => optValue, ...)
 	my $codeResult = ''; # code to compute the intermediate values for the result
 	my $codeBuild = ''; # code to build the result row
 	my @compArgs; # the field functions are passed as args to the computation
+	my $native = 1; # flag: all the fields can be computed by the native C++ aggregator
+	my @natDef; # the field definitions for the native aggregator
 	{
 		my $grpstep = 4; # definition grouped by 4 items per result field
 		my @resopt = @{$opts->{result}};
@@ -182,13 +206,24 @@ sub make # (optName => optValue, ...)
 			$argCount = 1 # 1 is the default value
 				unless defined($argCount);
 			$argCount += 0; # convert to a number for sure
-			confess("$myname: in field '$fld' function '$func' requires an argument computation that must be a Perl sub reference")
-				unless ($argCount == 0 || ref $funcarg eq 'CODE');
+			confess("$myname: in field '$fld' function '$func' requires an argument computation that must be a Perl sub reference or a field name")
+				unless ($argCount == 0 || ref $funcarg eq 'CODE' || (defined $funcarg && ref $funcarg eq ''));
 			confess("$myname: in field '$fld' function '$func' requires no argument, use undef as a placeholder")
 				unless ($argCount != 0 || !defined $funcarg);
 
 			push(@rtdefRes, $fld, $type);
 
+			# the built-in functions on the plain fields can be computed in C++
+			if (!exists $NATIVE_FUNCTIONS->{$func} || $funcDef != $FUNCTIONS->{$func}
+			|| ref $funcarg eq 'CODE') {
+				$native = 0;
+			}
+			push(@natDef, $fld, $func, $funcarg);
+			if (defined $funcarg && ref $funcarg eq '') {
+				my $argfld = $funcarg;
+				$funcarg = sub { $_[0]->get($argfld) };
+			}
+
 			push(@compArgs, $funcarg)
 				if (defined $funcarg);
 
@@ -253,6 +288,21 @@ sub make # (optName => optValue, ...)
 	}
 	${$opts->{saveRowTypeTo}} = $rtRes if (defined($opts->{saveRowTypeTo}));
 
+	if ($native) {
+		my $agg = Triceps::wrapfess
+			"$myname: failed to build an aggregator type:",
+			sub { Triceps::AggregatorType->newSimple($rtRes, $opts->{name}, @natDef); };
+
+		Triceps::wrapfess
+			"$myname: failed to set the aggregator in the index type:",
+			sub { $idx->setAggregator($agg); };
+
+		# there is no Perl source code for a native aggregator
+		${$opts->{saveInitTo}} = undef if (defined($opts->{saveInitTo}));
+		${$opts->{saveComputeTo}} = undef if (defined($opts->{saveComputeTo}));
+		return $opts->{tabType};
+	}
+
 	# build the computation function
 	my $compText;
 	$compText .= "  use strict;\n";
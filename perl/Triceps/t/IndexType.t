@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 244 };
+BEGIN { plan tests => 271 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -116,6 +116,94 @@ $it1 = eval { Triceps::IndexType->newOrdered(); };
 ok(!defined($it1));
 ok($@, qr/^Triceps::IndexType::newOrdered: the required option 'key' is missing at/);
 
+$it1 = eval { Triceps::IndexType->newOrdered(key => [ "a" ], normalizedKey => -1); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newOrdered: the option 'normalizedKey' must not be negative, got -1 at/);
+
+# the normalized key gives the same order as the field comparison,
+# the long strings don't fit and get compared by the fields
+{
+	my $rtn = Triceps::RowType->new(
+		s => "string",
+		n => "int64",
+	);
+	my $ttn = Triceps::TableType->new($rtn)
+		->addSubIndex("primary", Triceps::IndexType->newOrdered(
+			key => [ "!s", "n" ], normalizedKey => 12))
+	;
+	ok($ttn->initialize(), 1);
+	my $tn = Triceps::Unit->new("u")->makeTable($ttn, "tn");
+	foreach my $r (["b", 2], ["a", -5], ["b", -1], ["a long string", 3],
+	["a long string", -3], [undef, 1], ["b", undef], ["a", 7]) {
+		$tn->insert($rtn->makeRowArray(@$r));
+	}
+	my $res = "";
+	for (my $rh = $tn->begin(); !$rh->isNull(); $rh = $rh->next()) {
+		my @v = $rh->getRow()->toArray();
+		$res .= join(",", map { defined $_? $_ : "-" } @v) . ";";
+	}
+	ok($res, "b,-;b,-1;b,2;a long string,-3;a long string,3;a,-5;a,7;-,1;");
+}
+
+###################### newTop ################################
+
+$it1 = Triceps::IndexType->newTop(key => [ "!a", "b" ], limit => 10);
+ok(ref $it1, "Triceps::IndexType");
+$res = $it1->print();
+ok($res, "index TopIndex(!a, b, limit=10)");
+ok($it1->getIndexId(), &Triceps::IT_TOP);
+
+$key = join(",", $it1->getKeyExpr());
+ok($key, "!a,b");
+
+{
+	# the rows past the limit get pushed out
+	my $u = Triceps::Unit->new("u");
+	my $xrt = Triceps::RowType->new(a => "int32", b => "string");
+	my $xtt = Triceps::TableType->new($xrt)
+		->addSubIndex("top", Triceps::IndexType->newTop(key => [ "!a" ], limit => 2));
+	$xtt->initialize();
+	my $xt = $u->makeTable($xtt, "t");
+	ok($xt->insert($xrt->makeRowHash(a => 1, b => "x")));
+	ok($xt->insert($xrt->makeRowHash(a => 3, b => "y")));
+	ok($xt->insert($xrt->makeRowHash(a => 2, b => "z")));
+	ok(!$xt->insert($xrt->makeRowHash(a => 0, b => "w")));
+	my @vals;
+	for (my $rh = $xt->begin(); !$rh->isNull(); $rh = $rh->next()) {
+		push @vals, $rh->getRow()->get("a");
+	}
+	ok(join(",", @vals), "3,2");
+}
+
+$it1 = eval { Triceps::IndexType->newTop(key => [ "a" ]); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newTop: the option 'limit' must be a positive number, got 0 at/);
+
+$it1 = eval { Triceps::IndexType->newTop(limit => 10); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newTop: the required option 'key' is missing at/);
+
+$it1 = eval { Triceps::IndexType->newTop(key => [ "a" ], limit => 10, zzz => 1); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newTop: unknown option 'zzz' at/);
+
+###################### newTimeWindow ################################
+
+$it1 = Triceps::IndexType->newTimeWindow(field => "ts");
+ok(ref $it1, "Triceps::IndexType");
+$res = $it1->print();
+ok($res, "index TimeWindowIndex(ts)");
+ok($it1->getIndexId(), &Triceps::IT_TIMEWINDOW);
+ok(!defined $it1->getKey());
+
+$it1 = eval { Triceps::IndexType->newTimeWindow(); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newTimeWindow: the required option 'field' is missing at/);
+
+$it1 = eval { Triceps::IndexType->newTimeWindow(field => "ts", zzz => 1); };
+ok(!defined($it1));
+ok($@, qr/^Triceps::IndexType::newTimeWindow: unknown option 'zzz' at/);
+
 ###################### newFifo #################################
 
 $it1 = Triceps::IndexType->newFifo();
@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 173 };
+BEGIN { plan tests => 176 };
 use Triceps;
 use Carp;
 ok(1); # If we made it this far, we're ok.
@@ -1015,6 +1015,7 @@ join3r.rightLookup.out OP_INSERT source="source1" external="999" internal="4" rt
 	ok($join->getType(), "inner"); # the default
 	ok($join->getOverrideSimpleMinded(), 0); # the default
 	ok($join->getOverrideKeyTypes(), 0); # the default
+	ok($join->isNative());
 }
 {
 	my $join = Triceps::JoinTwo->new( 
@@ -1043,6 +1044,19 @@ join3r.rightLookup.out OP_INSERT source="source1" external="999" internal="4" rt
 	ok($join->getType(), "outer"); # the default
 	ok($join->getOverrideSimpleMinded(), 11); # the default
 	ok($join->getOverrideKeyTypes(), 12); # the default
+	ok($join->isNative()); # the key types are the same anyway
+}
+{
+	my $code;
+	my $join = Triceps::JoinTwo->new( 
+		name => "join",
+		leftTable => $tTrans3,
+		rightTable => $tAccounts3,
+		leftIdxPath => ["byAccount"],
+		rightIdxPath => ["lookupSrcExt"],
+		leftSaveJoinerTo => \$code,
+	);
+	ok(!$join->isNative()); # the Perl joiner is needed to save its code
 }
 
 #########
@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 248 };
+BEGIN { plan tests => 252 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -1129,6 +1129,7 @@ ok($result2, $expect2xg);
 		saveJoinerTo => \$code,
 	);
 	ok(ref $join, "Triceps::LookupJoin");
+	ok(!$join->isNative()); # the Perl joiner is needed to save its code
 	#print STDERR "code = $code\n";
 	ok($code =~ /^\s+sub  # \(\$self, \$row\)/);
 }
@@ -1192,6 +1193,7 @@ ok($result2, $expect2xg);
 	ok($join->getAutomatic(), 1); # the default
 	ok($join->getOppositeOuter(), 0); # the default
 	ok(! defined $join->getGroupSizeCode()); # the default
+	ok($join->isNative());
 }
 {
 	my $join = Triceps::LookupJoin->new( 
@@ -1499,6 +1501,41 @@ ok($@, qr/^A duplicate field 'acctSrc' is produced from  right-side field 'inter
 
 #print STDERR "err=$@\n";
 
+#########
+# the native join stays alive while its input label is alive,
+# even if the Perl object gets dropped
+
+{
+	my $vu3 = Triceps::Unit->new("vu3");
+	my $tAccounts3 = $vu3->makeTable($ttAccounts, "Accounts");
+	my $lbSrc = $vu3->makeDummyLabel($rtInTrans, "src");
+	my $res;
+	{
+		my $join = Triceps::LookupJoin->new(
+			name => "join",
+			leftFromLabel => $lbSrc,
+			rightTable => $tAccounts3,
+			rightFields => [ "internal/acct" ],
+			byLeft => [ "acctSrc/source", "acctXtrId/external" ],
+		);
+		ok($join->isNative());
+		$join->getOutputLabel()->makeChained("print", undef, sub {
+			$res .= $_[1]->printP() . "\n";
+		});
+	}
+	&feedInput($tAccounts3->getInputLabel(), &Triceps::OP_INSERT, \@accountData);
+	&feedInput($lbSrc, &Triceps::OP_INSERT, \@incomingData);
+	$vu3->drainFrame();
+	ok($res, 
+'join.out OP_INSERT acctSrc="source1" acctXtrId="999" amount="100" acct="1" 
+join.out OP_INSERT acctSrc="source2" acctXtrId="ABCD" amount="200" acct="1" 
+join.out OP_INSERT acctSrc="source3" acctXtrId="ZZZZ" amount="300" 
+join.out OP_INSERT acctSrc="source1" acctXtrId="2011" amount="400" acct="2" 
+join.out OP_INSERT acctSrc="source2" acctXtrId="ZZZZ" amount="500" 
+');
+	$vu3->clearLabels();
+}
+
 #########
 # clearing
 # MUST BE LAST because it will destroy everything in the unit
@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 41 };
+BEGIN { plan tests => 51 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -145,6 +145,29 @@ ok($rt2->match($rt1));
 
 ok(!$rt3->match($rt1));
 
+######################### aligned format ########################################
+
+$rt4 = Triceps::RowType->newAligned(
+	@def1
+);
+ok(ref $rt4, "Triceps::RowType");
+ok($rt4->isAligned());
+ok(!$rt1->isAligned());
+ok(join(",", $rt4->getdef()), join(",", @def1));
+# the different formats don't match
+ok(!$rt4->equals($rt1));
+ok(!$rt4->match($rt1));
+ok($rt4->equals(Triceps::RowType->newAligned(@def1)));
+
+$r4 = $rt4->makeRowArray("abc", 1, 2, undef, "def");
+ok(join(",", map { defined $_? $_ : "-" } $r4->toArray()), "abc,1,2,-,def");
+
+$rt2 = eval { Triceps::RowType->newAligned(
+	a => "void",
+); };
+ok(!defined $rt2);
+ok($@, qr/^Triceps::RowType::newAligned: incorrect specification:\n  field 'a' type must not be void\nTriceps::RowType::newAligned: The specification was: \{\n  a => void\n\} at/);
+
 ########################### print ##########################################
 
 $v = $rt1->print();
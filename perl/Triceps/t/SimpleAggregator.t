@@ -16,7 +16,7 @@ use ExtUtils::testlib;
 use Carp;
 
 use Test;
-BEGIN { plan tests => 71 };
+BEGIN { plan tests => 80 };
 use Triceps;
 use Triceps::X::TestFeed qw(:all);
 ok(1); # If we made it this far, we're ok.
@@ -540,11 +540,11 @@ ok($@, qr/^Triceps::SimpleAggregator::make: function 'nosuch' is unknown/);
 
 tryBadOptValue(
 		result => [
-			symbol => "string", "first", 
+			symbol => "string", "first", [ "symbol" ],
 			id => "int32", "last", sub {$_[0]->get("id");},
 		],
 );
-ok($@, qr/^Triceps::SimpleAggregator::make: in field 'symbol' function 'first' requires an argument computation that must be a Perl sub reference/);
+ok($@, qr/^Triceps::SimpleAggregator::make: in field 'symbol' function 'first' requires an argument computation that must be a Perl sub reference or a field name/);
 
 tryBadOptValue(
 		result => [
@@ -706,3 +706,109 @@ t.myAggr OP_INSERT symbol="AAA" id="2" maxsize="200" minsize="100" count="2" avg
 t.myAggr OP_DELETE symbol="AAA" id="2" maxsize="200" minsize="100" count="2" avg="150" avgperl="150" xsum="1300" 
 t.myAggr OP_INSERT symbol="AAA" id="3" maxsize="200" minsize="50" count="2" avg="125" avgperl="125" xsum="1250" 
 ');
+
+#########################
+# the native C++ aggregator, with the arguments specified as field names
+$ttWindow = &makeTtWindow();
+
+$compText = 1;
+$initText = 1;
+undef $rtAggr;
+$res = Triceps::SimpleAggregator::make(
+	tabType => $ttWindow,
+	name => "myAggr",
+	idxPath => [ "bySymbol", "last2" ],
+	result => [
+		symbol => "string", "first", "symbol",
+		id => "int32", "last", "id",
+		maxsize => "float64", "max", "size",
+		minsize => "float64", "min", "size",
+		count => "int32", "count", "size",
+		avg => "float64", "avg", "size",
+		sum => "float64", "sum", "size",
+		rows => "int64", "count_star", undef,
+	],
+	saveRowTypeTo => \$rtAggr,
+	saveComputeTo => \$compText,
+	saveInitTo => \$initText,
+);
+ok(ref $res, "Triceps::TableType");
+ok(ref $rtAggr, "Triceps::RowType");
+ok(!defined($compText));
+ok(!defined($initText));
+ok($ttWindow->findIndexPath("bySymbol", "last2")->getAggregator()->print(undef),
+	"aggregator ( row { string symbol, int32 id, float64 maxsize, float64 minsize, int32 count, float64 avg, float64 sum, int64 rows, } ) myAggr { symbol=first(symbol) id=last(id) maxsize=max(size) minsize=min(size) count=count(size) avg=avg(size) sum=sum(size) rows=count_star() }");
+
+setInputLines(
+	"OP_INSERT,1,AAA,10,\n",
+	"OP_INSERT,2,AAA,10,100\n",
+	"OP_INSERT,3,AAA,10,200\n",
+	"OP_INSERT,4,AAA,10,50\n",
+	"OP_DELETE,4\n",
+	"OP_DELETE,3\n",
+);
+&runExample($uTrades, $ttWindow, "myAggr");
+#print &getResultLines();
+# the row with min value gets pushed out of the window by the limit
+ok(&getResultLines(), 
+'> OP_INSERT,1,AAA,10,
+t.myAggr OP_INSERT symbol="AAA" id="1" count="0" sum="0" rows="1" 
+> OP_INSERT,2,AAA,10,100
+t.myAggr OP_DELETE symbol="AAA" id="1" count="0" sum="0" rows="1" 
+t.myAggr OP_INSERT symbol="AAA" id="2" maxsize="100" minsize="100" count="1" avg="100" sum="100" rows="2" 
+> OP_INSERT,3,AAA,10,200
+t.myAggr OP_DELETE symbol="AAA" id="2" maxsize="100" minsize="100" count="1" avg="100" sum="100" rows="2" 
+t.myAggr OP_INSERT symbol="AAA" id="3" maxsize="200" minsize="100" count="2" avg="150" sum="300" rows="2" 
+> OP_INSERT,4,AAA,10,50
+t.myAggr OP_DELETE symbol="AAA" id="3" maxsize="200" minsize="100" count="2" avg="150" sum="300" rows="2" 
+t.myAggr OP_INSERT symbol="AAA" id="4" maxsize="200" minsize="50" count="2" avg="125" sum="250" rows="2" 
+> OP_DELETE,4
+t.myAggr OP_DELETE symbol="AAA" id="4" maxsize="200" minsize="50" count="2" avg="125" sum="250" rows="2" 
+t.myAggr OP_INSERT symbol="AAA" id="3" maxsize="200" minsize="200" count="1" avg="200" sum="200" rows="1" 
+> OP_DELETE,3
+t.myAggr OP_DELETE symbol="AAA" id="3" maxsize="200" minsize="200" count="1" avg="200" sum="200" rows="1" 
+');
+
+# a mix of field names and Perl functions goes the Perl way
+$ttWindow = &makeTtWindow();
+$res = Triceps::SimpleAggregator::make(
+	tabType => $ttWindow,
+	name => "myAggr",
+	idxPath => [ "bySymbol", "last2" ],
+	result => [
+		symbol => "string", "first", "symbol",
+		id => "int32", "last", sub {$_[0]->get("id");},
+		sum => "float64", "sum", "size",
+	],
+	saveComputeTo => \$compText,
+);
+ok(defined($compText));
+
+# an overridden function goes the Perl way too
+$ttWindow = &makeTtWindow();
+$res = Triceps::SimpleAggregator::make(
+	tabType => $ttWindow,
+	name => "myAggr",
+	idxPath => [ "bySymbol", "last2" ],
+	result => [
+		symbol => "string", "first", "symbol",
+		sum => "float64", "sum", "size",
+	],
+	saveComputeTo => \$compText,
+	functions => $test_functions,
+);
+ok(defined($compText));
+
+# the errors get detected on the table type initialization
+$ttWindow = &makeTtWindow();
+$res = Triceps::SimpleAggregator::make(
+	tabType => $ttWindow,
+	name => "myAggr",
+	idxPath => [ "bySymbol", "last2" ],
+	result => [
+		symbol => "string", "sum", "symbol",
+		id => "int32", "last", "nosuch",
+	],
+);
+eval { $ttWindow->initialize(); };
+ok($@, qr/^index error:\n  nested index 2 'bySymbol':\n    nested index 1 'last2':\n      aggregator 'myAggr':\n        the result field 'symbol' function 'sum' requires a numeric scalar argument field, 'symbol' is not\n        the result field 'symbol' of function 'sum' must be a numeric scalar\n        the result field 'id' function 'last' refers to an unknown argument field 'nosuch'/);
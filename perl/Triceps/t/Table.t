@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 258 };
+BEGIN { plan tests => 287 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -978,3 +978,102 @@ $fret1->pop($fbind1);
 
 ok($seenDelete, 1);
 }
+
+############################## range search ##########################################
+
+{
+	my $u9 = Triceps::Unit->new("u9");
+
+	my $tt9 = Triceps::TableType->new($rt1)
+		->addSubIndex("b", Triceps::IndexType->newOrdered(key => ["b"])
+			->addSubIndex("c", Triceps::IndexType->newOrdered(key => ["c"]))
+		)
+		->addSubIndex("fifo", Triceps::IndexType->newFifo())
+		;
+	ok($tt9->initialize(), 1);
+
+	my $itb = $tt9->findSubIndex("b");
+	my $itc = $itb->findSubIndex("c");
+	my $itf = $tt9->findSubIndex("fifo");
+
+	my $t9 = $u9->makeTable($tt9, "t9");
+	ok(ref $t9, "Triceps::Table");
+
+	foreach my $b (4, 1, 2) {
+		foreach my $c (2, 1) {
+			$t9->insert($rt1->makeRowHash(b => $b, c => $c, e => "r$b$c"));
+		}
+	}
+
+	# the range of groups [2, 3]
+	my $res = "";
+	my $end = $t9->upperBoundIdx($itb, $rt1->makeRowHash(b => 3));
+	for (my $rh = $t9->lowerBoundIdx($itb, $rt1->makeRowHash(b => 2)); 
+			!$rh->same($end); $rh = $rh->nextIdx($itb)) {
+		$res .= $rh->getRow()->get("e") . " ";
+	}
+	ok($res, "r21 r22 ");
+
+	# the search in a nested index continues past the end of the group
+	my $rh = $t9->lowerBoundIdx($itc, $rt1->makeRowHash(b => 2, c => 2));
+	ok($rh->getRow()->get("e"), "r22");
+	$rh = $t9->upperBoundIdx($itc, $t9->makeRowHandle($rt1->makeRowHash(b => 2, c => 2)));
+	ok($rh->getRow()->get("e"), "r41");
+	$rh = $t9->upperBoundIdx($itc, $rt1->makeRowHash(b => 4, c => 2));
+	ok($rh->isNull());
+	# the group doesn't exist
+	$rh = $t9->lowerBoundIdx($itc, $rt1->makeRowHash(b => 3, c => 0));
+	ok($rh->isNull());
+
+	# errors
+	ok(! eval { $t9->lowerBoundIdx($itf, $rt1->makeRowHash(b => 2)); });
+	ok($@ =~ /^Table 't9': the range search requires an ordered index, got IT_FIFO./) or print STDERR "got: $@\n";
+	ok(! eval { $t9->upperBoundIdx($itb, $t9); });
+	ok($@ =~ /^Triceps::Table::upperBoundIdx: row argument has an incorrect magic for Row or RowHandle/) or print STDERR "got: $@\n";
+	ok(! eval { $t9->lowerBoundIdx($it1, $rt1->makeRowHash(b => 2)); });
+	ok($@ =~ /^Triceps::Table::lowerBoundIdx: indexType argument does not belong to table's type/) or print STDERR "got: $@\n";
+}
+
+#########
+# expiration by a time window
+
+{
+	my $u = Triceps::Unit->new("u");
+	my $rtw = Triceps::RowType->new(k => "int32", ts => "int64", v => "int64");
+	my $ttw = Triceps::TableType->new($rtw)
+		->addSubIndex("byk", Triceps::IndexType->newHashed(key => [ "k" ])
+			->addSubIndex("window", Triceps::IndexType->newTimeWindow(field => "ts"))
+		);
+	$ttw->initialize();
+	my $itw = $ttw->findSubIndex("byk")->findSubIndex("window");
+	my $tw = $u->makeTable($ttw, "tw");
+
+	ok($tw->insert($rtw->makeRowHash(k => 1, ts => 20, v => 1)));
+	ok($tw->insert($rtw->makeRowHash(k => 1, ts => 10, v => 2)));
+	ok($tw->insert($rtw->makeRowHash(k => 2, ts => 30, v => 3)));
+	ok($tw->insert($rtw->makeRowHash(k => 2, ts => 15, v => 4)));
+
+	my $res = "";
+	for (my $rh = $tw->beginIdx($itw); !$rh->isNull(); $rh = $rh->nextIdx($itw)) {
+		$res .= $rh->getRow()->get("v") . " ";
+	}
+	ok($res =~ /^(2 1 4 3 |4 3 2 1 )$/) or print STDERR "got: $res\n";
+
+	ok($tw->expireBefore(16), 2);
+	ok($tw->size(), 2);
+	ok($tw->expireBeforeIdx($itw, 16), 0);
+	ok($tw->expireBeforeIdx($itw, 100), 2);
+	ok($tw->size(), 0);
+
+	# errors
+	ok(! eval { $tw->expireBeforeIdx($ttw->findSubIndex("byk"), 1); });
+	ok($@ =~ /^Table 'tw' can expire the rows only by a TimeWindow index type from its own table type./) or print STDERR "got: $@\n";
+	ok(! eval { $tw->expireBeforeIdx($it1, 1); });
+	ok($@ =~ /^Triceps::Table::expireBeforeIdx: indexType argument does not belong to table's type/) or print STDERR "got: $@\n";
+	my $ttf = Triceps::TableType->new($rtw)
+		->addSubIndex("fifo", Triceps::IndexType->newFifo());
+	$ttf->initialize();
+	my $tf = $u->makeTable($ttf, "tf");
+	ok(! eval { $tf->expireBefore(1); });
+	ok($@ =~ /^Table 'tf' has no TimeWindow index to expire the rows by./) or print STDERR "got: $@\n";
+}
@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 171 };
+BEGIN { plan tests => 177 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -50,7 +50,9 @@ ok(&Triceps::IT_HASHED, 1);
 ok(&Triceps::IT_FIFO, 2);
 ok(&Triceps::IT_SORTED, 3);
 ok(&Triceps::IT_ORDERED, 4);
-ok(&Triceps::IT_LAST, 5);
+ok(&Triceps::IT_TOP, 5);
+ok(&Triceps::IT_TIMEWINDOW, 6);
+ok(&Triceps::IT_LAST, 7);
 
 ok(&Triceps::AO_BEFORE_MOD, 0);
 ok(&Triceps::AO_AFTER_DELETE, 1);
@@ -109,6 +111,8 @@ ok(&Triceps::stringIndexId("IT_ROOT"), &Triceps::IT_ROOT);
 ok(&Triceps::stringIndexId("IT_HASHED"), &Triceps::IT_HASHED);
 ok(&Triceps::stringIndexId("IT_FIFO"), &Triceps::IT_FIFO);
 ok(&Triceps::stringIndexId("IT_SORTED"), &Triceps::IT_SORTED);
+ok(&Triceps::stringIndexId("IT_TOP"), &Triceps::IT_TOP);
+ok(&Triceps::stringIndexId("IT_TIMEWINDOW"), &Triceps::IT_TIMEWINDOW);
 ok(&Triceps::stringIndexId("IT_LAST"), &Triceps::IT_LAST);
 ok(eval { &Triceps::stringIndexId("xxx"); }, undef);
 ok($@, qr/^Triceps::stringIndexId: bad index id string 'xxx' at/);
@@ -174,6 +178,8 @@ ok(&Triceps::indexIdString(&Triceps::IT_ROOT), "IT_ROOT");
 ok(&Triceps::indexIdString(&Triceps::IT_HASHED), "IT_HASHED");
 ok(&Triceps::indexIdString(&Triceps::IT_FIFO), "IT_FIFO");
 ok(&Triceps::indexIdString(&Triceps::IT_SORTED), "IT_SORTED");
+ok(&Triceps::indexIdString(&Triceps::IT_TOP), "IT_TOP");
+ok(&Triceps::indexIdString(&Triceps::IT_TIMEWINDOW), "IT_TIMEWINDOW");
 ok(&Triceps::indexIdString(&Triceps::IT_LAST), "IT_LAST");
 ok(eval { &Triceps::indexIdString(999); }, undef);
 ok($@, qr/^Triceps::indexIdString: index id value '999' not defined in the enum at/);
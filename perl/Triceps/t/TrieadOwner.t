@@ -17,7 +17,7 @@ use strict;
 use threads;
 
 use Test;
-BEGIN { plan tests => 253 };
+BEGIN { plan tests => 284 };
 use Triceps;
 use Carp;
 # for the file interruption test
@@ -340,7 +340,9 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 			one => $tt,
 		],
 		reverse => 0,
+		unicast => 0,
 		queueLimit => 100,
+		queueRing => 1,
 		import => "writer",
 	);
 	ok(ref $fa, "Triceps::Facet");
@@ -354,6 +356,12 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 		ok($fa->same($fa2));
 	}
 
+	# the adaptive waiting
+	ok($to1->getQueueSpin(), 0);
+	$to1->setQueueSpin(100);
+	ok($to1->getQueueSpin(), 100);
+	$to1->setQueueSpin(0);
+
 	#########
 	# Test of Facet methods
 	ok($fa->same($fa));
@@ -361,7 +369,24 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 	ok($fa->getFullName(), "t1/nx1");
 	ok($fa->isWriter());
 	ok(!$fa->isReverse());
+	ok(!$fa->isUnicast());
+	ok(!$fa->isPartitioned());
 	ok($fa->queueLimit(), 100);
+	ok($fa->queueRing(), 1);
+	ok(!$fa->isCoalescing());
+	ok($fa->coalesceTrans(), 0);
+	$fa->setCoalesce(10, 100, 500);
+	ok($fa->isCoalescing());
+	ok($fa->coalesceTrans(), 10);
+	ok($fa->coalesceOps(), 100);
+	ok($fa->coalesceDelayUs(), 500);
+	$fa->setCoalesce(0);
+	ok(!$fa->isCoalescing());
+	ok($fa->coalesceOps(), 0);
+	ok($fa->coalesceDelayUs(), 0);
+	eval { $fa->setCoalesce(10, -1); };
+	ok($@, qr/^Can not set the coalescing limits of the facet 't1\/nx1' to maxTrans=10 maxOps=-1 maxDelayUs=0, they must not be negative./);
+	ok($fa->coalesceTrans(), 0);
 	ok($fa->beginIdx(), 2);
 	ok($fa->endIdx(), 3);
 
@@ -397,6 +422,9 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 	eval { $fa->flushWriter(); };
 	ok($@, qr/^Can not flush the facet 't1\/nx1' before waiting for App readiness/);
 
+	ok($to1->flushDueUs(), -1);
+	eval { $to1->flushWritersDue(); };
+	ok($@, qr/^Can not flush the thread 't1' before waiting for App readiness./);
 	eval { $to1->flushWriters(); };
 	ok($@, qr/^Can not flush the thread 't1' before waiting for App readiness/);
 
@@ -411,7 +439,10 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 	# test the Nexus methods
 	ok($exp[1]->getTrieadName(), "t1");
 	ok($exp[1]->isReverse(), 0);
+	ok($exp[1]->isUnicast(), 0);
+	ok($exp[1]->isPartitioned(), 0);
 	ok($exp[1]->queueLimit(), 100);
+	ok($exp[1]->queueRing(), 1);
 
 	@exp = $t1->imports();
 	ok($#exp, 1);
@@ -558,6 +589,23 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 		import => "NO",
 	);
 
+	# the partitioned nexus
+	$fa = $to1->makeNexus(
+		name => "nx7",
+		labels => [
+			one => $rt1,
+			two => $lb,
+		],
+		partition => [
+			one => [ "b", "c" ],
+		],
+		import => "reader",
+	);
+	ok($fa->isPartitioned());
+	ok($fa->isUnicast());
+	ok($fa->nexus()->isPartitioned());
+	ok($fa->nexus()->isUnicast());
+
 	# the errors
 	&badNexus($to1, name => "nx1");
 	ok($@, qr/Triceps::TrieadOwner::makeNexus: invalid arguments:\n  Can not export the nexus with duplicate name 'nx1' in app 'a1' thread 't1'/);
@@ -579,6 +627,12 @@ sub badFacet # (trieadOwner, optName, optValue, ...)
 	ok($@, qr/^Triceps::TrieadOwner::makeNexus: option 'tableTypes' value must be a reference to array/);
 	&badNexus($to1, tableTypes => [a => $rt1]);
 	ok($@, qr/^Triceps::TrieadOwner::makeNexus: in option 'tableTypes' element 1 with name 'a' value has an incorrect magic for Triceps::TableType/);
+	&badNexus($to1, partition => {one => ["b"]});
+	ok($@, qr/^Triceps::TrieadOwner::makeNexus: option 'partition' value must be a reference to array/);
+	&badNexus($to1, partition => ["one"]);
+	ok($@, qr/^Triceps::TrieadOwner::makeNexus: option 'partition' must contain the pairs of label names and keys, got 1 elements/);
+	&badNexus($to1, partition => [one => ["zz"], xx => ["b"]]);
+	ok($@, qr/^Triceps::TrieadOwner::makeNexus: invalid arguments:\n  In app 'a1' thread 't1' can not export the facet 'nx' with an error:\n    Can not find the partition key field 'zz' in the label 'one'.\n    Can not partition by an unknown label 'xx'./);
 
 	$to1->markConstructed();
 	&badNexus($to1);
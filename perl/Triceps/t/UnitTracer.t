@@ -15,7 +15,7 @@
 use ExtUtils::testlib;
 
 use Test;
-BEGIN { plan tests => 14 };
+BEGIN { plan tests => 36 };
 use Triceps;
 ok(1); # If we made it this far, we're ok.
 
@@ -70,6 +70,63 @@ ok(ref $tp2, "Triceps::UnitTracerPerl");
 
 # execution tested in Unit.t
 
+################### profiling tracer #############################
+
+$tpr1 = Triceps::UnitTracerProfiling->new();
+ok(ref $tpr1, "Triceps::UnitTracerProfiling");
+
+{
+	my $u = Triceps::Unit->new("u");
+	my $rt = Triceps::RowType->new(a => "int32");
+	$u->setTracer($tpr1);
+	ok(ref $u->getTracer(), "Triceps::UnitTracerProfiling");
+
+	my $lbInner = $u->makeLabel($rt, "inner", undef, sub {
+		my $x = 0;
+		for (my $i = 0; $i < 20000; $i++) { $x += $i; }
+	});
+	my $lbTop = $u->makeLabel($rt, "top", undef, sub {
+		$u->call($lbInner->adopt($_[1]));
+	});
+	for (my $i = 0; $i < 3; $i++) {
+		$u->makeArrayCall($lbTop, "OP_INSERT", $i);
+	}
+
+	my @st = $tpr1->snapshot();
+	ok($#st, 1);
+	ok($st[0]->{label}, "inner");
+	ok($st[1]->{label}, "top");
+	ok($st[0]->{unit}, "u");
+	ok($st[0]->{calls}, 3);
+	ok($st[1]->{calls}, 3);
+	ok($st[0]->{self} <= $st[0]->{inclusive});
+	ok($st[1]->{inclusive} >= $st[0]->{inclusive} + $st[1]->{self});
+	ok($st[0]->{max} * 3 >= $st[0]->{inclusive});
+	my $hist = $st[0]->{hist};
+	ok($#$hist + 1, 32);
+	my $n = 0;
+	foreach my $v (@$hist) { $n += $v; }
+	ok($n, 3);
+
+	my @ust = $tpr1->snapshotUnits();
+	ok($#ust, 0);
+	ok($ust[0]->{unit}, "u");
+	ok($ust[0]->{calls}, 6);
+	ok($ust[0]->{self}, $st[0]->{self} + $st[1]->{self});
+
+	$tpr1->reset();
+	@st = $tpr1->snapshot();
+	ok($#st, -1);
+	@ust = $tpr1->snapshotUnits();
+	ok($#ust, -1);
+
+	# the methods on a wrong subclass return undef
+	ok(!defined $ts1->Triceps::UnitTracerProfiling::snapshot());
+	ok(!defined $ts1->Triceps::UnitTracerProfiling::snapshotUnits());
+
+	$u->clearLabels();
+}
+
 #######################
 # this has nothing to do with tracers as such, just a test that the Parl class
 # inheritance passes through correctly from the C++ classes
@@ -80,6 +137,9 @@ ok($v, "UnitTracerStringName");
 $v = $tp1->__testSubclassCall();
 ok($v, "UnitTracerPerl");
 
+$v = $tpr1->__testSubclassCall();
+ok($v, "UnitTracerProfiling");
+
 $v = $ts1->__testSuperclassCall();
 ok($v, 1);
 
@@ -503,7 +503,7 @@ tDaily.out OP_INSERT day="20120305" bytes="200"
 > new,OP_INSERT,1331145211000000
 tDaily.out OP_INSERT day="20120306" bytes="0" 
 > dumpDaily
+day="20120306" bytes="0" 
 day="20120305" bytes="200" 
 day="20120304" bytes="450" 
-day="20120306" bytes="0" 
 ');